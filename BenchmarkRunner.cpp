@@ -0,0 +1,261 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "C/sema/Compilation.h"
+#include "C/syntax/SyntaxTree.h"
+#include "common/infra/Instrumentation.h"
+#include "utility/IO.h"
+
+#include "cxxopts.hpp"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+const char* const kBenchmark = "benchmark: ";
+
+/*
+ * The phases, in the order in which they're reported.
+ */
+const char* const kPhases[] = {
+    "lex",
+    "parse",
+    "index",
+    "reparse",
+    "bind",
+    "canonicalize",
+    "resolve",
+    "check"
+};
+constexpr std::size_t kPhaseCnt = sizeof(kPhases) / sizeof(kPhases[0]);
+
+// The phases up to (and including) this one are those of a SyntaxTree;
+// the remaining ones are those of a Compilation.
+constexpr std::size_t kLastSyntaxPhase = 3;
+
+struct Input
+{
+    std::string filePath_;
+    std::string text_;
+};
+
+struct PhaseResult
+{
+    std::uint64_t nanoseconds_ = std::numeric_limits<std::uint64_t>::max();
+    long peakRSS_ = 0;
+};
+
+long peakRSS()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return usage.ru_maxrss;
+}
+
+std::size_t phaseIndex(const std::string& phase)
+{
+    for (auto i = 0U; i < kPhaseCnt; ++i) {
+        if (phase == kPhases[i])
+            return i;
+    }
+    return kPhaseCnt;
+}
+
+/*
+ * Run every phase over every input, once, and keep (per phase) the best time.
+ */
+std::uint64_t runOnce(const std::vector<Input>& inputs, std::vector<PhaseResult>& results)
+{
+    Instrumentation::reset();
+
+    std::vector<std::unique_ptr<SyntaxTree>> trees;
+    for (const auto& input : inputs) {
+        trees.push_back(SyntaxTree::parseText(input.text_,
+                                              TextPreprocessingState::Preprocessed,
+                                              TextCompleteness::Fragment,
+                                              ParseOptions(),
+                                              input.filePath_));
+    }
+    auto syntaxRSS = peakRSS();
+
+    std::vector<std::unique_ptr<Compilation>> compilations;
+    for (const auto& tree : trees) {
+        compilations.push_back(Compilation::create(tree->filePath()));
+        compilations.back()->addSyntaxTree(tree.get());
+        compilations.back()->computeSemanticModel(tree.get());
+    }
+    auto semaRSS = peakRSS();
+    compilations.clear();
+    trees.clear();
+
+    std::vector<std::uint64_t> nanoseconds(kPhaseCnt, 0);
+    std::uint64_t tokens = 0;
+    for (const auto& m : Instrumentation::measurements()) {
+        auto idx = phaseIndex(m.phase_);
+        if (idx == kPhaseCnt)
+            continue;
+        nanoseconds[idx] += m.nanoseconds_;
+        for (const auto& c : m.counters_) {
+            if (idx == 0 && c.first == "tokens")
+                tokens += c.second;
+        }
+    }
+
+    for (auto i = 0U; i < kPhaseCnt; ++i) {
+        results[i].nanoseconds_ = std::min(results[i].nanoseconds_, nanoseconds[i]);
+        results[i].peakRSS_ = i <= kLastSyntaxPhase ? syntaxRSS : semaRSS;
+    }
+
+    return tokens;
+}
+
+void writePhase(std::ostream& os,
+                const char* name,
+                std::uint64_t nanoseconds,
+                std::uint64_t bytes,
+                std::uint64_t tokens,
+                long peakRSS)
+{
+    auto seconds = nanoseconds / 1e9;
+    os << "{ \"phase\": \"" << name << "\""
+       << ", \"seconds\": " << std::fixed << std::setprecision(6) << seconds
+       << ", \"mb_per_s\": " << std::setprecision(3)
+       << (seconds > 0 ? (bytes / 1e6) / seconds : 0.0)
+       << ", \"tokens_per_s\": " << std::setprecision(0)
+       << (seconds > 0 ? tokens / seconds : 0.0)
+       << ", \"peak_rss_kb\": " << peakRSS
+       << " }";
+}
+
+} // anonymous
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options cmdLineOpts(argv[0], "benchmark of psychec's C frontend");
+    cmdLineOpts
+        .positional_help("file...")
+        .add_options()
+            ("file",
+                "The (preprocessed) input file(s) path(s).",
+                cxxopts::value<std::vector<std::string>>())
+            ("r,repeat",
+                "Run the phases <n> times, reporting the best time of each.",
+                cxxopts::value<int>()->default_value("5"),
+                "<n>")
+            ("o,output",
+                "Write the results, as JSON, to <file> (instead of stdout).",
+                cxxopts::value<std::string>(),
+                "<file>")
+            ("h,help",
+                "Print instructions.")
+    ;
+
+    std::vector<std::string> filesPaths;
+    int repeat = 0;
+    std::string outputPath;
+    try {
+        cmdLineOpts.parse_positional(std::vector<std::string>{"file"});
+        auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
+
+        if (parsedCmdLine.count("help")) {
+            std::cout << cmdLineOpts.help() << std::endl;
+            return 0;
+        }
+        if (parsedCmdLine.count("file"))
+            filesPaths = parsedCmdLine["file"].as<std::vector<std::string>>();
+        repeat = parsedCmdLine["repeat"].as<int>();
+        if (parsedCmdLine.count("output"))
+            outputPath = parsedCmdLine["output"].as<std::string>();
+    }
+    catch (...) {
+        std::cerr << kBenchmark << "unrecognized command-line flag" << std::endl;
+        return 1;
+    }
+
+    if (filesPaths.empty()) {
+        std::cerr << kBenchmark << "no input file(s)" << std::endl;
+        return 1;
+    }
+    if (repeat < 1) {
+        std::cerr << kBenchmark << "invalid repetition count" << std::endl;
+        return 1;
+    }
+    if (!Instrumentation::isSupported()) {
+        std::cerr << kBenchmark << "instrumentation isn't compiled in" << std::endl;
+        return 1;
+    }
+
+    std::vector<Input> inputs;
+    std::uint64_t bytes = 0;
+    for (const auto& filePath : filesPaths) {
+        auto [exit, text] = readFile(filePath);
+        if (exit != 0)
+            return 1;
+        bytes += text.size();
+        inputs.push_back(Input{ filePath, std::move(text) });
+    }
+
+    Instrumentation::enable(true);
+    std::vector<PhaseResult> results(kPhaseCnt);
+    std::uint64_t tokens = 0;
+    for (auto i = 0; i < repeat; ++i)
+        tokens = runOnce(inputs, results);
+    Instrumentation::enable(false);
+
+    std::ostringstream oss;
+    oss << "{\n"
+        << "  \"version\": 1,\n"
+        << "  \"files\": " << inputs.size() << ",\n"
+        << "  \"bytes\": " << bytes << ",\n"
+        << "  \"tokens\": " << tokens << ",\n"
+        << "  \"repeat\": " << repeat << ",\n"
+        << "  \"phases\": [";
+    std::uint64_t totalNanoseconds = 0;
+    long totalPeakRSS = 0;
+    for (auto i = 0U; i < kPhaseCnt; ++i) {
+        oss << (i ? ",\n    " : "\n    ");
+        writePhase(oss, kPhases[i], results[i].nanoseconds_, bytes, tokens, results[i].peakRSS_);
+        totalNanoseconds += results[i].nanoseconds_;
+        totalPeakRSS = std::max(totalPeakRSS, results[i].peakRSS_);
+    }
+    oss << "\n  ],\n  \"total\": ";
+    writePhase(oss, "total", totalNanoseconds, bytes, tokens, totalPeakRSS);
+    oss << "\n}\n";
+
+    if (outputPath.empty()) {
+        std::cout << oss.str();
+        return 0;
+    }
+    return writeFile(outputPath, oss.str());
+}
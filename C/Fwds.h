@@ -34,6 +34,7 @@ class SyntaxTree;
 class Compilation;
 
 class SyntaxToken;
+class SyntaxTrivia;
 
 class Lexeme;
 class Identifier;
@@ -212,6 +213,17 @@ typedef SyntaxNodePlainList<ExtKR_ParameterDeclarationSyntax*> ExtKR_ParameterDe
 
 class Compilation;
 class SemanticModel;
+class SemanticModelSnapshot;
+class ConstantValue;
+class TypeLayout;
+class FieldLayout;
+class TypeLayoutCalculator;
+class SymbolIndex;
+class LinkageResolver;
+class CallGraph;
+class CallGraphBuilder;
+class ReferenceRecorder;
+class UnusedDeclarationChecker;
 class Scope;
 class Block;
 
@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Fuzzer.h"
+
+#include "parser/Lexer.h"
+#include "parser/ParseOptions.h"
+#include "syntax/SyntaxTree.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+const char* const kFuzzFilePath = "<fuzz>";
+
+void parse(const std::uint8_t* data,
+           std::size_t size,
+           SyntaxTree::SyntaxCategory syntaxCat,
+           ParseOptions::AmbiguityMode ambigMode)
+{
+    ParseOptions parseOpts;
+    parseOpts.setAmbiguityMode(ambigMode);
+    SyntaxTree::parseText(SourceText(std::string(reinterpret_cast<const char*>(data), size)),
+                          TextPreprocessingState::Preprocessed,
+                          TextCompleteness::Fragment,
+                          parseOpts,
+                          kFuzzFilePath,
+                          syntaxCat);
+}
+
+} // anonymous
+
+int Fuzzer::run(Target target, const std::uint8_t* data, std::size_t size)
+{
+    try {
+        switch (target) {
+            case Target::Lex:
+                lex(data, size);
+                break;
+
+            case Target::Parse:
+                parse(data, size,
+                      SyntaxTree::SyntaxCategory::Any,
+                      ParseOptions::AmbiguityMode::Diagnose);
+                break;
+
+            case Target::ParseDeclarations:
+                parse(data, size,
+                      SyntaxTree::SyntaxCategory::Declarations,
+                      ParseOptions::AmbiguityMode::Diagnose);
+                break;
+
+            case Target::ParseExpressions:
+                parse(data, size,
+                      SyntaxTree::SyntaxCategory::Expressions,
+                      ParseOptions::AmbiguityMode::Diagnose);
+                break;
+
+            case Target::ParseStatements:
+                parse(data, size,
+                      SyntaxTree::SyntaxCategory::Statements,
+                      ParseOptions::AmbiguityMode::Diagnose);
+                break;
+
+            case Target::Reparse:
+                parse(data, size,
+                      SyntaxTree::SyntaxCategory::Any,
+                      ParseOptions::AmbiguityMode::DisambiguateAlgorithmicallyAndHeuristically);
+                break;
+        }
+    }
+    catch (const std::runtime_error&) {
+    }
+
+    return 0;
+}
+
+void Fuzzer::lex(const std::uint8_t* data, std::size_t size)
+{
+    std::unique_ptr<SyntaxTree> tree(
+            new SyntaxTree(SourceText(std::string(reinterpret_cast<const char*>(data), size)),
+                           TextPreprocessingState::Preprocessed,
+                           TextCompleteness::Fragment,
+                           ParseOptions(),
+                           kFuzzFilePath));
+    Lexer lexer(tree.get());
+    lexer.lex();
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_FUZZER_H__
+#define PSYCHE_C_FUZZER_H__
+
+#include "API.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The Fuzzer class.
+ *
+ * The entry points of the fuzz targets of the frontend: each one takes an
+ * arbitrary input, as libFuzzer provides it, and runs a stage of the
+ * frontend over it.
+ *
+ * \remark A \c std::runtime_error, with which the parser bails out of
+ * deeply nested input, is an accepted outcome; any other exception, an
+ * assertion failure, or a crash, is a finding.
+ */
+class PSY_C_API Fuzzer
+{
+public:
+    /**
+     * \brief The Target enumeration.
+     */
+    enum class Target : std::uint8_t
+    {
+        Lex,
+        Parse,
+        ParseDeclarations,
+        ParseExpressions,
+        ParseStatements,
+        Reparse,
+    };
+
+    /**
+     * Run \p target over the \p size bytes of \p data.
+     */
+    static int run(Target target, const std::uint8_t* data, std::size_t size);
+
+private:
+    static void lex(const std::uint8_t* data, std::size_t size);
+};
+
+} // C
+} // psy
+
+#endif
@@ -23,15 +23,43 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
 
 using namespace psy;
 using namespace C;
 
-MemoryPool::MemoryPool()
-    : blocks_(0)
+namespace {
+
+char* allocateBlock(std::size_t size)
+{
+#ifdef _WIN32
+    return static_cast<char*>(_aligned_malloc(size, size));
+#else
+    return static_cast<char*>(std::aligned_alloc(size, size));
+#endif
+}
+
+void freeBlock(char* block)
+{
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    std::free(block);
+#endif
+}
+
+} // anonymous
+
+MemoryPool::MemoryPool(void* owner)
+    : owner_(owner)
+    , blocks_(0)
     , allocatedBlocks_(0)
     , blockCount_(-1)
-    , ptr_(0)\
+    , ptr_(0)
     , end_(0)
 {}
 
@@ -40,7 +68,7 @@ MemoryPool::~MemoryPool()
     if (blocks_) {
         for (int i = 0; i < allocatedBlocks_; ++i) {
             if (char* b = blocks_[i])
-                std::free(b);
+                freeBlock(b);
         }
         std::free(blocks_);
     }
@@ -52,6 +80,13 @@ void MemoryPool::reset()
     ptr_ = end_ = 0;
 }
 
+size_t MemoryPool::usedBytes() const
+{
+    if (blockCount_ < 0)
+        return 0;
+    return blockCount_ * BLOCK_SIZE + (ptr_ - (end_ - BLOCK_SIZE));
+}
+
 void* MemoryPool::allocate_helper(size_t size)
 {
     if (++blockCount_ == allocatedBlocks_) {
@@ -67,11 +102,13 @@ void* MemoryPool::allocate_helper(size_t size)
     }
 
     char*& block = blocks_[blockCount_];
-    if (!block)
-        block = (char *) std::malloc(BLOCK_SIZE);
+    if (!block) {
+        block = allocateBlock(BLOCK_SIZE);
+        new (block) BlockHeader{owner_};
+    }
 
-    ptr_ = block;
-    end_ = ptr_ + BLOCK_SIZE;
+    ptr_ = block + sizeof(BlockHeader);
+    end_ = block + BLOCK_SIZE;
 
     void* addr = ptr_;
     ptr_ += size;
@@ -25,14 +25,23 @@
 #include "API.h"
 
 #include <cstddef>
+#include <cstdint>
 
 namespace psy {
 namespace C {
 
+/**
+ * \brief The MemoryPool class.
+ *
+ * A bump allocator over fixed-size blocks. Every block is aligned to its
+ * own size and starts with a header that records the \a owner of the pool,
+ * so the owner of any object allocated in the pool can be recovered from
+ * the object's address alone (see \c ownerOf).
+ */
 class PSY_C_INTERNAL_API MemoryPool
 {
 public:
-    MemoryPool();
+    MemoryPool(void* owner = nullptr);
     ~MemoryPool();
 
     // Unavailable
@@ -41,6 +50,18 @@ public:
 
     void reset();
 
+    size_t usedBytes() const;
+
+    /**
+     * The owner of the pool in which the object at address \p p was
+     * allocated.
+     */
+    static void* ownerOf(const void* p)
+    {
+        auto addr = reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t(BLOCK_SIZE - 1);
+        return reinterpret_cast<const BlockHeader*>(addr)->owner_;
+    }
+
     void* allocate(size_t size)
     {
         size = (size + 7) & ~7;
@@ -55,6 +76,12 @@ public:
 private:
     void* allocate_helper(size_t size);
 
+    struct alignas(16) BlockHeader
+    {
+        void* owner_;
+    };
+
+    void* owner_;
     char** blocks_;
     int allocatedBlocks_;
     int blockCount_;
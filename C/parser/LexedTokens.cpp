@@ -47,8 +47,3 @@ void LexedTokens::clear()
 {
     tks_.clear();
 }
-
-LexedTokens::IndexType LexedTokens::invalidIndex()
-{
-    return 0;
-}
@@ -27,6 +27,7 @@
 
 #include "../common/infra/AccessSpecifiers.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace psy {
@@ -41,12 +42,17 @@ class PSY_C_INTERNAL_API LexedTokens
 {
 public:
     using SizeType = std::vector<SyntaxToken>::size_type;
-    using IndexType = SizeType;
+
+    /*
+     * Token indexes are stored in every SyntaxNode, so they're kept to
+     * 32 bits (as are the byte offsets of tokens, see SyntaxToken).
+     */
+    using IndexType = std::uint32_t;
 
     SyntaxToken& tokenAt(IndexType tkIdx);
     SizeType count() const;
 
-    static IndexType invalidIndex();
+    static IndexType invalidIndex() { return 0; }
 
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(SyntaxTree);
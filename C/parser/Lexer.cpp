@@ -66,6 +66,7 @@ Lexer::Lexer(SyntaxTree* tree)
     , offset_(~0)  // Start immediately "before" 0.
     , withinLogicalLine_(false)
     , syntaxK_splitTk(SyntaxKind::EndOfFile)
+    , curExpansionIdx_(0)
     , diagReporter_(this)
 {}
 
@@ -113,8 +114,6 @@ void Lexer::lex()
     // Line and column...
     tree_->relayLineDirective(0, 1, tree_->filePath());
     tree_->relayLineStart(0);
-    std::vector<std::pair<unsigned int, unsigned int>> expansions;
-    unsigned int curExpansionIdx = 0;
 
     // SyntaxKind::Open/close brace tracking.
     std::stack<unsigned> braces;
@@ -126,91 +125,8 @@ void Lexer::lex()
 
 LexEntry:
         if (tk.isAtStartOfLine() && tk.isKind(SyntaxKind::HashToken)) {
-            auto offset = tk.charOffset_;
+            lexDirective(tk.charOffset_);
             yylex(&tk);
-
-            if (!tk.isAtStartOfLine()
-                    && tk.isKind(SyntaxKind::IdentifierToken)
-                    && !strcmp(tk.identifier_->c_str(), kExpansion)) {
-                // A Qt Creator-specific macro mark.
-                yylex(&tk);
-
-                if (!tk.isAtStartOfLine() && tk.isKind(SyntaxKind::IdentifierToken)) {
-                    if (!strcmp(tk.identifier_->c_str(), kBegin)) {
-                        // The start of an expansion section.
-                        yylex(&tk);
-
-                        // Gather where it happens and its length.
-                        yylex(&tk);
-                        yylex(&tk); // Skip the separating comma.
-                        yylex(&tk);
-
-                        // Gather the real line and column from the upcoming tokens; only
-                        // relevant for tokens which are expanded but not generated.
-                        while (!tk.isKind(SyntaxKind::EndOfFile)
-                                    && !tk.isAtStartOfLine()) {
-                            // A ~ means that the a number of generated tokens follows;
-                            // otherwise, what follows is data.
-                            if (tk.isKind(SyntaxKind::TildeToken)) {
-                                yylex(&tk);
-
-                                // Get the total number of generated tokens and specify "null"
-                                // information for them.
-                                auto all = strtoul(tk.valueText_c_str(), 0, 0);
-                                auto prevSize = expansions.size();
-                                expansions.resize(prevSize + all);
-                                std::fill(expansions.begin() + prevSize,
-                                          expansions.end(),
-                                          std::make_pair(0, 0));
-
-                                yylex(&tk);
-                            }
-                            else if (tk.isKind(SyntaxKind::IntegerConstantToken)) {
-                                auto lineno = strtoul(tk.valueText_c_str(), 0, 0);
-                                yylex(&tk);
-                                yylex(&tk); // Skip the separating colon.
-                                auto column = strtoul(tk.valueText_c_str(), 0, 0);
-                                yylex(&tk);
-
-                                // Store line and column for this non-generated token.
-                                expansions.push_back(std::make_pair(lineno, column));
-                            }
-                        }
-                    }
-                    else if (!strcmp(tk.identifier_->c_str(), kEnd)) {
-                        // The end of an expansion section.
-                        expansions.clear();
-                        curExpansionIdx = 0;
-                        yylex(&tk);
-                    }
-                }
-            }
-            else {
-                // A regular preprocessor directive.
-                if (!tk.isAtStartOfLine()
-                        && tk.isKind(SyntaxKind::IdentifierToken)
-                        && !strcmp(tk.identifier_->c_str(), kLine)) {
-                    yylex(&tk);
-                }
-
-                if (!tk.isAtStartOfLine()
-                        && tk.isKind(SyntaxKind::IntegerConstantToken)) {
-                    auto lineno = strtoul(tk.valueText_c_str(), 0, 0);
-                    yylex(&tk);
-
-                    if (!tk.isAtStartOfLine()
-                            && tk.isKind(SyntaxKind::StringLiteralToken)) {
-                        auto fileName = tree_->findOrInsertStringLiteral(tk.string_->c_str(), tk.string_->size());
-                        tree_->relayLineDirective(offset, lineno, fileName->c_str());
-                        yylex(&tk);
-                    }
-                }
-
-                while (!tk.isAtStartOfLine() && !tk.isKind(SyntaxKind::EndOfFile)) {
-                    // Skip the remaining of the line, ignoring a possible include.
-                    yylex(&tk);
-                }
-            }
             goto LexEntry;
         }
         else if (tk.kind() == SyntaxKind::OpenBraceToken) {
@@ -222,22 +138,30 @@ LexEntry:
             if (idx < tree_->tokenCount())
                 tree_->tokenAt(idx).matchingBracket_ = tree_->tokenCount();
         }
-        else if (tk.isComment()) {
-            tree_->comments_.push_back(tk);
-            if (tk.kind() != SyntaxKind::Keyword_ExtPSY_omission)
-                continue;
+        else if (tk.isComment() && tk.kind() != SyntaxKind::Keyword_ExtPSY_omission) {
+            // Comments are kept out of band, as trivia.
+            if (tree_->parseOptions().commentMode() == ParseOptions::CommentMode::KeepAll
+                    || tk.kind() == SyntaxKind::SingleLineDocumentationCommentTrivia
+                    || tk.kind() == SyntaxKind::MultiLineDocumentationCommentTrivia) {
+                tree_->relayTrivia(tk.kind(),
+                                   tk.byteOffset_,
+                                   yytext_ - c_strBeg_,
+                                   tk.charOffset_,
+                                   offset_);
+            }
+            continue;
         }
 
         bool isExpanded = false;
         bool isGenerated = false;
-        if (!expansions.empty() && curExpansionIdx < expansions.size()) {
+        if (curExpansionIdx_ < expansions_.size()) {
             isExpanded = true;
-            const std::pair<unsigned int, unsigned int>& p = expansions[curExpansionIdx];
+            const std::pair<unsigned int, unsigned int>& p = expansions_[curExpansionIdx_];
             if (p.first)
-                tree_->relayExpansion(tk.charStart(), p);
+                tree_->relayExpansion(tree_->tokenCount(), p);
             else
                 isGenerated = true;
-            ++curExpansionIdx;
+            ++curExpansionIdx_;
         }
         tk.BF_.expanded_ = isExpanded;
         tk.BF_.generated_ = isGenerated;
@@ -252,6 +176,207 @@ LexEntry:
     }
 }
 
+/**
+ * Lex a directive, whose \c # (at \a offset) has just been lexed.
+ *
+ * The directives that reach the lexer are those left by a preprocessor:
+ * line markers, which are relayed to the tree, and expansion marks; any
+ * other directive is skipped. Scanning is over the raw text, so that no
+ * tokens are built (nor identifiers and literals interned) for the line.
+ * Upon return, \c yychar_ is the line's terminating newline (or the end).
+ */
+void Lexer::lexDirective(unsigned int offset)
+{
+    skipDirectiveBlanks();
+
+    if (skipDirectiveWord(kExpansion)) {
+        lexDirectiveExpansion();
+        skipDirectiveLine();
+        return;
+    }
+
+    skipDirectiveWord(kLine);
+
+    if (std::isdigit(yychar_)) {
+        auto lineno = lexDirectiveNumber();
+        skipDirectiveBlanks();
+
+        if (yychar_ == '"') {
+            const char* yytext = yytext_;
+            yyinput();
+            while (yychar_ && yychar_ != '"' && yychar_ != '\n') {
+                if (yychar_ == '\\') {
+                    yyinput();
+                    if (!yychar_ || yychar_ == '\n')
+                        break;
+                }
+                yyinput();
+            }
+            if (yychar_ == '"') {
+                yyinput();
+                auto fileName = tree_->findOrInsertStringLiteral(yytext, yytext_ - yytext);
+                tree_->relayLineDirective(offset, lineno, fileName->c_str());
+            }
+        }
+    }
+
+    skipDirectiveLine();
+}
+
+/**
+ * Lex an expansion mark (a Qt Creator-specific one), which either begins
+ * a section with the real line and column of the expanded tokens, or ends it.
+ */
+void Lexer::lexDirectiveExpansion()
+{
+    skipDirectiveBlanks();
+
+    if (skipDirectiveWord(kEnd)) {
+        expansions_.clear();
+        curExpansionIdx_ = 0;
+        return;
+    }
+
+    if (!skipDirectiveWord(kBegin))
+        return;
+
+    // Skip where it happens and its length.
+    skipDirectiveBlanks();
+    lexDirectiveNumber();
+    skipDirectiveBlanks();
+    if (yychar_ == ',')
+        yyinput();
+    skipDirectiveBlanks();
+    lexDirectiveNumber();
+
+    // Gather the real line and column from the upcoming data; only relevant
+    // for tokens which are expanded but not generated.
+    while (true) {
+        skipDirectiveBlanks();
+        if (!yychar_ || yychar_ == '\n')
+            break;
+
+        // A ~ means that the a number of generated tokens follows;
+        // otherwise, what follows is data.
+        if (yychar_ == '~') {
+            yyinput();
+            auto all = lexDirectiveNumber();
+            expansions_.resize(expansions_.size() + all, std::make_pair(0, 0));
+        }
+        else if (std::isdigit(yychar_)) {
+            auto lineno = lexDirectiveNumber();
+            if (yychar_ == ':')
+                yyinput();
+            auto column = lexDirectiveNumber();
+            expansions_.push_back(std::make_pair(lineno, column));
+        }
+        else {
+            yyinput();
+        }
+    }
+}
+
+/**
+ * Skip blanks, line continuations, and comments; a block comment may span
+ * lines, as it does in the definition of a macro.
+ */
+void Lexer::skipDirectiveBlanks()
+{
+    while (true) {
+        if (yychar_ == ' ' || yychar_ == '\t' || yychar_ == '\r' || yychar_ == '\f' || yychar_ == '\v')
+            yyinput();
+        else if (skipDirectiveLineContinuation())
+            continue;
+        else if (yychar_ == '/' && yytext_[1] == '*') {
+            yyinput();
+            yyinput();
+            while (yychar_ && !(yychar_ == '*' && yytext_[1] == '/'))
+                yyinput();
+            if (yychar_) {
+                yyinput();
+                yyinput();
+            }
+        }
+        else if (yychar_ == '/' && yytext_[1] == '/') {
+            while (yychar_ && yychar_ != '\n') {
+                if (!skipDirectiveLineContinuation())
+                    yyinput();
+            }
+        }
+        else
+            break;
+    }
+}
+
+bool Lexer::skipDirectiveLineContinuation()
+{
+    if (yychar_ != '\\'
+            || !(yytext_[1] == '\n' || (yytext_[1] == '\r' && yytext_[2] == '\n')))
+        return false;
+
+    while (yychar_ != '\n')
+        yyinput();
+    yyinput();
+    return true;
+}
+
+bool Lexer::skipDirectiveWord(const char* word)
+{
+    auto leng = strlen(word);
+    if (strncmp(yytext_, word, leng))
+        return false;
+
+    auto c = static_cast<unsigned char>(yytext_[leng]);
+    if (std::isalnum(c) || c == '_' || c == '$' || isByteOfMultiByteCP(c))
+        return false;
+
+    for (; leng; --leng)
+        yyinput();
+    skipDirectiveBlanks();
+    return true;
+}
+
+unsigned long Lexer::lexDirectiveNumber()
+{
+    if (!std::isdigit(yychar_))
+        return 0;
+
+    char* end = nullptr;
+    auto value = strtoul(yytext_, &end, 0);
+    while (yytext_ < end)
+        yyinput();
+    return value;
+}
+
+void Lexer::skipDirectiveLine()
+{
+    while (yychar_ && yychar_ != '\n') {
+        if (yychar_ == '"' || yychar_ == '\'') {
+            // A literal, within which there are no comments.
+            auto quote = yychar_;
+            yyinput();
+            while (yychar_ && yychar_ != quote && yychar_ != '\n') {
+                if (skipDirectiveLineContinuation())
+                    continue;
+                if (yychar_ == '\\') {
+                    yyinput();
+                    if (!yychar_ || yychar_ == '\n')
+                        break;
+                }
+                yyinput();
+            }
+            if (yychar_ == quote)
+                yyinput();
+            continue;
+        }
+
+        auto yytext = yytext_;
+        skipDirectiveBlanks();
+        if (yytext_ == yytext)
+            yyinput();
+    }
+}
+
 void Lexer::yylex_CORE(SyntaxToken* tk)
 {
 LexEntry:
@@ -32,6 +32,8 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace psy {
 namespace C {
@@ -50,6 +52,7 @@ public:
 
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(SyntaxTree);
+    PSY_GRANT_INTERNAL_ACCESS(Fuzzer);
 
     Lexer(SyntaxTree* tree);
 
@@ -66,6 +69,15 @@ private:
                       unsigned int& yycolumn,
                       unsigned int& offset);
 
+    /* Directives (line markers and expansion marks) */
+    void lexDirective(unsigned int offset);
+    void lexDirectiveExpansion();
+    void skipDirectiveBlanks();
+    bool skipDirectiveLineContinuation();
+    bool skipDirectiveWord(const char* word);
+    unsigned long lexDirectiveNumber();
+    void skipDirectiveLine();
+
     /* 6.4.2 Identifiers */
     void lexIdentifier(SyntaxToken* tk, int advanced = 0);
 
@@ -128,6 +140,11 @@ private:
     bool withinLogicalLine_;
     SyntaxKind syntaxK_splitTk;
 
+    // The real line and column of the tokens in the current expansion
+    // section (zeroed for generated ones).
+    std::vector<std::pair<unsigned int, unsigned int>> expansions_;
+    unsigned int curExpansionIdx_;
+
     struct DiagnosticsReporter
     {
         DiagnosticsReporter(Lexer* lexer) : lexer_(lexer) {}
@@ -24,8 +24,6 @@
 using namespace psy;
 using namespace C;
 
-int depth_ = 0;
-
 /* Backtracker */
 
 Parser::Backtracker::Backtracker(Parser* parser, LexedTokens::IndexType tkIdx)
@@ -66,12 +64,14 @@ void Parser::Backtracker::backtrack()
     }
 
 #ifdef DBG_RULE
-    std::cerr << std::string(depth_ * 4, ' ')
+    std::cerr << std::string(parser_->dbgRuleDepth_ * 4, ' ')
               << "BACKTRACKING from  "
               << "`" << parser_->peek().valueText() << "'  "
               << parser_->curTkIdx_ << "  to  ";
 #endif
 
+    PSY_INSTR_DO(++parser_->backtrackCnt_);
+
     auto tkCnt = parser_->tree_->tokenCount();
     if (parser_->curTkIdx_ < tkCnt)
         parser_->curTkIdx_ = refTkIdx_;
@@ -110,11 +110,12 @@ Parser::Parser(SyntaxTree* tree)
     , diagReporter_(this)
     , curTkIdx_(1)
     , isWithinKandRFuncDef_(false)
+    , nodeCnt_(0)
+    , backtrackCnt_(0)
     , DEPTH_OF_EXPRS_(0)
     , DEPTH_OF_STMTS_(0)
-{
-    depth_ = 0;
-}
+    , dbgRuleDepth_(0)
+{}
 
 Parser::~Parser()
 {}
@@ -200,6 +201,45 @@ bool Parser::detectedAnyAmbiguity() const
     return !diagReporter_.retainedAmbiguityDiags_.empty();
 }
 
+std::size_t Parser::nodeCount() const
+{
+    return nodeCnt_;
+}
+
+std::size_t Parser::backtrackCount() const
+{
+    return backtrackCnt_;
+}
+
+const std::vector<Parser::NodeTally>& Parser::nodeTallies() const
+{
+    return nodeTallies_;
+}
+
+Parser::NodeTally Parser::listTally() const
+{
+    return listTally_;
+}
+
+void Parser::tallyNode(const SyntaxNode* node, std::size_t size) const
+{
+    if (!Instrumentation::isEnabled())
+        return;
+    auto k = static_cast<std::size_t>(node->kind());
+    if (k >= nodeTallies_.size())
+        nodeTallies_.resize(k + 1);
+    ++nodeTallies_[k].count_;
+    nodeTallies_[k].bytes_ += size;
+}
+
+void Parser::tallyNode(const SyntaxNodeList*, std::size_t size) const
+{
+    if (!Instrumentation::isEnabled())
+        return;
+    ++listTally_.count_;
+    listTally_.bytes_ += size;
+}
+
 std::vector<
     std::tuple<DiagnosticDescriptor,
                LexedTokens::IndexType,
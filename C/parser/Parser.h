@@ -66,6 +66,27 @@ PSY_INTERNAL:
 
     bool detectedAnyAmbiguity() const;
 
+    std::size_t nodeCount() const;
+    std::size_t backtrackCount() const;
+
+    /**
+     * \brief The NodeTally struct.
+     *
+     * The number of nodes of a given SyntaxKind, and the bytes they take.
+     */
+    struct NodeTally
+    {
+        std::size_t count_ = 0;
+        std::size_t bytes_ = 0;
+    };
+
+    /**
+     * The NodeTally of each SyntaxKind, indexed by kind; lists (which have
+     * no SyntaxKind) are tallied apart.
+     */
+    const std::vector<NodeTally>& nodeTallies() const;
+    NodeTally listTally() const;
+
 private:
     // Unavailable
     Parser(const Parser&) = delete;
@@ -232,9 +253,21 @@ private:
 
     bool isWithinKandRFuncDef_;
 
+    // Counters of the instrumentation.
+    mutable std::size_t nodeCnt_;
+    mutable std::vector<NodeTally> nodeTallies_;
+    mutable NodeTally listTally_;
+    std::size_t backtrackCnt_;
+
+    void tallyNode(const SyntaxNode* node, std::size_t size) const;
+    void tallyNode(const SyntaxNodeList*, std::size_t size) const;
+
     int DEPTH_OF_EXPRS_;
     int DEPTH_OF_STMTS_;
 
+    // The nesting of rules traced with DBG_RULE.
+    int dbgRuleDepth_;
+
     struct DepthControl
     {
         DepthControl(int& depth);
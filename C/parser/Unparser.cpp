@@ -32,7 +32,13 @@ using namespace C;
 
 void Unparser::unparse(const SyntaxNode* node, std::ostream& os)
 {
-    os_ = &os;
+    OutputSink sink(os);
+    unparse(node, sink);
+}
+
+void Unparser::unparse(const SyntaxNode* node, OutputSink& sink)
+{
+    sink_ = &sink;
     visit(node);
 }
 
@@ -41,12 +47,12 @@ void Unparser::terminal(const SyntaxToken& tk, const SyntaxNode*)
     if (tk.kind() == SyntaxKind::EndOfFile)
         return;
 
-    *os_ << tk.valueText_c_str();
+    *sink_ << tk.valueText_c_str();
 
     if (tk.kind() == SyntaxKind::CloseBraceToken
             || tk.kind() == SyntaxKind::OpenBraceToken
             || tk.kind() == SyntaxKind::SemicolonToken)
-        *os_ << "\n";
+        *sink_ << '\n';
     else
-        *os_ << " ";
+        *sink_ << ' ';
 }
@@ -25,6 +25,8 @@
 
 #include "syntax/SyntaxDumper.h"
 
+#include "../common/infra/OutputSink.h"
+
 #include <ostream>
 
 namespace psy {
@@ -36,11 +38,12 @@ public:
     using SyntaxDumper::SyntaxDumper;
 
     void unparse(const SyntaxNode* node, std::ostream& os);
+    void unparse(const SyntaxNode* node, OutputSink& sink);
 
 protected:
     void terminal(const SyntaxToken& tk, const SyntaxNode* node) override;
 
-    std::ostream* os_;
+    OutputSink* sink_;
 };
 
 } // C
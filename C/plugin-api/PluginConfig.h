@@ -47,4 +47,14 @@
   #endif
 #endif
 
+/*
+ * The version of the plugin API, returned by a plugin's (exported)
+ * \c pluginApiVersion; a plugin that doesn't export it is of version 1.
+ *
+ * - 1: SourceInspector::detectRequiredHeaders(const std::string&).
+ * - 2: SourceInspector::detectRequiredHeaders(const std::string&, LanguageDialect::Std),
+ *      appended to the vtable; the entry point of version 1 is kept.
+ */
+#define PLUGIN_API_VERSION 2
+
 #endif
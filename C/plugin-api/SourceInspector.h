@@ -24,6 +24,8 @@
 #include "PluginConfig.h"
 #include "Fwds.h"
 
+#include "parser/LanguageDialect.h"
+
 #include <string>
 #include <vector>
 
@@ -35,7 +37,20 @@ class PLUGIN_API SourceInspector
 public:
     virtual ~SourceInspector() = default;
 
-    virtual std::vector<std::string> detectRequiredHeaders(const std::string&) = 0;
+    /*
+     * The entry point of version 1 of the plugin API: the standard is
+     * assumed to be C99. Override (at least) one of the overloads.
+     */
+    virtual std::vector<std::string> detectRequiredHeaders(const std::string& source)
+    {
+        return detectRequiredHeaders(source, LanguageDialect::Std::C99);
+    }
+
+    virtual std::vector<std::string> detectRequiredHeaders(const std::string& source,
+                                                           LanguageDialect::Std)
+    {
+        return detectRequiredHeaders(source);
+    }
 };
 
 } // C
@@ -294,6 +294,8 @@ SyntaxVisitor::Action Disambiguator::visitCastExpression(const CastExpressionSyn
 SyntaxVisitor::Action Disambiguator::visitCallExpression(const CallExpressionSyntax* node)
 {
     visitMaybeAmbiguousExpression(node->expr_);
+    for (auto argIt = node->args_; argIt; argIt = argIt->next)
+        visitMaybeAmbiguousExpression(argIt->value);
 
     return Action::Skip;
 }
@@ -0,0 +1,287 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CallGraph.h"
+
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+using namespace psy;
+using namespace C;
+
+struct CallGraph::CallGraphImpl
+{
+    CallGraphImpl(const ProgramSymbol* prog)
+        : prog_(prog)
+        , isCompact_(true)
+    {}
+
+    const ProgramSymbol* prog_;
+
+    struct TreeCalls
+    {
+        const SyntaxTree* tree_;
+        Functions funcs_;
+        std::vector<Call> calls_;
+        std::vector<UnresolvedCall> unresolvedCalls_;
+    };
+    std::vector<TreeCalls> callsByTree_;
+
+    /*
+     * The compact (CSR) form of the graph, rebuilt upon the first query after
+     * a change: the (indexes of the) callees of the function at index \c i are
+     * those within calleeIdxs_[calleeOffsets_[i], calleeOffsets_[i + 1]); and
+     * likewise for the callers.
+     */
+    std::vector<const FunctionDeclarationSymbol*> funcs_;
+    std::unordered_map<const FunctionDeclarationSymbol*, std::uint32_t> funcIdxs_;
+    std::vector<std::uint32_t> calleeOffsets_;
+    std::vector<std::uint32_t> calleeIdxs_;
+    std::vector<std::uint32_t> callerOffsets_;
+    std::vector<std::uint32_t> callerIdxs_;
+    std::vector<std::uint32_t> indirectCallCnts_;
+    std::vector<std::vector<std::string>> unresolvedCallees_;
+    bool isCompact_;
+    std::mutex mutex_;
+
+    const FunctionDeclarationSymbol* canonical(const FunctionDeclarationSymbol* func) const
+    {
+        if (func->linkage() != Linkage::External || !func->name())
+            return func;
+        auto name = func->name()->valueText();
+        auto def = prog_->externalDefinitionNamed(name);
+        if (def && def->asFunctionDeclaration())
+            return def->asFunctionDeclaration();
+        auto decls = prog_->externalDeclarationsNamed(name);
+        if (!decls.empty() && decls[0]->asFunctionDeclaration())
+            return decls[0]->asFunctionDeclaration();
+        return func;
+    }
+
+    std::uint32_t indexOf(const FunctionDeclarationSymbol* func)
+    {
+        auto it = funcIdxs_.find(func);
+        if (it != funcIdxs_.end())
+            return it->second;
+        auto canonFunc = canonical(func);
+        auto canonIt = funcIdxs_.find(canonFunc);
+        std::uint32_t idx;
+        if (canonIt != funcIdxs_.end())
+            idx = canonIt->second;
+        else {
+            idx = static_cast<std::uint32_t>(funcs_.size());
+            funcs_.push_back(canonFunc);
+            indirectCallCnts_.push_back(0);
+            unresolvedCallees_.emplace_back();
+            funcIdxs_.emplace(canonFunc, idx);
+        }
+        funcIdxs_.emplace(func, idx);
+        return idx;
+    }
+
+    bool lookUp(const FunctionDeclarationSymbol* func, std::uint32_t& idx) const
+    {
+        auto it = funcIdxs_.find(func);
+        if (it == funcIdxs_.end()) {
+            it = funcIdxs_.find(canonical(func));
+            if (it == funcIdxs_.end())
+                return false;
+        }
+        idx = it->second;
+        return true;
+    }
+
+    static void fillCSR(std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges,
+                        std::size_t funcCnt,
+                        std::vector<std::uint32_t>& offsets,
+                        std::vector<std::uint32_t>& idxs)
+    {
+        std::sort(edges.begin(), edges.end());
+        offsets.assign(funcCnt + 1, 0);
+        idxs.clear();
+        idxs.reserve(edges.size());
+        for (const auto& edge : edges) {
+            ++offsets[edge.first + 1];
+            idxs.push_back(edge.second);
+        }
+        for (std::size_t i = 0; i < funcCnt; ++i)
+            offsets[i + 1] += offsets[i];
+    }
+
+    void compact()
+    {
+        if (isCompact_)
+            return;
+
+        funcs_.clear();
+        funcIdxs_.clear();
+        indirectCallCnts_.clear();
+        unresolvedCallees_.clear();
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+        for (const auto& treeCalls : callsByTree_) {
+            for (auto func : treeCalls.funcs_)
+                indexOf(func);
+            for (const auto& call : treeCalls.calls_) {
+                auto callerIdx = indexOf(call.first);
+                if (call.second)
+                    edges.emplace_back(callerIdx, indexOf(call.second));
+                else
+                    ++indirectCallCnts_[callerIdx];
+            }
+            for (const auto& call : treeCalls.unresolvedCalls_)
+                unresolvedCallees_[indexOf(call.first)].push_back(call.second);
+        }
+        for (auto& names : unresolvedCallees_) {
+            std::sort(names.begin(), names.end());
+            names.erase(std::unique(names.begin(), names.end()), names.end());
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        fillCSR(edges, funcs_.size(), calleeOffsets_, calleeIdxs_);
+        for (auto& edge : edges)
+            std::swap(edge.first, edge.second);
+        fillCSR(edges, funcs_.size(), callerOffsets_, callerIdxs_);
+
+        isCompact_ = true;
+    }
+
+    Functions functionsAt(const std::vector<std::uint32_t>& offsets,
+                          const std::vector<std::uint32_t>& idxs,
+                          std::uint32_t idx) const
+    {
+        Functions funcs;
+        funcs.reserve(offsets[idx + 1] - offsets[idx]);
+        for (auto i = offsets[idx]; i < offsets[idx + 1]; ++i)
+            funcs.push_back(funcs_[idxs[i]]);
+        return funcs;
+    }
+};
+
+CallGraph::CallGraph(const ProgramSymbol* prog)
+    : P(new CallGraphImpl(prog))
+{}
+
+CallGraph::~CallGraph()
+{}
+
+CallGraph::Functions CallGraph::functions() const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    return P->funcs_;
+}
+
+CallGraph::Functions CallGraph::calleesOf(const FunctionDeclarationSymbol* func) const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    std::uint32_t idx;
+    if (!P->lookUp(func, idx))
+        return Functions();
+    return P->functionsAt(P->calleeOffsets_, P->calleeIdxs_, idx);
+}
+
+CallGraph::Functions CallGraph::callersOf(const FunctionDeclarationSymbol* func) const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    std::uint32_t idx;
+    if (!P->lookUp(func, idx))
+        return Functions();
+    return P->functionsAt(P->callerOffsets_, P->callerIdxs_, idx);
+}
+
+CallGraph::Functions CallGraph::transitiveCallersOf(const FunctionDeclarationSymbol* func) const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    std::uint32_t idx;
+    if (!P->lookUp(func, idx))
+        return Functions();
+
+    std::vector<bool> isVisited(P->funcs_.size(), false);
+    std::vector<std::uint32_t> queue { idx };
+    Functions funcs;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        auto calleeIdx = queue[head];
+        for (auto i = P->callerOffsets_[calleeIdx]; i < P->callerOffsets_[calleeIdx + 1]; ++i) {
+            auto callerIdx = P->callerIdxs_[i];
+            if (isVisited[callerIdx])
+                continue;
+            isVisited[callerIdx] = true;
+            queue.push_back(callerIdx);
+            funcs.push_back(P->funcs_[callerIdx]);
+        }
+    }
+    return funcs;
+}
+
+std::size_t CallGraph::indirectCallCountOf(const FunctionDeclarationSymbol* func) const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    std::uint32_t idx;
+    if (!P->lookUp(func, idx))
+        return 0;
+    return P->indirectCallCnts_[idx];
+}
+
+std::vector<std::string> CallGraph::unresolvedCalleesOf(const FunctionDeclarationSymbol* func) const
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->compact();
+    std::uint32_t idx;
+    if (!P->lookUp(func, idx))
+        return std::vector<std::string>();
+    return P->unresolvedCallees_[idx];
+}
+
+void CallGraph::addCalls(const SyntaxTree* tree,
+                         Functions funcs,
+                         std::vector<Call> calls,
+                         std::vector<UnresolvedCall> unresolvedCalls)
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->callsByTree_.push_back({ tree,
+                                std::move(funcs),
+                                std::move(calls),
+                                std::move(unresolvedCalls) });
+    P->isCompact_ = false;
+}
+
+void CallGraph::discardCalls(const SyntaxTree* tree)
+{
+    std::lock_guard<std::mutex> lock(P->mutex_);
+    P->callsByTree_.erase(
+            std::remove_if(P->callsByTree_.begin(),
+                           P->callsByTree_.end(),
+                           [tree] (const auto& treeCalls) {
+                               return treeCalls.tree_ == tree;
+                           }),
+            P->callsByTree_.end());
+    P->isCompact_ = false;
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_CALL_GRAPH_H__
+#define PSYCHE_C_CALL_GRAPH_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+#include "../common/infra/Pimpl.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The CallGraph class.
+ *
+ * The call graph of the SyntaxTrees of a Compilation: its nodes are the
+ * functions that are defined or called, and its edges go from each function
+ * to those it calls directly. A function with \a external \a linkage is a
+ * single node across SyntaxTrees, represented by its \a definition (or, if
+ * there's none, by its first declaration).
+ *
+ * Calls through expressions other than the name of a function (e.g., through
+ * a pointer to function) can't be resolved; they're counted, per caller, as
+ * \a indirect calls. Calls to names that aren't declared (i.e., to functions
+ * that are implicitly declared) aren't edges either; they're kept, per caller,
+ * as \a unresolved calls.
+ *
+ * The CallGraph is kept up to date as the SemanticModel of SyntaxTrees are
+ * computed and as SyntaxTrees are removed from the Compilation. Queries may
+ * be issued from multiple threads at once.
+ *
+ * \note Similar to:
+ * - \c clang::CallGraph of LLVM/Clang.
+ */
+class PSY_C_API CallGraph final
+{
+public:
+    ~CallGraph();
+
+    using Functions = std::vector<const FunctionDeclarationSymbol*>;
+
+    /**
+     * The functions of \c this CallGraph.
+     */
+    Functions functions() const;
+
+    /**
+     * The functions called directly by \p func.
+     */
+    Functions calleesOf(const FunctionDeclarationSymbol* func) const;
+
+    /**
+     * The functions that call \p func directly.
+     */
+    Functions callersOf(const FunctionDeclarationSymbol* func) const;
+
+    /**
+     * The functions that call \p func, directly or transitively (i.e., those
+     * affected by a change to \p func), in breadth-first order.
+     */
+    Functions transitiveCallersOf(const FunctionDeclarationSymbol* func) const;
+
+    /**
+     * The number of indirect calls made by \p func.
+     */
+    std::size_t indirectCallCountOf(const FunctionDeclarationSymbol* func) const;
+
+    /**
+     * The names, not declared, that \p func calls directly; in alphabetical order.
+     */
+    std::vector<std::string> unresolvedCalleesOf(const FunctionDeclarationSymbol* func) const;
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+    PSY_GRANT_INTERNAL_ACCESS(CallGraphBuilder);
+
+    CallGraph(const ProgramSymbol* prog);
+    CallGraph(const CallGraph&) = delete;
+    CallGraph& operator=(const CallGraph&) = delete;
+
+    /*
+     * A call from a caller to a callee; if the callee is null, the call is
+     * an indirect call.
+     */
+    using Call = std::pair<const FunctionDeclarationSymbol*, const FunctionDeclarationSymbol*>;
+
+    /*
+     * A call from a caller to a name that isn't declared.
+     */
+    using UnresolvedCall = std::pair<const FunctionDeclarationSymbol*, std::string>;
+
+    void addCalls(const SyntaxTree* tree,
+                  Functions funcs,
+                  std::vector<Call> calls,
+                  std::vector<UnresolvedCall> unresolvedCalls);
+    void discardCalls(const SyntaxTree* tree);
+
+private:
+    DECL_PIMPL(CallGraph)
+};
+
+} // C
+} // psy
+
+#endif
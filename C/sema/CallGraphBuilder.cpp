@@ -0,0 +1,137 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "CallGraphBuilder.h"
+
+#include "sema/Compilation.h"
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxUtilities.h"
+#include "syntax/SyntaxVisitor__MACROS__.inc"
+
+#include "../common/infra/Assertions.h"
+
+using namespace psy;
+using namespace C;
+
+CallGraphBuilder::CallGraphBuilder(SemanticModel* semaModel, const SyntaxTree* tree)
+    : SyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , caller_(nullptr)
+{}
+
+void CallGraphBuilder::buildCallGraph()
+{
+    visit(tree_->root());
+}
+
+SyntaxVisitor::Action CallGraphBuilder::visitTranslationUnit(const TranslationUnitSyntax* node)
+{
+    // A call to a function with internal linkage may precede its definition.
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next) {
+        if (declIt->value->kind() != SyntaxKind::FunctionDefinition)
+            continue;
+        auto func = semaModel_->functionFor(declIt->value->asFunctionDefinition());
+        if (func && func->name())
+            funcDefs_.emplace(func->name(), func);
+    }
+
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next)
+        VISIT(declIt->value);
+
+    auto& callGraph = const_cast<CallGraph&>(semaModel_->compilation()->callGraph());
+    callGraph.addCalls(tree_, std::move(funcs_), std::move(calls_), std::move(unresolvedCalls_));
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action CallGraphBuilder::visitFunctionDefinition(const FunctionDefinitionSyntax* node)
+{
+    auto func = semaModel_->functionFor(node);
+    PSY_ASSERT_2(func, return Action::Quit);
+    funcs_.push_back(func);
+
+    caller_ = func;
+    VISIT(node->body());
+    caller_ = nullptr;
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action CallGraphBuilder::visitCallExpression(const CallExpressionSyntax* node)
+{
+    if (!caller_)
+        return Action::Visit;
+
+    const Identifier* undeclName = nullptr;
+    auto callee = calleeOf(node->expression(), undeclName);
+    if (undeclName)
+        unresolvedCalls_.emplace_back(caller_, undeclName->valueText());
+    else
+        calls_.emplace_back(caller_, callee);
+
+    return Action::Visit;
+}
+
+const FunctionDeclarationSymbol* CallGraphBuilder::calleeOf(const ExpressionSyntax* node,
+                                                            const Identifier*& undeclName) const
+{
+    while (true) {
+        switch (node->kind()) {
+            case SyntaxKind::ParenthesizedExpression:
+                node = node->asParenthesizedExpression()->expression();
+                continue;
+            case SyntaxKind::AddressOfExpression:
+            case SyntaxKind::PointerIndirectionExpression:
+                node = node->asPrefixUnaryExpression()->expression();
+                continue;
+            default:
+                break;
+        }
+        break;
+    }
+
+    auto identNode = node->asIdentifierName();
+    if (!identNode)
+        return nullptr;
+    auto scope = semaModel_->scopeOf(identNode);
+    if (!scope)
+        return nullptr;
+    auto ident = identifierFrom(identNode);
+    auto decl = scope->searchForDeclaration(ident, NameSpace::OrdinaryIdentifiers);
+    if (!decl) {
+        undeclName = ident;
+        return nullptr;
+    }
+    if (!decl->asFunctionDeclaration())
+        return nullptr;
+
+    auto func = decl->asFunctionDeclaration();
+    if (func->linkage() == Linkage::Internal) {
+        auto it = funcDefs_.find(func->name());
+        if (it != funcDefs_.end())
+            return it->second;
+    }
+    return func;
+}
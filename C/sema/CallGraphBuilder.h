@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_CALL_GRAPH_BUILDER_H__
+#define PSYCHE_C_CALL_GRAPH_BUILDER_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "sema/CallGraph.h"
+#include "syntax/SyntaxVisitor.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The CallGraphBuilder class.
+ *
+ * Collects the functions defined in a SyntaxTree and the calls made by them
+ * into the CallGraph of the Compilation.
+ */
+class PSY_C_INTERNAL_API CallGraphBuilder final : protected SyntaxVisitor
+{
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+
+    CallGraphBuilder(SemanticModel* semaModel, const SyntaxTree* tree);
+    CallGraphBuilder(const CallGraphBuilder&) = delete;
+    void operator=(const CallGraphBuilder&) = delete;
+
+    void buildCallGraph();
+
+private:
+    SemanticModel* semaModel_;
+    std::unordered_map<const Identifier*, const FunctionDeclarationSymbol*> funcDefs_;
+    const FunctionDeclarationSymbol* caller_;
+    CallGraph::Functions funcs_;
+    std::vector<CallGraph::Call> calls_;
+    std::vector<CallGraph::UnresolvedCall> unresolvedCalls_;
+
+    const FunctionDeclarationSymbol* calleeOf(const ExpressionSyntax* node,
+                                              const Identifier*& undeclName) const;
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    virtual Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+
+    //-------------//
+    // Expressions //
+    //-------------//
+    virtual Action visitCallExpression(const CallExpressionSyntax*) override;
+};
+
+} // C
+} // psy
+
+#endif
@@ -22,17 +22,27 @@
 #include "Compilation.h"
 
 #include "SemanticModel.h"
+#include "SemanticModelSnapshot.h"
 #include "syntax/SyntaxTree.h"
 
+#include "sema/CallGraphBuilder.h"
 #include "sema/DeclarationBinder.h"
+#include "sema/LinkageResolver.h"
+#include "sema/ReferenceRecorder.h"
 #include "sema/TypeCanonicalizer.h"
+#include "sema/TypeLayoutCalculator.h"
 #include "sema/TypedefNameTypeResolver.h"
+#include "sema/UnusedDeclarationChecker.h"
 #include "symbols/Symbol_ALL.h"
 #include "types/Type_ALL.h"
 #include "sema/TypeChecker.h"
+#include "sema/TypeInferrer.h"
+
+#include "../common/infra/Instrumentation.h"
 
 #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 using namespace psy;
 using namespace C;
@@ -62,8 +72,32 @@ struct Compilation::CompilationImpl
         , tyBool_(new BasicType(BasicTypeKind::Bool))
         , tyErr_(new ErrorType())
         , prog_(new ProgramSymbol)
+        , callGraph_(new CallGraph(prog_.get()))
+        , prelude_(nullptr)
     {}
 
+    template <class FuncT>
+    void forEachDirtySemanticModel(const char* phase, FuncT func)
+    {
+        // The prelude goes first, given that the other SyntaxTrees depend on it.
+        if (prelude_ && isDirty_[prelude_])
+            runPhase(phase, func, semaModels_[prelude_].get(), prelude_);
+        for (const auto& p : semaModels_) {
+            if (p.first == prelude_ || !isDirty_[p.first])
+                continue;
+            runPhase(phase, func, p.second.get(), p.first);
+        }
+    }
+
+    template <class FuncT>
+    void runPhase(const char* phase, FuncT func, SemanticModel* semaModel, const SyntaxTree* tree)
+    {
+        PSY_INSTR_TIME(tree->filePath(), phase);
+        PSY_INSTR_DO(auto diagCnt = tree->diagnosticCount());
+        func(semaModel, tree);
+        PSY_INSTR_COUNT(tree->filePath(), phase, "diagnostics", tree->diagnosticCount() - diagCnt);
+    }
+
     Compilation* Q_;
     std::string id_;
     PlatformOptions platformOpts_;
@@ -89,7 +123,12 @@ struct Compilation::CompilationImpl
     std::unique_ptr<BasicType> tyBool_;
     std::unique_ptr<ErrorType> tyErr_;
     std::unique_ptr<ProgramSymbol> prog_;
+    std::unique_ptr<TypeLayoutCalculator> layoutCalc_;
+    SymbolIndex symIdx_;
+    std::unique_ptr<CallGraph> callGraph_;
+    const SyntaxTree* prelude_;
     std::unordered_map<const SyntaxTree*, bool> isDirty_;
+    std::unordered_set<const SyntaxTree*> isUnlinkedAndUnindexed_;
     std::unordered_map<const SyntaxTree*, std::unique_ptr<SemanticModel>> semaModels_;
 };
 
@@ -117,6 +156,8 @@ std::unique_ptr<Compilation> Compilation::create(
     compilation->P->id_ = id;
     compilation->P->platformOpts_ = platformOpts;
     compilation->P->inferOpts_ = inferOpts;
+    compilation->P->layoutCalc_.reset(
+                new TypeLayoutCalculator(compilation->P->platformOpts_));
     return compilation;
 }
 
@@ -140,6 +181,16 @@ const ProgramSymbol* Compilation::program() const
     return P->prog_.get();
 }
 
+const SymbolIndex& Compilation::symbolIndex() const
+{
+    return P->symIdx_;
+}
+
+const CallGraph& Compilation::callGraph() const
+{
+    return *P->callGraph_;
+}
+
 ProgramSymbol* Compilation::program()
 {
     return P->prog_.get();
@@ -166,9 +217,38 @@ void Compilation::addSyntaxTrees(std::vector<const SyntaxTree*> trees)
         addSyntaxTree(tree);
 }
 
+void Compilation::removeSyntaxTree(const SyntaxTree* tree)
+{
+    PSY_ASSERT_2(tree != P->prelude_, return);
+    auto it = P->semaModels_.find(tree);
+    if (it == P->semaModels_.end())
+        return;
+
+    P->symIdx_.discardDeclarations(tree);
+    P->prog_->discardDeclarations(tree);
+    P->callGraph_->discardCalls(tree);
+    P->semaModels_.erase(it);
+    P->isDirty_.erase(tree);
+    P->isUnlinkedAndUnindexed_.erase(tree);
+    P->layoutCalc_->discardLayouts();
+    tree->detachCompilation(this);
+}
+
+void Compilation::setPreludeSyntaxTree(const SyntaxTree* tree)
+{
+    PSY_ASSERT_2(P->semaModels_.count(tree), return);
+    P->prelude_ = tree;
+}
+
+const SyntaxTree* Compilation::preludeSyntaxTree() const
+{
+    return P->prelude_;
+}
+
 std::vector<const SyntaxTree*> Compilation::syntaxTrees() const
 {
-    std::vector<const SyntaxTree*> trees(P->semaModels_.size());
+    std::vector<const SyntaxTree*> trees;
+    trees.reserve(P->semaModels_.size());
     std::transform(P->semaModels_.begin(),
                    P->semaModels_.end(),
                    std::back_inserter(trees),
@@ -180,13 +260,58 @@ const SemanticModel* Compilation::computeSemanticModel(const SyntaxTree* tree) c
 {
     PSY_ASSERT_2(P->isDirty_.count(tree), return nullptr);
     if (P->isDirty_[tree]) {
+        P->layoutCalc_->discardLayouts();
         bindDeclarations();
         canonicalizerTypes();
         resolveTypedefNameTypes();
         checkTypes();
-        P->isDirty_[tree] = false;
+        if (P->inferOpts_.isEnabled_DeclarationAndTypeInference())
+            inferTypes();
+        resolveLinkages();
+        checkUnusedDeclarations();
+        buildCallGraph();
+        indexDeclarations();
+        for (auto& p : P->isDirty_)
+            p.second = false;
     }
-    return semanticModel(tree);
+    auto semaModel = P->semaModels_[tree].get();
+    if (!semaModel->restoreFromSnapshot()) {
+        // The snapshot is malformed: compute the SemanticModel instead.
+        P->semaModels_[tree].reset(new SemanticModel(tree, const_cast<Compilation*>(this)));
+        P->isDirty_[tree] = true;
+        P->isUnlinkedAndUnindexed_.erase(tree);
+        return computeSemanticModel(tree);
+    }
+    if (P->isUnlinkedAndUnindexed_.erase(tree)) {
+        LinkageResolver resolver(semaModel, tree);
+        resolver.resolveLinkages();
+        CallGraphBuilder builder(semaModel, tree);
+        builder.buildCallGraph();
+        P->symIdx_.indexDeclarations(semaModel);
+    }
+    return semaModel;
+}
+
+std::string Compilation::snapshotSemanticModel(const SyntaxTree* tree) const
+{
+    auto semaModel = computeSemanticModel(tree);
+    PSY_ASSERT_2(semaModel, return "");
+    return SemanticModelSnapshot::take(semaModel);
+}
+
+bool Compilation::restoreSemanticModel(const SyntaxTree* tree, std::string snapshot)
+{
+    PSY_ASSERT_2(P->isDirty_.count(tree), return false);
+    if (!P->isDirty_[tree])
+        return false;
+
+    auto openSnapshot = SemanticModelSnapshot::open(tree, std::move(snapshot));
+    if (!openSnapshot)
+        return false;
+    P->semaModels_[tree]->attachSnapshot(std::move(openSnapshot));
+    P->isDirty_[tree] = false;
+    P->isUnlinkedAndUnindexed_.insert(tree);
+    return true;
 }
 
 const VoidType* Compilation::canonicalVoidType() const
@@ -199,6 +324,18 @@ const ErrorType* Compilation::canonicalErrorType() const
     return P->tyErr_.get();
 }
 
+TypeLayout Compilation::layoutOf(const Type* ty) const
+{
+    PSY_ASSERT_2(ty, return TypeLayout());
+    return P->layoutCalc_->layoutOf(ty);
+}
+
+FieldLayout Compilation::layoutOf(const FieldDeclarationSymbol* fld) const
+{
+    PSY_ASSERT_2(fld, return FieldLayout());
+    return P->layoutCalc_->layoutOf(fld);
+}
+
 const BasicType* Compilation::canonicalBasicType(BasicTypeKind basicTyK) const
 {
     switch (basicTyK) {
@@ -245,35 +382,90 @@ const BasicType* Compilation::canonicalBasicType(BasicTypeKind basicTyK) const
 
 void Compilation::bindDeclarations() const
 {
-    for (const auto& p : P->semaModels_) {
-        DeclarationBinder binder(p.second.get(), p.first);
+    P->forEachDirtySemanticModel("bind", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        DeclarationBinder binder(semaModel, tree);
         binder.bindDeclarations();
-    }
+    });
 }
 
 void Compilation::canonicalizerTypes() const
 {
-    for (const auto& p : P->semaModels_) {
-        TypeCanonicalizer canonicalizer(p.second.get(), p.first);
+    P->forEachDirtySemanticModel("canonicalize", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        TypeCanonicalizer canonicalizer(semaModel, tree);
         canonicalizer.canonicalizeTypes();
-    }
+    });
 }
 
 
 void Compilation::resolveTypedefNameTypes() const
 {
-    for (const auto& p : P->semaModels_) {
-        TypedefNameTypeResolver resolver(p.second.get(), p.first);
+    P->forEachDirtySemanticModel("resolve", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        TypedefNameTypeResolver resolver(semaModel, tree);
         resolver.resolveTypedefNameTypes();
-    }
+    });
 }
 
 void Compilation::checkTypes() const
 {
-    for (const auto& p : P->semaModels_) {
-        TypeChecker checker(p.second.get(), p.first);
+    P->forEachDirtySemanticModel("check", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        TypeChecker checker(semaModel, tree);
         checker.checkTypes();
+        ReferenceRecorder recorder(semaModel, tree);
+        recorder.recordReferences();
+    });
+}
+
+void Compilation::inferTypes() const
+{
+    P->forEachDirtySemanticModel("infer", [this] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        if (tree == P->prelude_)
+            return;
+        TypeInferrer inferrer(semaModel, tree);
+        inferrer.inferTypes();
+    });
+}
+
+void Compilation::resolveLinkages() const
+{
+    // The (stale) external declarations of every SyntaxTree that's been
+    // rebound must be discarded before any of them is linked.
+    for (const auto& p : P->isDirty_) {
+        if (p.second)
+            P->prog_->discardDeclarations(p.first);
     }
+    P->forEachDirtySemanticModel("link", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        LinkageResolver resolver(semaModel, tree);
+        resolver.resolveLinkages();
+    });
+}
+
+void Compilation::checkUnusedDeclarations() const
+{
+    P->forEachDirtySemanticModel("unused", [this] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        if (tree == P->prelude_)
+            return;
+        UnusedDeclarationChecker checker(semaModel, tree);
+        checker.checkUnusedDeclarations();
+    });
+}
+
+void Compilation::buildCallGraph() const
+{
+    for (const auto& p : P->isDirty_) {
+        if (p.second)
+            P->callGraph_->discardCalls(p.first);
+    }
+    P->forEachDirtySemanticModel("call-graph", [] (SemanticModel* semaModel, const SyntaxTree* tree) {
+        CallGraphBuilder builder(semaModel, tree);
+        builder.buildCallGraph();
+    });
+}
+
+void Compilation::indexDeclarations() const
+{
+    P->forEachDirtySemanticModel("index", [this] (SemanticModel* semaModel, const SyntaxTree*) {
+        P->symIdx_.indexDeclarations(semaModel);
+    });
 }
 
 const SemanticModel* Compilation::semanticModel(const SyntaxTree* tree) const
@@ -281,3 +473,10 @@ const SemanticModel* Compilation::semanticModel(const SyntaxTree* tree) const
     PSY_ASSERT_2(P->semaModels_.count(tree), return nullptr);
     return P->semaModels_[tree].get();
 }
+
+SemanticModel* Compilation::preludeSemanticModel(const SyntaxTree* tree) const
+{
+    if (!P->prelude_ || P->prelude_ == tree)
+        return nullptr;
+    return P->semaModels_[P->prelude_].get();
+}
@@ -27,8 +27,12 @@
 #include "syntax/SyntaxTree.h"
 
 #include "types/TypeKind_Basic.h"
+#include "sema/CallGraph.h"
+#include "sema/FieldLayout.h"
 #include "sema/InferenceOptions.h"
 #include "sema/PlatformOptions.h"
+#include "sema/SymbolIndex.h"
+#include "sema/TypeLayout.h"
 
 #include "../common/infra/AccessSpecifiers.h"
 #include "../common/infra/Pimpl.h"
@@ -87,6 +91,33 @@ public:
      */
     void addSyntaxTrees(std::vector<const SyntaxTree*> trees);
 
+    /**
+     * Remove SyntaxTree \p tree from \c this Compilation.
+     *
+     * \attention The prelude SyntaxTree may not be removed.
+     */
+    void removeSyntaxTree(const SyntaxTree* tree);
+
+    /**
+     * Set SyntaxTree \p tree, which must have been added to \c this
+     * Compilation, as the prelude of \c this Compilation. The declarations
+     * at file scope of the prelude SyntaxTree are visible in every other
+     * SyntaxTree of \c this Compilation, as if its text preceded theirs;
+     * yet, the SemanticModel of the prelude SyntaxTree is computed only once.
+     *
+     * \remark Typically, the prelude SyntaxTree comprises the text of
+     * system headers that'd otherwise be repeated in every SyntaxTree.
+     *
+     * \attention The prelude must be set before the SemanticModel of any
+     * other SyntaxTree of \c this Compilation is computed.
+     */
+    void setPreludeSyntaxTree(const SyntaxTree* tree);
+
+    /**
+     * The prelude SyntaxTree of \c this Compilation, if any.
+     */
+    const SyntaxTree* preludeSyntaxTree() const;
+
     /**
      * The SyntaxTrees in \c this Compilation.
      */
@@ -100,11 +131,54 @@ public:
      */
     const SemanticModel* computeSemanticModel(const SyntaxTree* tree) const;
 
+    /**
+     * Take a snapshot of the SemanticModel of the given \p tree SyntaxTree.
+     *
+     * The SemanticModel is computed, if it isn't already.
+     *
+     * \sa restoreSemanticModel
+     */
+    std::string snapshotSemanticModel(const SyntaxTree* tree) const;
+
+    /**
+     * Restore the SemanticModel of the given \p tree SyntaxTree from \p snapshot,
+     * instead of computing it. The restoration happens on demand: declarations
+     * (and types) upon computeSemanticModel, the TypeInfo and Scope of nodes
+     * upon the first request of either.
+     *
+     * The snapshot must have been taken (with snapshotSemanticModel) from a
+     * SyntaxTree of the same text, and the \p tree SyntaxTree must not have
+     * had its SemanticModel computed yet; otherwise, \c false is returned.
+     * A snapshot found to be malformed once restored is discarded, and the
+     * SemanticModel is computed instead.
+     *
+     * \remark Diagnostics of the semantic analysis aren't restored.
+     */
+    bool restoreSemanticModel(const SyntaxTree* tree, std::string snapshot);
+
     /**
      * The Program in \c this Compilation.
      */
     const ProgramSymbol* program() const;
 
+    /**
+     * The SymbolIndex of \c this Compilation.
+     *
+     * The declarations of a SyntaxTree are indexed once its SemanticModel is
+     * computed (or, if restored from a snapshot, once it's first requested
+     * with computeSemanticModel).
+     */
+    const SymbolIndex& symbolIndex() const;
+
+    /**
+     * The CallGraph of \c this Compilation.
+     *
+     * The calls of a SyntaxTree are collected once its SemanticModel is
+     * computed (or, if restored from a snapshot, once it's first requested
+     * with computeSemanticModel).
+     */
+    const CallGraph& callGraph() const;
+
     /**
      * The canonical BasicType of \c basicTyK BasicTypeKind.
      */
@@ -120,16 +194,38 @@ public:
      */
     const ErrorType* canonicalErrorType() const;
 
+    /**
+     * The TypeLayout of the given \p ty Type, as of the PlatformOptions of
+     * \c this Compilation.
+     *
+     * The layout of a structure or union is calculated once and cached;
+     * the cache is discarded when SyntaxTrees are added or removed.
+     */
+    TypeLayout layoutOf(const Type* ty) const;
+
+    /**
+     * The FieldLayout of the given \p fld FieldDeclarationSymbol, as of the
+     * PlatformOptions of \c this Compilation.
+     */
+    FieldLayout layoutOf(const FieldDeclarationSymbol* fld) const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
 
     ProgramSymbol* program();
 
     const SemanticModel* semanticModel(const SyntaxTree* tree) const;
+    SemanticModel* preludeSemanticModel(const SyntaxTree* tree) const;
     void bindDeclarations() const;
     void canonicalizerTypes() const;
     void resolveTypedefNameTypes() const;
     void checkTypes() const;
+    void inferTypes() const;
+    void resolveLinkages() const;
+    void checkUnusedDeclarations() const;
+    void buildCallGraph() const;
+    void indexDeclarations() const;
 
 private:
     DECL_PIMPL(Compilation);
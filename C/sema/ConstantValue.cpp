@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ConstantValue.h"
+
+#include <iostream>
+
+using namespace psy;
+using namespace C;
+
+ConstantValue::ConstantValue()
+    : bits_(0)
+    , basicTyK_(BasicTypeKind::Int_S)
+    , known_(false)
+{}
+
+ConstantValue::ConstantValue(unsigned long long bits, BasicTypeKind basicTyK)
+    : bits_(bits)
+    , basicTyK_(basicTyK)
+    , known_(true)
+{}
+
+ConstantValue::~ConstantValue()
+{}
+
+bool ConstantValue::isKnown() const
+{
+    return known_;
+}
+
+BasicTypeKind ConstantValue::basicTypeKind() const
+{
+    return basicTyK_;
+}
+
+bool ConstantValue::isZero() const
+{
+    return known_ && bits_ == 0;
+}
+
+long long ConstantValue::asSigned() const
+{
+    return static_cast<long long>(bits_);
+}
+
+unsigned long long ConstantValue::asUnsigned() const
+{
+    return bits_;
+}
+
+namespace psy {
+namespace C {
+
+std::ostream& operator<<(std::ostream& os, const ConstantValue& val)
+{
+    if (!val.isKnown())
+        return os << "<ConstantValue is unknown>";
+    os << "<ConstantValue | ";
+    if (isUnsignedIntegerTypeKind(val.basicTypeKind()))
+        os << val.asUnsigned();
+    else
+        os << val.asSigned();
+    os << " type:" << val.basicTypeKind() << ">";
+    return os;
+}
+
+} // C
+} // psy
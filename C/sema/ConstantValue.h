@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_CONSTANT_VALUE_H__
+#define PSYCHE_C_CONSTANT_VALUE_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "types/TypeKind_Basic.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The ConstantValue class.
+ *
+ * The value of an <em>integer constant expression</em>.
+ *
+ * \remark 6.6-6
+ */
+class PSY_C_API ConstantValue final
+{
+public:
+    /**
+     * Create an unknown ConstantValue.
+     */
+    ConstantValue();
+    ~ConstantValue();
+
+    /**
+     * Whether \c this ConstantValue is known.
+     */
+    bool isKnown() const;
+
+    /**
+     * The BasicTypeKind of \c this ConstantValue.
+     *
+     * \remark The result is meaningful only if \c this ConstantValue is known.
+     */
+    BasicTypeKind basicTypeKind() const;
+
+    /**
+     * Whether \c this ConstantValue is zero.
+     */
+    bool isZero() const;
+
+    //!@{
+    /**
+     * The value of \c this ConstantValue, as a signed or unsigned integer.
+     *
+     * \remark A value of a signed type is held sign-extended; the value
+     * is represented in the width of its type, as of the PlatformOptions
+     * of the Compilation.
+     */
+    long long asSigned() const;
+    unsigned long long asUnsigned() const;
+    //!@}
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
+
+    ConstantValue(unsigned long long bits, BasicTypeKind basicTyK);
+
+private:
+    unsigned long long bits_;
+    BasicTypeKind basicTyK_;
+    bool known_;
+};
+
+PSY_C_API std::ostream& operator<<(std::ostream& os, const ConstantValue& val);
+
+} // C
+} // psy
+
+#endif
@@ -187,6 +187,16 @@ SyntaxVisitor::Action DeclarationBinder::visitTranslationUnit(const TranslationU
     unit_ = semaModel_->setTranslationUnit(std::move(unit));
 
     pushNewScope(node, ScopeKind::File, false);
+    auto prelude = semaModel_->compilation()->preludeSemanticModel(tree_);
+    if (prelude && prelude->fileScope()) {
+        prelude->fileScope()->encloseScopeOfOtherSyntaxTree(scopes_.top());
+        semaModel_->set_ptrdiff_t_typedef(prelude->ptrdiff_t_typedef());
+        semaModel_->set_size_t_typedef(prelude->size_t_typedef());
+        semaModel_->set_max_align_t_typedef(prelude->max_align_t_typedef());
+        semaModel_->set_wchar_t_typedef(prelude->wchar_t_typedef());
+        semaModel_->set_char16_t_typedef(prelude->char16_t_typedef());
+        semaModel_->set_char32_t_typedef(prelude->char32_t_typedef());
+    }
     VISIT(node->declarations());
     PSY_ASSERT_2(scopes_.size() == 1, return Action::Quit);
     PSY_ASSERT_2(scopes_.top()->kind() == ScopeKind::File, return Action::Quit);
@@ -238,8 +248,10 @@ SyntaxVisitor::Action DeclarationBinder::visitParameterDeclaration(const Paramet
     return visitParameterDeclaration_AtSpecifiers(node);
 }
 
-SyntaxVisitor::Action DeclarationBinder::visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*)
+SyntaxVisitor::Action DeclarationBinder::visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax* node)
 {
+    VISIT(node->expression());
+
     return Action::Skip;
 }
 
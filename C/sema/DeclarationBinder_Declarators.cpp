@@ -185,6 +185,13 @@ SyntaxVisitor::Action DeclarationBinder::visitBitfieldDeclarator(
     else
         bindAnonymousFieldDeclaration(node);
 
+    auto decl = semaModel_->declarationBy(node);
+    PSY_ASSERT_2(decl && decl->kind() == SymbolKind::FieldDeclaration,
+                 return Action::Quit);
+    // The width is a constant expression, evaluated by the TypeChecker.
+    decl->asFieldDeclaration()->setBitWidth(ConstantValue());
+    VISIT(node->expression());
+
     return Action::Skip;
 }
 
@@ -244,7 +251,13 @@ SyntaxVisitor::Action DeclarationBinder::visitArrayOrFunctionDeclarator(const Ar
     switch (node->suffix()->kind()) {
         case SyntaxKind::SubscriptSuffix: {
             TY_AT_TOP(auto ty, Action::Quit);
-            pushType(makeType<ArrayType>(ty));
+            VISIT(node->suffix());
+            auto arrTy = makeType<ArrayType>(ty);
+            auto subscript = node->suffix()->asSubscriptSuffix();
+            if (!subscript->expression() && !subscript->asteriskToken().isValid())
+                arrTy->setUnspecifiedSize();
+            semaModel_->setArrayTypeOf(subscript, arrTy);
+            pushType(arrTy);
             VISIT(node->innerDeclarator());
             VISIT(node->attributes_PostDeclarator());
             VISIT(node->initializer());
@@ -299,6 +312,8 @@ SyntaxVisitor::Action DeclarationBinder::visitArrayOrFunctionDeclarator(const Ar
 
 SyntaxVisitor::Action DeclarationBinder::visitSubscriptSuffix(const SubscriptSuffixSyntax* node)
 {
+    VISIT(node->expression());
+
     return Action::Skip;
 }
 
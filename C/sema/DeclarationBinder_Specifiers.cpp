@@ -147,6 +147,7 @@ SyntaxVisitor::Action DeclarationBinder::visitFieldDeclaration_AtSpecifiers(cons
 SyntaxVisitor::Action DeclarationBinder::visitEnumeratorDeclaration_AtImplicitSpecifier(
         const EnumeratorDeclarationSyntax* node)
 {
+    VISIT(node->expression());
     pushType(makeType<BasicType>(BasicTypeKind::Int_S));
     return visitEnumeratorDeclaration_AtDeclaratorLike(node);
 }
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "LinkageResolver.h"
+
+#include "syntax/SyntaxTree.h"
+
+using namespace psy;
+using namespace C;
+
+const std::string LinkageResolver::DiagnosticsReporter::ID_of_IncompatibleExternalDeclaration = "LinkageResolver-100-6.2.7-2";
+const std::string LinkageResolver::DiagnosticsReporter::ID_of_MultipleExternalDefinitions = "LinkageResolver-200-6.9-5";
+
+void LinkageResolver::DiagnosticsReporter::diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk)
+{
+    resolver_->tree_->newDiagnostic(desc, tk);
+};
+
+void LinkageResolver::DiagnosticsReporter::IncompatibleExternalDeclaration(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(
+                 ID_of_IncompatibleExternalDeclaration,
+                 "[[incompatible external declaration]]",
+                 "declaration is incompatible with that of another translation unit",
+                 DiagnosticSeverity::Error,
+                 DiagnosticCategory::Binding),
+             tk);
+}
+
+void LinkageResolver::DiagnosticsReporter::MultipleExternalDefinitions(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(
+                 ID_of_MultipleExternalDefinitions,
+                 "[[multiple external definitions]]",
+                 "redefinition of identifier defined in another translation unit",
+                 DiagnosticSeverity::Error,
+                 DiagnosticCategory::Binding),
+             tk);
+}
@@ -44,6 +44,7 @@ const std::string TypeChecker::DiagnosticsReporter::ID_of_CannotAssignToExpressi
 const std::string TypeChecker::DiagnosticsReporter::ID_of_ConversionBetweenIntegerAndPointerTypesInAssignment = "TypeChecker-016";
 const std::string TypeChecker::DiagnosticsReporter::ID_of_TooFewArgumentsToFunctionCall = "TypeChecker-017";
 const std::string TypeChecker::DiagnosticsReporter::ID_of_TooManyArgumentsToFunctionCall = "TypeChecker-018";
+const std::string TypeChecker::DiagnosticsReporter::ID_of_StaticAssertionFailed = "TypeChecker-019";
 
 void TypeChecker::DiagnosticsReporter::diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk)
 {
@@ -248,3 +249,14 @@ void TypeChecker::DiagnosticsReporter::TooManyArgumentsToFunctionCall(SyntaxToke
                  DiagnosticCategory::TypeChecking),
              tk);
 }
+
+void TypeChecker::DiagnosticsReporter::StaticAssertionFailed(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(
+                 ID_of_StaticAssertionFailed,
+                 "[[static assertion failed]]",
+                 "static assertion failed",
+                 DiagnosticSeverity::Error,
+                 DiagnosticCategory::TypeChecking),
+             tk);
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "UnusedDeclarationChecker.h"
+
+#include "syntax/SyntaxTree.h"
+
+using namespace psy;
+using namespace C;
+
+const std::string UnusedDeclarationChecker::DiagnosticsReporter::ID_of_UnusedLocalVariable = "UnusedDeclarationChecker-000";
+const std::string UnusedDeclarationChecker::DiagnosticsReporter::ID_of_UnusedStaticDeclaration = "UnusedDeclarationChecker-001";
+
+void UnusedDeclarationChecker::DiagnosticsReporter::diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk)
+{
+    checker_->tree_->newDiagnostic(desc, tk);
+};
+
+void UnusedDeclarationChecker::DiagnosticsReporter::UnusedLocalVariable(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(
+                 ID_of_UnusedLocalVariable,
+                 "[[unused local variable]]",
+                 "variable is declared but never referenced",
+                 DiagnosticSeverity::Warning,
+                 DiagnosticCategory::Binding),
+             tk);
+}
+
+void UnusedDeclarationChecker::DiagnosticsReporter::UnusedStaticDeclaration(SyntaxToken tk)
+{
+    diagnose(DiagnosticDescriptor(
+                 ID_of_UnusedStaticDeclaration,
+                 "[[unused static declaration]]",
+                 "identifier with internal linkage is defined but never referenced",
+                 DiagnosticSeverity::Warning,
+                 DiagnosticCategory::Binding),
+             tk);
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "FieldLayout.h"
+
+using namespace psy;
+using namespace C;
+
+FieldLayout::FieldLayout()
+    : bitOffset_(0)
+    , known_(false)
+{}
+
+FieldLayout::FieldLayout(unsigned long long bitOffset)
+    : bitOffset_(bitOffset)
+    , known_(true)
+{}
+
+FieldLayout::~FieldLayout()
+{}
+
+bool FieldLayout::isKnown() const
+{
+    return known_;
+}
+
+unsigned long long FieldLayout::offset() const
+{
+    return bitOffset_ / 8;
+}
+
+unsigned long long FieldLayout::offsetInBits() const
+{
+    return bitOffset_;
+}
+
+namespace psy {
+namespace C {
+
+std::ostream& operator<<(std::ostream& os, const FieldLayout& fldLayout)
+{
+    if (!fldLayout.isKnown())
+        return os << "<FieldLayout is unknown>";
+    os << "<FieldLayout |";
+    os << " offset:" << fldLayout.offset();
+    if (fldLayout.offsetInBits() % 8)
+        os << " bit-offset:" << fldLayout.offsetInBits();
+    os << ">";
+    return os;
+}
+
+} // C
+} // psy
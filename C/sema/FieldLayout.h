@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_FIELD_LAYOUT_H__
+#define PSYCHE_C_FIELD_LAYOUT_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <ostream>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The FieldLayout class.
+ *
+ * The offset of a field within the structure or union that contains it,
+ * as of the PlatformOptions of a Compilation.
+ *
+ * \remark 6.7.2.1-15 and 6.7.2.1-16
+ *
+ * \attention The offset of a field of an anonymous structure or union is
+ * relative to the anonymous structure or union, which is itself a field.
+ */
+class PSY_C_API FieldLayout final
+{
+public:
+    /**
+     * Create a FieldLayout of unknown offset.
+     */
+    FieldLayout();
+    ~FieldLayout();
+
+    /**
+     * Whether the offset of \c this FieldLayout is known.
+     */
+    bool isKnown() const;
+
+    /**
+     * The offset, in bytes, of \c this FieldLayout.
+     *
+     * \remark For a \a bit-field, it's the offset of the byte that holds
+     * its first bit.
+     */
+    unsigned long long offset() const;
+
+    /**
+     * The offset, in bits, of \c this FieldLayout.
+     */
+    unsigned long long offsetInBits() const;
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(TypeLayoutCalculator);
+
+    explicit FieldLayout(unsigned long long bitOffset);
+
+private:
+    unsigned long long bitOffset_;
+    bool known_;
+};
+
+PSY_C_API std::ostream& operator<<(std::ostream& os, const FieldLayout& fldLayout);
+
+} // C
+} // psy
+
+#endif
@@ -0,0 +1,397 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "LinkageResolver.h"
+
+#include "sema/Compilation.h"
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxUtilities.h"
+#include "syntax/SyntaxVisitor__MACROS__.inc"
+#include "types/Type_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <algorithm>
+
+using namespace psy;
+using namespace C;
+
+LinkageResolver::LinkageResolver(SemanticModel* semaModel, const SyntaxTree* tree)
+    : SyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , prog_(const_cast<ProgramSymbol*>(semaModel->compilation()->program()))
+    , diagReporter_(this)
+{}
+
+void LinkageResolver::resolveLinkages()
+{
+    visit(tree_->root());
+}
+
+namespace {
+
+SyntaxKind storageClassOf(const SpecifierListSyntax* specs)
+{
+    for (auto specIt = specs; specIt; specIt = specIt->next) {
+        switch (specIt->value->kind()) {
+            case SyntaxKind::ExternStorageClass:
+            case SyntaxKind::StaticStorageClass:
+                return specIt->value->kind();
+            default:
+                break;
+        }
+    }
+    return SyntaxKind::UnknownSyntax;
+}
+
+const InitializerSyntax* initializerOf(const DeclaratorSyntax* decltor)
+{
+    switch (decltor->kind()) {
+        case SyntaxKind::IdentifierDeclarator:
+            return decltor->asIdentifierDeclarator()->initializer();
+        case SyntaxKind::PointerDeclarator:
+            return decltor->asPointerDeclarator()->initializer();
+        case SyntaxKind::ArrayDeclarator:
+        case SyntaxKind::FunctionDeclarator:
+            return decltor->asArrayOrFunctionDeclarator()->initializer();
+        default:
+            return nullptr;
+    }
+}
+
+const Type* typeOf(const DeclarationSymbol* decl)
+{
+    if (decl->asFunctionDeclaration())
+        return decl->asFunctionDeclaration()->type();
+    return decl->asObjectDeclaration()->type();
+}
+
+const Type* unaliased(const Type* ty)
+{
+    while (ty && ty->kind() == TypeKind::TypedefName)
+        ty = ty->asTypedefNameType()->resolvedSynonymizedType();
+    return ty;
+}
+
+const Type* unqualified(const Type* ty)
+{
+    ty = unaliased(ty);
+    if (ty && ty->kind() == TypeKind::Qualified)
+        return unaliased(ty->asQualifiedType()->unqualifiedType());
+    return ty;
+}
+
+} // anonymous
+
+SyntaxVisitor::Action LinkageResolver::visitTranslationUnit(const TranslationUnitSyntax* node)
+{
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next)
+        visit(declIt->value);
+
+    for (auto decl : semaModel_->declarations()) {
+        auto tagDecl = decl->asTagTypeDeclaration();
+        if (!tagDecl
+                || tagDecl->enclosingScope()->kind() != ScopeKind::File
+                || tagDecl->introducedNewType()->isUntagged()) {
+            continue;
+        }
+        linkTagDeclaration(tagDecl);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action LinkageResolver::visitVariableAndOrFunctionDeclaration(
+        const VariableAndOrFunctionDeclarationSyntax* node)
+{
+    for (auto decltorIt = node->declarators(); decltorIt; decltorIt = decltorIt->next) {
+        auto decl = semaModel_->declarationBy(decltorIt->value);
+        if (!decl)
+            continue;
+        link(decl,
+             decltorIt->value,
+             node->specifiers(),
+             initializerOf(decltorIt->value)
+                ? ProgramSymbol::DefinitionKind::Full
+                : ProgramSymbol::DefinitionKind::None);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action LinkageResolver::visitFunctionDefinition(
+        const FunctionDefinitionSyntax* node)
+{
+    auto func = semaModel_->functionFor(node);
+    PSY_ASSERT_2(func, return Action::Quit);
+    link(const_cast<FunctionDeclarationSymbol*>(func),
+         node->declarator(),
+         node->specifiers(),
+         ProgramSymbol::DefinitionKind::Full);
+
+    // Declarations within the body may have linkage too.
+    VISIT(node->body());
+
+    return Action::Skip;
+}
+
+void LinkageResolver::link(
+        DeclarationSymbol* decl,
+        const DeclaratorSyntax* decltor,
+        const SpecifierListSyntax* specs,
+        ProgramSymbol::DefinitionKind defK)
+{
+    if (!decl->asFunctionDeclaration() && !decl->asVariableDeclaration())
+        return;
+
+    auto name = decl->denotingIdentifier();
+    auto atFileScope = decl->enclosingScope()->kind() == ScopeKind::File;
+    auto storageClassK = storageClassOf(specs);
+    Linkage linkage;
+    if (atFileScope && storageClassK == SyntaxKind::StaticStorageClass)
+        linkage = Linkage::Internal;
+    else if (storageClassK == SyntaxKind::ExternStorageClass || decl->asFunctionDeclaration()) {
+        auto it = fileScopeLinkages_.find(name);
+        linkage = it != fileScopeLinkages_.end() && it->second != Linkage::None
+                ? it->second
+                : Linkage::External;
+    }
+    else if (atFileScope)
+        linkage = Linkage::External;
+    else
+        linkage = Linkage::None;
+    decl->setLinkage(linkage);
+    if (atFileScope)
+        fileScopeLinkages_.emplace(name, linkage);
+
+    if (linkage != Linkage::External)
+        return;
+
+    if (defK == ProgramSymbol::DefinitionKind::None
+            && atFileScope
+            && storageClassK != SyntaxKind::ExternStorageClass
+            && decl->asVariableDeclaration()) {
+        defK = ProgramSymbol::DefinitionKind::Tentative;
+    }
+
+    auto nameText = name->valueText();
+    if (auto externDecls = prog_->externalDeclarations(nameText)) {
+        auto tk = SyntaxUtilities::innermostDeclaratorOf(decltor)->firstToken();
+        for (const auto& externDecl : *externDecls) {
+            if (externDecl.tree_ == tree_)
+                continue;
+            TypePairs assumed;
+            if (!typesAreCompatible(typeOf(externDecl.decl_), typeOf(decl), assumed)) {
+                diagReporter_.IncompatibleExternalDeclaration(tk);
+                break;
+            }
+        }
+        if (defK == ProgramSymbol::DefinitionKind::Full) {
+            auto it = std::find_if(externDecls->begin(),
+                                   externDecls->end(),
+                                   [this] (const auto& externDecl) {
+                                       return externDecl.tree_ != tree_
+                                           && externDecl.defK_ == ProgramSymbol::DefinitionKind::Full;
+                                   });
+            if (it != externDecls->end())
+                diagReporter_.MultipleExternalDefinitions(tk);
+        }
+    }
+    prog_->addExternalDeclaration(nameText, { decl, tree_, defK });
+}
+
+void LinkageResolver::linkTagDeclaration(const TagDeclarationSymbol* tagDecl)
+{
+    auto name = tagDecl->introducedNewType()->tag()->valueText();
+    const TagDeclarationSymbol* compatibleTagDecl = nullptr;
+    for (auto otherTagDecl : prog_->tagDeclarationsNamed(name)) {
+        TypePairs assumed;
+        if (tagTypesAreCompatible(otherTagDecl->introducedNewType(),
+                                  tagDecl->introducedNewType(),
+                                  assumed)) {
+            compatibleTagDecl = otherTagDecl;
+            break;
+        }
+    }
+    prog_->addTagDeclaration(name, tagDecl, tree_, compatibleTagDecl);
+}
+
+bool LinkageResolver::typesAreCompatible(
+        const Type* oneTy,
+        const Type* otherTy,
+        TypePairs& assumed)
+{
+    oneTy = unaliased(oneTy);
+    otherTy = unaliased(otherTy);
+    if (!oneTy
+            || !otherTy
+            || oneTy->kind() == TypeKind::Error
+            || otherTy->kind() == TypeKind::Error) {
+        return true;
+    }
+    if (oneTy->kind() != otherTy->kind())
+        return false;
+
+    switch (oneTy->kind()) {
+        case TypeKind::Array: {
+            auto oneArrTy = oneTy->asArrayType();
+            auto otherArrTy = otherTy->asArrayType();
+            if (oneArrTy->hasKnownSize()
+                    && otherArrTy->hasKnownSize()
+                    && oneArrTy->size() != otherArrTy->size()) {
+                return false;
+            }
+            return typesAreCompatible(oneArrTy->elementType(),
+                                      otherArrTy->elementType(),
+                                      assumed);
+        }
+
+        case TypeKind::Basic:
+            return oneTy->asBasicType()->kind() == otherTy->asBasicType()->kind();
+
+        case TypeKind::Function: {
+            auto oneFuncTy = oneTy->asFunctionType();
+            auto otherFuncTy = otherTy->asFunctionType();
+            if (!typesAreCompatible(oneFuncTy->returnType(),
+                                    otherFuncTy->returnType(),
+                                    assumed)) {
+                return false;
+            }
+            if (oneFuncTy->parameterListForm() == FunctionType::ParameterListForm::Unspecified
+                    || otherFuncTy->parameterListForm() == FunctionType::ParameterListForm::Unspecified) {
+                return true;
+            }
+            auto oneParmTys = oneFuncTy->parameterTypes();
+            auto otherParmTys = otherFuncTy->parameterTypes();
+            if (oneParmTys.size() != otherParmTys.size()
+                    || oneFuncTy->isVariadic() != otherFuncTy->isVariadic()) {
+                return false;
+            }
+            for (FunctionType::ParameterTypes::size_type idx = 0; idx < oneParmTys.size(); ++idx) {
+                if (!typesAreCompatible(unqualified(oneParmTys[idx]),
+                                        unqualified(otherParmTys[idx]),
+                                        assumed)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case TypeKind::Pointer:
+            return typesAreCompatible(oneTy->asPointerType()->referencedType(),
+                                      otherTy->asPointerType()->referencedType(),
+                                      assumed);
+
+        case TypeKind::Tag:
+            return tagTypesAreCompatible(oneTy->asTagType(), otherTy->asTagType(), assumed);
+
+        case TypeKind::Qualified:
+            return oneTy->asQualifiedType()->qualifiers() == otherTy->asQualifiedType()->qualifiers()
+                && typesAreCompatible(oneTy->asQualifiedType()->unqualifiedType(),
+                                      otherTy->asQualifiedType()->unqualifiedType(),
+                                      assumed);
+
+        case TypeKind::Void:
+        case TypeKind::TypedefName:
+        case TypeKind::Error:
+            return true;
+    }
+    PSY_ASSERT_1(false);
+    return false;
+}
+
+bool LinkageResolver::tagTypesAreCompatible(
+        const TagType* oneTy,
+        const TagType* otherTy,
+        TypePairs& assumed)
+{
+    if (oneTy->kind() != otherTy->kind()
+            || oneTy->isUntagged() != otherTy->isUntagged()
+            || (!oneTy->isUntagged() && oneTy->tag()->valueText() != otherTy->tag()->valueText())) {
+        return false;
+    }
+
+    // 6.2.7-1: if one type is incomplete, the tags alone must match.
+    auto oneTagDecl = oneTy->declaration();
+    auto otherTagDecl = otherTy->declaration();
+    if (!oneTagDecl || !otherTagDecl || oneTagDecl == otherTagDecl)
+        return true;
+
+    // Recursive types (through pointers) are assumed compatible while their
+    // members are being compared.
+    auto tyPair = std::make_pair<const Type*, const Type*>(oneTy, otherTy);
+    if (std::find(assumed.begin(), assumed.end(), tyPair) != assumed.end())
+        return true;
+    assumed.push_back(tyPair);
+
+    auto oneMembs = oneTagDecl->members();
+    auto otherMembs = otherTagDecl->members();
+    if (oneMembs.size() != otherMembs.size())
+        return false;
+
+    auto nameOf = [] (const MemberDeclarationSymbol* memb) {
+        return memb->name() ? memb->name()->valueText() : std::string();
+    };
+
+    if (oneTagDecl->asEnumDeclaration()) {
+        for (auto oneMemb : oneMembs) {
+            auto it = std::find_if(otherMembs.begin(),
+                                   otherMembs.end(),
+                                   [&] (const MemberDeclarationSymbol* otherMemb) {
+                                       return nameOf(otherMemb) == nameOf(oneMemb);
+                                   });
+            if (it == otherMembs.end())
+                return false;
+            auto oneVal = oneMemb->asEnumeratorDeclaration()->value();
+            auto otherVal = (*it)->asEnumeratorDeclaration()->value();
+            if (oneVal.isKnown()
+                    && otherVal.isKnown()
+                    && oneVal.asSigned() != otherVal.asSigned()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    for (TagDeclarationSymbol::Members::size_type idx = 0; idx < oneMembs.size(); ++idx) {
+        auto oneFld = oneMembs[idx]->asFieldDeclaration();
+        auto otherFld = otherMembs[idx]->asFieldDeclaration();
+        if (!oneFld || !otherFld)
+            return false;
+        if (nameOf(oneFld) != nameOf(otherFld)
+                || oneFld->isBitField() != otherFld->isBitField()) {
+            return false;
+        }
+        if (oneFld->isBitField()
+                && oneFld->bitWidth().isKnown()
+                && otherFld->bitWidth().isKnown()
+                && oneFld->bitWidth().asSigned() != otherFld->bitWidth().asSigned()) {
+            return false;
+        }
+        if (!typesAreCompatible(oneFld->type(), otherFld->type(), assumed))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_LINKAGE_RESOLVER_H__
+#define PSYCHE_C_LINKAGE_RESOLVER_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "symbols/Linkage.h"
+#include "symbols/Symbol_Program.h"
+#include "syntax/SyntaxVisitor.h"
+#include "../common/diagnostics/DiagnosticDescriptor.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The LinkageResolver class.
+ *
+ * Determines the Linkage of the objects and functions of a SyntaxTree and
+ * links those with \a external \a linkage (as well as the tag declarations
+ * at file scope) into the ProgramSymbol, diagnosing conflicts with the other
+ * SyntaxTrees of the Compilation.
+ */
+class PSY_C_INTERNAL_API LinkageResolver final : protected SyntaxVisitor
+{
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelTester);
+
+    LinkageResolver(SemanticModel* semaModel, const SyntaxTree* tree);
+    LinkageResolver(const LinkageResolver&) = delete;
+    void operator=(const LinkageResolver&) = delete;
+
+    void resolveLinkages();
+
+private:
+    SemanticModel* semaModel_;
+    ProgramSymbol* prog_;
+    std::unordered_map<const Identifier*, Linkage> fileScopeLinkages_;
+
+    struct DiagnosticsReporter
+    {
+        DiagnosticsReporter(LinkageResolver* resolver)
+            : resolver_(resolver)
+        {}
+        LinkageResolver* resolver_;
+
+        void diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk);
+
+        void IncompatibleExternalDeclaration(SyntaxToken tk);
+        void MultipleExternalDefinitions(SyntaxToken tk);
+
+        static const std::string ID_of_IncompatibleExternalDeclaration;
+        static const std::string ID_of_MultipleExternalDefinitions;
+    };
+    DiagnosticsReporter diagReporter_;
+
+    void link(DeclarationSymbol* decl,
+              const DeclaratorSyntax* decltor,
+              const SpecifierListSyntax* specs,
+              ProgramSymbol::DefinitionKind defK);
+    void linkTagDeclaration(const TagDeclarationSymbol* tagDecl);
+
+    using TypePairs = std::vector<std::pair<const Type*, const Type*>>;
+    static bool typesAreCompatible(const Type* oneTy, const Type* otherTy, TypePairs& assumed);
+    static bool tagTypesAreCompatible(const TagType* oneTy, const TagType* otherTy, TypePairs& assumed);
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    virtual Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    virtual Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
+    virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+};
+
+} // C
+} // psy
+
+#endif
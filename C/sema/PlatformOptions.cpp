@@ -28,7 +28,12 @@ using namespace psy;
 using namespace C;
 
 PlatformOptions::PlatformOptions()
-    : maxValOfChar_(std::numeric_limits<char>::max())
+    : dataModel_(sizeof(long) == 8
+                    ? DataModel::LP64
+                    : sizeof(void*) == 8
+                        ? DataModel::LLP64
+                        : DataModel::ILP32)
+    , maxValOfChar_(std::numeric_limits<char>::max())
     , maxValOfChar_S_(std::numeric_limits<char signed>::max())
     , maxValOfChar_U_(std::numeric_limits<char unsigned>::max())
     , maxValOfShort_S_(std::numeric_limits<short>::max())
@@ -42,6 +47,29 @@ PlatformOptions::PlatformOptions()
     , maxValOfBool_(std::numeric_limits<bool>::max())
 {}
 
+void PlatformOptions::setDataModel(DataModel dataModel)
+{
+    dataModel_ = dataModel;
+    maxValOfInt_S_ = std::numeric_limits<std::int32_t>::max();
+    maxValOfInt_U_ = std::numeric_limits<std::uint32_t>::max();
+    switch (dataModel) {
+        case DataModel::ILP32:
+        case DataModel::LLP64:
+            maxValOfLong_S_ = std::numeric_limits<std::int32_t>::max();
+            maxValOfLong_U_ = std::numeric_limits<std::uint32_t>::max();
+            break;
+        case DataModel::LP64:
+            maxValOfLong_S_ = std::numeric_limits<std::int64_t>::max();
+            maxValOfLong_U_ = std::numeric_limits<std::uint64_t>::max();
+            break;
+    }
+}
+
+PlatformOptions::DataModel PlatformOptions::dataModel() const
+{
+    return dataModel_;
+}
+
 void PlatformOptions::setMaxValueOf(ArithmeticIntegerType arithIntTy, unsigned long long v)
 {
     switch (arithIntTy) {
@@ -36,6 +36,28 @@ class PSY_C_API PlatformOptions
 public:
     PlatformOptions();
 
+    /**
+     * The DataModel alternatives of a PlatformOptions.
+     */
+    enum class DataModel : std::uint8_t
+    {
+        ILP32,  /* int, long, and pointers are 32 bits (e.g., i386 System V). */
+        LP64,   /* long and pointers are 64 bits (e.g., x86-64 System V). */
+        LLP64,  /* long long and pointers are 64 bits (e.g., Windows x64). */
+    };
+
+    //!@{
+    /**
+     * The DataModel of \c this PlatformOptions.
+     *
+     * Setting the DataModel also sets the maximum value of the \c int and
+     * \c long types accordingly. The size and alignment of types (see
+     * Compilation::layoutOf) follow from the DataModel.
+     */
+    void setDataModel(DataModel dataModel);
+    DataModel dataModel() const;
+    //!@}
+
     /**
      * The ArithmeticIntegerType alternatives of a PlatformOptions.
      */
@@ -64,6 +86,7 @@ public:
     //!@}
 
 private:
+    DataModel dataModel_;
     unsigned long long maxValOfChar_;
     unsigned long long maxValOfChar_S_;
     unsigned long long maxValOfChar_U_;
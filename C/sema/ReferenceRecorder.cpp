@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ReferenceRecorder.h"
+
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxUtilities.h"
+#include "syntax/SyntaxVisitor__MACROS__.inc"
+
+using namespace psy;
+using namespace C;
+
+ReferenceRecorder::ReferenceRecorder(SemanticModel* semaModel, const SyntaxTree* tree)
+    : SyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , refsAreComplete_(true)
+{}
+
+void ReferenceRecorder::recordReferences()
+{
+    visit(tree_->root());
+    semaModel_->setReferencesAreComplete(refsAreComplete_);
+}
+
+SyntaxVisitor::Action ReferenceRecorder::visitIdentifierName(const IdentifierNameSyntax* node)
+{
+    auto scope = semaModel_->scopeOf(node);
+    if (!scope) {
+        // An identifier that wasn't bound may designate any declaration.
+        refsAreComplete_ = false;
+        return Action::Skip;
+    }
+    auto decl = scope->searchForDeclaration(
+                identifierFrom(node),
+                NameSpace::OrdinaryIdentifiers);
+    if (decl)
+        semaModel_->addReference(decl, node);
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action ReferenceRecorder::visitMemberAccessExpression(
+        const MemberAccessExpressionSyntax* node)
+{
+    // The member name isn't an ordinary identifier.
+    VISIT(node->expression());
+
+    return Action::Skip;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_REFERENCE_RECORDER_H__
+#define PSYCHE_C_REFERENCE_RECORDER_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "syntax/SyntaxVisitor.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The ReferenceRecorder class.
+ *
+ * Records, into the SemanticModel, the references of every identifier of
+ * a SyntaxTree to the DeclarationSymbol that it designates.
+ *
+ * \remark The references of member names are recorded by the TypeChecker,
+ * given that they depend on the type of the accessed expression.
+ */
+class PSY_C_INTERNAL_API ReferenceRecorder final : protected SyntaxVisitor
+{
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+
+    ReferenceRecorder(SemanticModel* semaModel, const SyntaxTree* tree);
+    ReferenceRecorder(const ReferenceRecorder&) = delete;
+    void operator=(const ReferenceRecorder&) = delete;
+
+    void recordReferences();
+
+private:
+    SemanticModel* semaModel_;
+    bool refsAreComplete_;
+
+    //-------------//
+    // Expressions //
+    //-------------//
+    virtual Action visitIdentifierName(const IdentifierNameSyntax*) override;
+    virtual Action visitMemberAccessExpression(const MemberAccessExpressionSyntax*) override;
+};
+
+} // C
+} // psy
+
+#endif
@@ -50,6 +50,12 @@ const DeclarationSymbol* Scope::searchForDeclaration(
     auto decl = decls_.find(key);
     if (decl != decls_.end())
         return decl->second;
+    if (!declsByText_.empty() && ident) {
+        auto keyByText = std::make_pair(std::string_view(ident->c_str(), ident->size()), ns);
+        auto declByText = declsByText_.find(keyByText);
+        if (declByText != declsByText_.end())
+            return declByText->second;
+    }
     return outerScope_ != nullptr
             ? outerScope_->searchForDeclaration(ident, ns)
             : nullptr;
@@ -76,6 +82,21 @@ void Scope::encloseScope(Scope* innerScope)
     innerScope->outerScope_ = this;
 }
 
+void Scope::encloseScopeOfOtherSyntaxTree(Scope* innerScope)
+{
+    encloseScope(innerScope);
+    if (!declsByText_.empty())
+        return;
+    for (const auto& kv : decls_) {
+        auto ident = kv.first.first;
+        if (!ident)
+            continue;
+        auto key = std::make_pair(std::string_view(ident->c_str(), ident->size()),
+                                  kv.first.second);
+        declsByText_.insert(std::make_pair(key, kv.second));
+    }
+}
+
 void Scope::morphFrom_FunctionPrototype_to_Block()
 {
     PSY_ASSERT_2(scopeK_ == ScopeKind::FunctionPrototype, return);
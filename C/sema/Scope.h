@@ -31,6 +31,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -49,6 +50,17 @@ struct std::hash<std::pair<const Identifier*, NameSpace>>
      }
 };
 
+template <>
+struct std::hash<std::pair<std::string_view, NameSpace>>
+{
+     std::size_t operator()(const std::pair<std::string_view, NameSpace>& k) const
+     {
+        auto h1 = std::hash<std::string_view>{}(k.first);
+        auto h2 = std::hash<NameSpace>{}(k.second);
+        return h1 ^ (h2 << 1);
+     }
+};
+
 namespace psy {
 namespace C {
 
@@ -90,10 +102,12 @@ PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
     PSY_GRANT_INTERNAL_ACCESS(TranslationUnitSymbol);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     Scope(ScopeKind scopeK);
 
     void encloseScope(Scope* innerScope);
+    void encloseScopeOfOtherSyntaxTree(Scope* innerScope);
     void morphFrom_FunctionPrototype_to_Block();
     void addDeclaration(const DeclarationSymbol*);
 
@@ -103,6 +117,15 @@ private:
     std::unordered_map<
             std::pair<const Identifier*, NameSpace>,
             const DeclarationSymbol*> decls_;
+
+    /*
+     * Identifiers are unique only within a SyntaxTree; when a Scope
+     * encloses the Scope of another SyntaxTree (see Compilation's prelude),
+     * its declarations are (also) indexed by the identifiers' text.
+     */
+    std::unordered_map<
+            std::pair<std::string_view, NameSpace>,
+            const DeclarationSymbol*> declsByText_;
 };
 
 } // C
@@ -18,12 +18,13 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-#include "SemanticModel.h"
+#include "SemanticModel__IMPL__.inc"
 
 #include "Compilation.h"
 #include "sema/DeclarationBinder.h"
 #include "sema/TypeCanonicalizer.h"
 #include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
 #include "syntax/SyntaxUtilities.h"
 #include "syntax/Lexeme_Identifier.h"
 #include "symbols/Symbol_ALL.h"
@@ -37,42 +38,6 @@
 using namespace psy;
 using namespace C;
 
-struct SemanticModel::SemanticModelImpl
-{
-    SemanticModelImpl(const SyntaxTree* tree, Compilation* compilation)
-        : bindingIsOK_(false) // TODO
-        , tree_(tree)
-        , compilation_(compilation)
-        , ptrdiff_t_Tydef_(nullptr)
-        , size_t_Tydef_(nullptr)
-        , max_align_t_Tydef_(nullptr)
-        , wchar_t_Tydef_(nullptr)
-        , char16_t_Tydef_(nullptr)
-        , char32_t_Tydef_(nullptr)
-    {}
-
-    bool bindingIsOK_;
-    const SyntaxTree* tree_;
-    Compilation* compilation_;
-    std::unique_ptr<TranslationUnitSymbol> unit_;
-    std::vector<std::unique_ptr<DeclarationSymbol>> decls_;
-    std::unordered_map<const Type*, std::unique_ptr<Type>> tys_;
-    std::unordered_map<const SyntaxNode*, DeclarationSymbol*> declByNode_;
-    std::unordered_set<std::unique_ptr<Scope>> scopes_;
-    std::unordered_map<const SyntaxNode*, const Scope*> scopeByNode_;
-    std::unordered_map<const SyntaxNode*, TypeInfo> tyInfoByNode_;
-
-    inline static const std::string syntheticTagPrefix_ = "#";
-    std::vector<std::pair<std::string, Identifier*>> syntheticTags_;
-
-    const TypedefDeclarationSymbol* ptrdiff_t_Tydef_;
-    const TypedefDeclarationSymbol* size_t_Tydef_;
-    const TypedefDeclarationSymbol* max_align_t_Tydef_;
-    const TypedefDeclarationSymbol* wchar_t_Tydef_;
-    const TypedefDeclarationSymbol* char16_t_Tydef_;
-    const TypedefDeclarationSymbol* char32_t_Tydef_;
-};
-
 SemanticModel::SemanticModel(const SyntaxTree* tree, Compilation* compilation)
     : P(new SemanticModelImpl(tree, compilation))
 {}
@@ -95,6 +60,33 @@ const TranslationUnitSymbol* SemanticModel::translationUnit() const
     return P->unit_.get();
 }
 
+void SemanticModel::attachSnapshot(std::unique_ptr<SemanticModelSnapshot> snapshot)
+{
+    PSY_ASSERT_2(!P->unit_.get() && !P->snapshot_, return);
+    P->snapshot_ = std::move(snapshot);
+}
+
+bool SemanticModel::restoreFromSnapshot()
+{
+    if (!P->snapshot_ || P->snapshot_->hasRestoredDeclarations())
+        return true;
+    if (P->snapshot_->restoreDeclarations(this))
+        return true;
+    P->snapshot_.reset();
+    return false;
+}
+
+void SemanticModel::restoreSideTablesFromSnapshot()
+{
+    if (!P->snapshot_ || !restoreFromSnapshot())
+        return;
+
+    // The side tables are restored only once requested; afterwards,
+    // the snapshot is no longer needed.
+    auto snapshot = std::move(P->snapshot_);
+    snapshot->restoreSideTables(this);
+}
+
 TranslationUnitSymbol* SemanticModel::setTranslationUnit(std::unique_ptr<TranslationUnitSymbol> unit)
 {
     PSY_ASSERT_2(!P->unit_.get(), return nullptr);
@@ -129,7 +121,15 @@ Scope* SemanticModel::keepScope(std::unique_ptr<Scope> scope)
 {
     auto r = P->scopes_.insert(std::move(scope));
     PSY_ASSERT_1(r.second);
-    return r.first->get();
+    auto keptScope = r.first->get();
+    if (keptScope->kind() == ScopeKind::File && !P->fileScope_)
+        P->fileScope_ = keptScope;
+    return keptScope;
+}
+
+Scope* SemanticModel::fileScope()
+{
+    return P->fileScope_;
 }
 
 void SemanticModel::setScopeOf(const IdentifierNameSyntax* node, const Scope* scope)
@@ -137,8 +137,43 @@ void SemanticModel::setScopeOf(const IdentifierNameSyntax* node, const Scope* sc
     P->scopeByNode_[node] = scope;
 }
 
+std::vector<SyntaxToken> SemanticModel::referencesTo(const DeclarationSymbol* decl) const
+{
+    std::vector<SyntaxToken> tks;
+    auto it = P->refTkIdxsByDecl_.find(decl);
+    if (it == P->refTkIdxsByDecl_.end())
+        return tks;
+    tks.reserve(it->second.size());
+    for (auto tkIdx : it->second)
+        tks.push_back(P->tree_->tokenAt(tkIdx));
+    return tks;
+}
+
+void SemanticModel::addReference(const DeclarationSymbol* decl, const IdentifierNameSyntax* node)
+{
+    P->refTkIdxsByDecl_[decl].push_back(node->firstTokenIndex());
+}
+
+bool SemanticModel::isReferenced(const DeclarationSymbol* decl) const
+{
+    return P->refTkIdxsByDecl_.count(decl);
+}
+
+bool SemanticModel::referencesAreComplete() const
+{
+    return P->refsAreComplete_;
+}
+
+void SemanticModel::setReferencesAreComplete(bool complete)
+{
+    P->refsAreComplete_ = complete;
+}
+
 TypeInfo SemanticModel::typeInfoOf_CORE(const SyntaxNode* node)
 {
+    if (P->snapshot_)
+        restoreSideTablesFromSnapshot();
+
     auto it = P->tyInfoByNode_.find(node);
     if (it != P->tyInfoByNode_.end())
         return it->second;
@@ -162,8 +197,41 @@ void SemanticModel::setTypeInfoOf(const SyntaxNode* node, TypeInfo&& tyInfo)
     P->tyInfoByNode_.emplace(node, tyInfo);
 }
 
+ConstantValue SemanticModel::constantValueOf(const ExpressionSyntax* node) const
+{
+    if (P->snapshot_)
+        const_cast<SemanticModel*>(this)->restoreSideTablesFromSnapshot();
+
+    auto it = P->constValByNode_.find(node);
+    if (it != P->constValByNode_.end())
+        return it->second;
+    return ConstantValue();
+}
+
+void SemanticModel::setConstantValueOf(const ExpressionSyntax* node, ConstantValue val)
+{
+    PSY_ASSERT_1(!P->constValByNode_.count(node));
+    P->constValByNode_.emplace(node, val);
+}
+
+const ArrayType* SemanticModel::arrayTypeOf(const SubscriptSuffixSyntax* node) const
+{
+    auto it = P->arrTyByNode_.find(node);
+    if (it != P->arrTyByNode_.end())
+        return it->second;
+    return nullptr;
+}
+
+void SemanticModel::setArrayTypeOf(const SubscriptSuffixSyntax* node, const ArrayType* arrTy)
+{
+    P->arrTyByNode_[node] = arrTy;
+}
+
 const Scope* SemanticModel::scopeOf(const IdentifierNameSyntax* node) const
 {
+    if (P->snapshot_)
+        const_cast<SemanticModel*>(this)->restoreSideTablesFromSnapshot();
+
     return P->scopeByNode_[node];
 }
 
@@ -353,6 +421,15 @@ const DeclarationSymbol* SemanticModel::declarationBy(const DeclaratorSyntax* no
     return const_cast<SemanticModel*>(this)->declarationBy(node);
 }
 
+std::vector<const DeclarationSymbol*> SemanticModel::declarations() const
+{
+    std::vector<const DeclarationSymbol*> decls;
+    decls.reserve(P->decls_.size());
+    for (const auto& decl : P->decls_)
+        decls.push_back(decl.get());
+    return decls;
+}
+
 const DeclarationSymbol* SemanticModel::searchForDeclaration(
         std::function<bool (const DeclarationSymbol*)> pred) const
 {
@@ -395,6 +472,16 @@ const TypedefDeclarationSymbol* SemanticModel::char32_t_typedef() const
     return P->char32_t_Tydef_;
 }
 
+const std::string& SemanticModel::synthesizedDeclarations() const
+{
+    return P->synthesizedDecls_;
+}
+
+void SemanticModel::setSynthesizedDeclarations(std::string decls)
+{
+    P->synthesizedDecls_ = std::move(decls);
+}
+
 void SemanticModel::set_ptrdiff_t_typedef(const TypedefDeclarationSymbol* decl)
 {
     P->ptrdiff_t_Tydef_ = decl;
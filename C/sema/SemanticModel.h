@@ -24,6 +24,7 @@
 #include "API.h"
 #include "Fwds.h"
 
+#include "ConstantValue.h"
 #include "TypeInfo.h"
 #include "symbols/SymbolKind.h"
 #include "../common/infra/AccessSpecifiers.h"
@@ -166,11 +167,35 @@ public:
     TypeInfo typeInfoOf(const TypeNameSyntax* node) const;
     //!@}
 
+    /**
+     * The ConstantValue of the given \c node, if it's an
+     * <em>integer constant expression</em> whose value is known.
+     *
+     * \remark 6.6-6
+     */
+    ConstantValue constantValueOf(const ExpressionSyntax* node) const;
+
     /**
      * The Scope of the given \c node.
      */
     const Scope* scopeOf(const IdentifierNameSyntax* node) const;
 
+    /**
+     * The \a references to the given DeclarationSymbol \c decl (i.e., the
+     * identifiers that designate it) within \c this SemanticModel's SyntaxTree.
+     *
+     * \remark The references are recorded, after type checking, by a walk
+     * over the whole SyntaxTree that looks up the Scope of every identifier;
+     * that's a cost comparable to that of binding, paid even if this function
+     * is never called. The references of member names are recorded by the
+     * type checker, and only where the accessed expression is type checked.
+     * They aren't retained by a SemanticModelSnapshot.
+     *
+     * \note Similar to:
+     * - \c Microsoft.CodeAnalysis.FindSymbols.SymbolFinder.FindReferencesAsync of Roslyn.
+     */
+    std::vector<SyntaxToken> referencesTo(const DeclarationSymbol* decl) const;
+
     /**
      * The \a declaration of \c ptrdiff_t, if one exists.
      */
@@ -201,21 +226,44 @@ public:
      */
     const TypedefDeclarationSymbol* char32_t_typedef() const;
 
+    /**
+     * The declarations synthesized for the undeclared identifiers and the
+     * unknown typedef names of \c this SemanticModel's SyntaxTree.
+     *
+     * \remark The declarations are only synthesized if enabled through
+     * InferenceOptions::enable_DeclarationAndTypeInference; they aren't
+     * retained by a SemanticModelSnapshot.
+     */
+    const std::string& synthesizedDeclarations() const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(Compilation);
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
     PSY_GRANT_INTERNAL_ACCESS(TypedefNameTypeResolver);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(TypeInferrer);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
+    PSY_GRANT_INTERNAL_ACCESS(SymbolIndex);
+    PSY_GRANT_INTERNAL_ACCESS(LinkageResolver);
+    PSY_GRANT_INTERNAL_ACCESS(CallGraphBuilder);
+    PSY_GRANT_INTERNAL_ACCESS(ReferenceRecorder);
+    PSY_GRANT_INTERNAL_ACCESS(UnusedDeclarationChecker);
     PSY_GRANT_INTERNAL_ACCESS(InternalsTestSuite);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelTester);
 
     SemanticModel(const SyntaxTree* tree, Compilation* compilation);
 
+    void attachSnapshot(std::unique_ptr<SemanticModelSnapshot> snapshot);
+    bool restoreFromSnapshot();
+    void restoreSideTablesFromSnapshot();
+
     TranslationUnitSymbol* setTranslationUnit(std::unique_ptr<TranslationUnitSymbol> unit);
 
     DeclarationSymbol* addDeclaration(
             const SyntaxNode* node,
             std::unique_ptr<DeclarationSymbol> decl);
+    std::vector<const DeclarationSymbol*> declarations() const;
 
     DeclarationSymbol* declarationBy(const DeclaratorSyntax* node);
     FunctionDeclarationSymbol* functionFor(const FunctionDefinitionSyntax* node);
@@ -232,11 +280,22 @@ PSY_INTERNAL:
     TypeDeclarationSymbol* typeDeclarationFor(const TypeDeclarationSyntax* node);
 
     Scope* keepScope(std::unique_ptr<Scope> scope);
+    Scope* fileScope();
     void setScopeOf(const IdentifierNameSyntax* node, const Scope* scope);
 
+    void addReference(const DeclarationSymbol* decl, const IdentifierNameSyntax* node);
+    bool isReferenced(const DeclarationSymbol* decl) const;
+    bool referencesAreComplete() const;
+    void setReferencesAreComplete(bool complete);
+
     TypeInfo typeInfoOf_CORE(const SyntaxNode* node);
     void setTypeInfoOf(const SyntaxNode* node, TypeInfo&& tyInfo);
 
+    void setConstantValueOf(const ExpressionSyntax* node, ConstantValue val);
+
+    const ArrayType* arrayTypeOf(const SubscriptSuffixSyntax* node) const;
+    void setArrayTypeOf(const SubscriptSuffixSyntax* node, const ArrayType* arrTy);
+
     Type* keepType(std::unique_ptr<Type> ty);
     void dropType(const Type* ty);
 
@@ -249,6 +308,8 @@ PSY_INTERNAL:
 
     const Identifier* freshSyntheticTag();
 
+    void setSynthesizedDeclarations(std::string decls);
+
 private:
     DECL_PIMPL(SemanticModel)
 };
@@ -0,0 +1,1132 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SemanticModel__IMPL__.inc"
+
+#include "Compilation.h"
+#include "syntax/Lexeme_Identifier.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxVisitor.h"
+#include "symbols/Symbol_ALL.h"
+#include "types/Type_ALL.h"
+#include "../common/infra/Assertions.h"
+
+#include <cstring>
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+const std::uint32_t kMagic = 0x53534d50; // PMSS
+const std::uint32_t kVersion = 4;
+
+enum class TypeReference : std::uint8_t
+{
+    Null,
+    Local,
+    CanonicalBasic,
+    CanonicalVoid,
+    CanonicalError,
+};
+
+enum class IdentifierReference : std::uint8_t
+{
+    Null,
+    Text,
+    SyntheticTag,
+};
+
+// Encoded sizes, in bytes, used to check a count against what's left of a snapshot.
+const std::uint32_t kIndexSize = 4;
+const std::uint32_t kTypeReferenceSize = 1 + 4;
+const std::uint32_t kConstantValueSize = 1 + 1 + 8;
+
+bool isBasicTypeKind(std::uint32_t v)
+{
+    return v <= static_cast<std::uint32_t>(BasicTypeKind::LongDoubleComplex);
+}
+
+class Writer
+{
+public:
+    Writer(std::string& data) : data_(data) {}
+
+    void u8(std::uint8_t v) { data_.push_back(static_cast<char>(v)); }
+
+    void u32(std::uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            u8(static_cast<std::uint8_t>(v >> (i * 8)));
+    }
+
+    void u64(std::uint64_t v)
+    {
+        for (int i = 0; i < 8; ++i)
+            u8(static_cast<std::uint8_t>(v >> (i * 8)));
+    }
+
+    void text(const char* s, std::uint32_t size)
+    {
+        u32(size);
+        data_.append(s, size);
+    }
+
+    std::string::size_type offset() const { return data_.size(); }
+
+    void patchU32(std::string::size_type offset, std::uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            data_[offset + i] = static_cast<char>(v >> (i * 8));
+    }
+
+private:
+    std::string& data_;
+};
+
+class Reader
+{
+public:
+    Reader(const std::string& data, std::string::size_type offset = 0)
+        : data_(data)
+        , offset_(offset)
+    {}
+
+    bool ok() const { return offset_ <= data_.size(); }
+
+    void fail() { offset_ = data_.size() + 1; }
+
+    /*
+     * Whether there are bytes left for \c cnt records of (at least)
+     * \c recSize bytes each.
+     */
+    bool fits(std::uint32_t cnt, std::uint32_t recSize) const
+    {
+        return ok() && std::uint64_t(cnt) * recSize <= data_.size() - offset_;
+    }
+
+    std::uint8_t u8()
+    {
+        if (offset_ >= data_.size()) {
+            fail();
+            return 0;
+        }
+        return static_cast<std::uint8_t>(data_[offset_++]);
+    }
+
+    std::uint32_t u32()
+    {
+        std::uint32_t v = 0;
+        for (int i = 0; i < 4; ++i)
+            v |= std::uint32_t(u8()) << (i * 8);
+        return v;
+    }
+
+    std::uint64_t u64()
+    {
+        std::uint64_t v = 0;
+        for (int i = 0; i < 8; ++i)
+            v |= std::uint64_t(u8()) << (i * 8);
+        return v;
+    }
+
+    std::pair<const char*, std::uint32_t> text()
+    {
+        auto size = u32();
+        if (!ok() || data_.size() - offset_ < size) {
+            fail();
+            return std::make_pair("", 0);
+        }
+        auto s = data_.c_str() + offset_;
+        offset_ += size;
+        return std::make_pair(s, size);
+    }
+
+    std::string::size_type offset() const { return offset_; }
+
+private:
+    const std::string& data_;
+    std::string::size_type offset_;
+};
+
+/*
+ * Enumerate the nodes of a tree in preorder; a node is identified,
+ * in a snapshot, by its position in this enumeration.
+ */
+class NodeEnumerator final : public SyntaxVisitor
+{
+public:
+    NodeEnumerator(const SyntaxTree* tree)
+        : SyntaxVisitor(tree)
+    {}
+
+    std::vector<const SyntaxNode*> enumerate()
+    {
+        visit(tree_->root());
+        return std::move(nodes_);
+    }
+
+    bool preVisit(const SyntaxNode* node) override
+    {
+        nodes_.push_back(node);
+        return true;
+    }
+
+private:
+    std::vector<const SyntaxNode*> nodes_;
+};
+
+std::uint64_t fingerprintOf(const SyntaxTree* tree)
+{
+    // FNV-1a
+    std::uint64_t h = 14695981039346656037ULL;
+    for (auto c : tree->text().rawText()) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+} // anonymous
+
+struct SemanticModelSnapshot::SemanticModelSnapshotImpl
+{
+    SemanticModelSnapshotImpl(const SyntaxTree* tree, std::string data)
+        : tree_(tree)
+        , data_(std::move(data))
+        , declsOffset_(0)
+        , sideTablesOffset_(0)
+        , declsRestored_(false)
+    {}
+
+    const SyntaxTree* tree_;
+    std::string data_;
+    std::string::size_type declsOffset_;
+    std::string::size_type sideTablesOffset_;
+    bool declsRestored_;
+
+    std::vector<const SyntaxNode*> nodes_;
+    std::vector<const Identifier*> syntheticTags_;
+    std::vector<Type*> tys_;
+    std::vector<Scope*> scopes_;
+    std::vector<DeclarationSymbol*> decls_;
+
+    const SyntaxNode* readNode(Reader& r);
+    const Identifier* readIdentifier(Reader& r);
+    const Type* readType(Reader& r, const Compilation* compilation);
+    Scope* readScope(Reader& r);
+    DeclarationSymbol* readDeclaration(Reader& r);
+    ConstantValue readConstantValue(Reader& r);
+    void readTypeRecord(Reader& r,
+                        SemanticModel* semaModel,
+                        std::vector<Type*>::size_type idx,
+                        bool link);
+    DeclarationSymbol* readDeclarationRecord(Reader& r, SemanticModel* semaModel);
+    bool readSideTables(SemanticModel* semaModel, bool apply);
+
+    class SnapshotWriter;
+};
+
+SemanticModelSnapshot::SemanticModelSnapshot(const SyntaxTree* tree, std::string data)
+    : P(new SemanticModelSnapshotImpl(tree, std::move(data)))
+{}
+
+SemanticModelSnapshot::~SemanticModelSnapshot()
+{}
+
+//-------//
+// Write //
+//-------//
+
+class SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter
+{
+public:
+    SnapshotWriter(const SemanticModel* semaModel,
+                   const SemanticModel::SemanticModelImpl* M,
+                   std::string& data)
+        : semaModel_(semaModel)
+        , M_(M)
+        , w_(data)
+    {}
+
+    void write();
+
+private:
+    void writeIdentifier(const Identifier* ident);
+    void writeType(const Type* ty);
+    void writeScope(const Scope* scope);
+    void writeDeclaration(const DeclarationSymbol* decl);
+    void writeNode(const SyntaxNode* node);
+    void writeConstantValue(const ConstantValue& val);
+
+    const SemanticModel* semaModel_;
+    const SemanticModel::SemanticModelImpl* M_;
+    Writer w_;
+
+    std::unordered_map<const SyntaxNode*, std::uint32_t> nodeIdx_;
+    std::unordered_map<const Identifier*, std::uint32_t> syntheticTagIdx_;
+    std::unordered_map<const Type*, std::uint32_t> tyIdx_;
+    std::unordered_map<const Scope*, std::uint32_t> scopeIdx_;
+    std::unordered_map<const DeclarationSymbol*, std::uint32_t> declIdx_;
+};
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeIdentifier(const Identifier* ident)
+{
+    if (!ident) {
+        w_.u8(static_cast<std::uint8_t>(IdentifierReference::Null));
+        return;
+    }
+    auto it = syntheticTagIdx_.find(ident);
+    if (it != syntheticTagIdx_.end()) {
+        w_.u8(static_cast<std::uint8_t>(IdentifierReference::SyntheticTag));
+        w_.u32(it->second);
+        return;
+    }
+    w_.u8(static_cast<std::uint8_t>(IdentifierReference::Text));
+    w_.text(ident->c_str(), ident->size());
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeType(const Type* ty)
+{
+    if (!ty) {
+        w_.u8(static_cast<std::uint8_t>(TypeReference::Null));
+        w_.u32(0);
+        return;
+    }
+    auto it = tyIdx_.find(ty);
+    if (it != tyIdx_.end()) {
+        w_.u8(static_cast<std::uint8_t>(TypeReference::Local));
+        w_.u32(it->second);
+        return;
+    }
+    switch (ty->kind()) {
+        case TypeKind::Basic:
+            w_.u8(static_cast<std::uint8_t>(TypeReference::CanonicalBasic));
+            w_.u32(static_cast<std::uint32_t>(ty->asBasicType()->kind()));
+            return;
+        case TypeKind::Void:
+            w_.u8(static_cast<std::uint8_t>(TypeReference::CanonicalVoid));
+            w_.u32(0);
+            return;
+        default:
+            // A canonical error type or a type (already) dropped from the model.
+            w_.u8(static_cast<std::uint8_t>(TypeReference::CanonicalError));
+            w_.u32(0);
+            return;
+    }
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeScope(const Scope* scope)
+{
+    auto it = scopeIdx_.find(scope);
+    w_.u32(it == scopeIdx_.end() ? 0 : it->second + 1);
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeDeclaration(const DeclarationSymbol* decl)
+{
+    auto it = declIdx_.find(decl);
+    w_.u32(it == declIdx_.end() ? 0 : it->second + 1);
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeNode(const SyntaxNode* node)
+{
+    auto it = nodeIdx_.find(node);
+    PSY_ASSERT_1(it != nodeIdx_.end());
+    w_.u32(it == nodeIdx_.end() ? 0 : it->second);
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::writeConstantValue(const ConstantValue& val)
+{
+    w_.u8(val.isKnown());
+    w_.u8(static_cast<std::uint8_t>(val.basicTypeKind()));
+    w_.u64(val.asUnsigned());
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::SnapshotWriter::write()
+{
+    auto tree = semaModel_->syntaxTree();
+    auto nodes = NodeEnumerator(tree).enumerate();
+    for (std::uint32_t i = 0; i < nodes.size(); ++i)
+        nodeIdx_[nodes[i]] = i;
+
+    w_.u32(kMagic);
+    w_.u32(kVersion);
+    w_.u64(fingerprintOf(tree));
+    w_.u32(static_cast<std::uint32_t>(nodes.size()));
+    auto sideTablesOffsetAt = w_.offset();
+    w_.u32(0);
+
+    // Synthetic tags.
+    w_.u32(static_cast<std::uint32_t>(M_->syntheticTags_.size()));
+    for (std::uint32_t i = 0; i < M_->syntheticTags_.size(); ++i)
+        syntheticTagIdx_[M_->syntheticTags_[i].second] = i;
+
+    // Types: indexed first, since they may reference each other.
+    std::vector<const Type*> tys;
+    tys.reserve(M_->tys_.size());
+    for (const auto& p : M_->tys_) {
+        tyIdx_[p.first] = static_cast<std::uint32_t>(tys.size());
+        tys.push_back(p.first);
+    }
+    std::vector<const Scope*> scopes;
+    scopes.reserve(M_->scopes_.size());
+    for (const auto& scope : M_->scopes_) {
+        scopeIdx_[scope.get()] = static_cast<std::uint32_t>(scopes.size());
+        scopes.push_back(scope.get());
+    }
+    for (std::uint32_t i = 0; i < M_->decls_.size(); ++i)
+        declIdx_[M_->decls_[i].get()] = i;
+
+    w_.u32(static_cast<std::uint32_t>(tys.size()));
+    for (auto ty : tys) {
+        w_.u8(static_cast<std::uint8_t>(ty->kind()));
+        switch (ty->kind()) {
+            case TypeKind::Array: {
+                auto arrTy = ty->asArrayType();
+                writeType(arrTy->elementType());
+                w_.u8(static_cast<std::uint8_t>(arrTy->hasKnownSize())
+                      | static_cast<std::uint8_t>(arrTy->hasUnspecifiedSize()) << 1);
+                w_.u64(arrTy->size());
+                break;
+            }
+
+            case TypeKind::Basic:
+                w_.u8(static_cast<std::uint8_t>(ty->asBasicType()->kind()));
+                break;
+
+            case TypeKind::Function: {
+                auto funcTy = ty->asFunctionType();
+                writeType(funcTy->returnType());
+                auto parmTys = funcTy->parameterTypes();
+                w_.u32(static_cast<std::uint32_t>(parmTys.size()));
+                for (auto parmTy : parmTys)
+                    writeType(parmTy);
+                w_.u8(static_cast<std::uint8_t>(funcTy->parameterListForm()));
+                w_.u8(funcTy->isVariadic());
+                break;
+            }
+
+            case TypeKind::Pointer: {
+                auto ptrTy = ty->asPointerType();
+                writeType(ptrTy->referencedType());
+                w_.u8(ptrTy->arisesFromArrayDecay());
+                w_.u8(ptrTy->arisesFromFunctionDecay());
+                break;
+            }
+
+            case TypeKind::TypedefName: {
+                auto tydefNameTy = ty->asTypedefNameType();
+                writeIdentifier(tydefNameTy->typedefName());
+                writeType(tydefNameTy->resolvedSynonymizedType());
+                break;
+            }
+
+            case TypeKind::Tag: {
+                auto tagTy = ty->asTagType();
+                w_.u8(static_cast<std::uint8_t>(tagTy->kind()));
+                writeIdentifier(tagTy->tag());
+                break;
+            }
+
+            case TypeKind::Qualified: {
+                auto qualTy = ty->asQualifiedType();
+                writeType(qualTy->unqualifiedType());
+                auto quals = qualTy->qualifiers();
+                w_.u8(quals.hasConst()
+                        | quals.hasVolatile() << 1
+                        | quals.hasRestrict() << 2
+                        | quals.hasAtomic() << 3);
+                break;
+            }
+
+            case TypeKind::Void:
+            case TypeKind::Error:
+                break;
+        }
+    }
+
+    w_.u32(static_cast<std::uint32_t>(scopes.size()));
+    for (auto scope : scopes) {
+        w_.u8(static_cast<std::uint8_t>(scope->kind()));
+        writeScope(scope->outerScope());
+    }
+
+    // The node of each declaration is retrieved from the node-to-declaration table.
+    std::unordered_map<const DeclarationSymbol*, const SyntaxNode*> nodeByDecl;
+    for (const auto& p : M_->declByNode_)
+        nodeByDecl[p.second] = p.first;
+
+    w_.u32(static_cast<std::uint32_t>(M_->decls_.size()));
+    for (const auto& declPtr : M_->decls_) {
+        auto decl = declPtr.get();
+        w_.u8(static_cast<std::uint8_t>(decl->kind()));
+        writeNode(nodeByDecl[decl]);
+        auto containingSym = decl->containingSymbol();
+        w_.u32(containingSym && containingSym->asDeclaration()
+                    ? declIdx_[containingSym->asDeclaration()] + 1
+                    : 0);
+        writeScope(decl->enclosingScope());
+
+        switch (decl->kind()) {
+            case SymbolKind::FunctionDeclaration:
+            case SymbolKind::VariableDeclaration:
+            case SymbolKind::ParameterDeclaration:
+            case SymbolKind::FieldDeclaration:
+            case SymbolKind::EnumeratorDeclaration: {
+                auto nameableDecl =
+                        MIXIN_NameableDeclarationSymbol::from(const_cast<DeclarationSymbol*>(decl));
+                writeIdentifier(nameableDecl->name());
+                writeType(MIXIN_TypeableDeclarationSymbol::from(decl)->type());
+                if (decl->kind() == SymbolKind::EnumeratorDeclaration)
+                    writeConstantValue(decl->asEnumeratorDeclaration()->value());
+                else if (decl->kind() == SymbolKind::FieldDeclaration) {
+                    auto fldDecl = decl->asFieldDeclaration();
+                    w_.u8(fldDecl->isBitField());
+                    writeConstantValue(fldDecl->bitWidth());
+                }
+                break;
+            }
+
+            case SymbolKind::TypedefDeclaration: {
+                auto tydefDecl = decl->asTypedefDeclaration();
+                writeType(tydefDecl->introducedType());
+                writeType(tydefDecl->synonymizedType());
+                break;
+            }
+
+            case SymbolKind::StructDeclaration:
+            case SymbolKind::UnionDeclaration:
+            case SymbolKind::EnumDeclaration: {
+                auto tagTyDecl = decl->asTypeDeclaration()->asTagTypeDeclaration();
+                writeType(tagTyDecl->introducedType());
+                break;
+            }
+
+            default:
+                PSY_ASSERT_1(false);
+                break;
+        }
+    }
+
+    // Members (of tags) and declarations (of scopes) may be forward references.
+    for (const auto& declPtr : M_->decls_) {
+        auto decl = declPtr.get();
+        if (decl->category() != DeclarationCategory::Type
+                || !decl->asTypeDeclaration()->asTagTypeDeclaration())
+            continue;
+        auto membDecls = decl->asTypeDeclaration()->asTagTypeDeclaration()->members();
+        w_.u32(static_cast<std::uint32_t>(membDecls.size()));
+        for (auto membDecl : membDecls)
+            writeDeclaration(membDecl);
+    }
+    for (auto scope : scopes) {
+        auto decls = scope->declarations();
+        w_.u32(static_cast<std::uint32_t>(decls.size()));
+        for (auto decl : decls)
+            writeDeclaration(decl);
+    }
+
+    writeDeclaration(M_->ptrdiff_t_Tydef_);
+    writeDeclaration(M_->size_t_Tydef_);
+    writeDeclaration(M_->max_align_t_Tydef_);
+    writeDeclaration(M_->wchar_t_Tydef_);
+    writeDeclaration(M_->char16_t_Tydef_);
+    writeDeclaration(M_->char32_t_Tydef_);
+
+    w_.patchU32(sideTablesOffsetAt, static_cast<std::uint32_t>(w_.offset()));
+
+    std::vector<std::pair<std::uint32_t, const TypeInfo*>> tyInfos;
+    tyInfos.reserve(M_->tyInfoByNode_.size());
+    for (const auto& p : M_->tyInfoByNode_) {
+        auto it = nodeIdx_.find(p.first);
+        if (it != nodeIdx_.end())
+            tyInfos.push_back(std::make_pair(it->second, &p.second));
+    }
+    w_.u32(static_cast<std::uint32_t>(tyInfos.size()));
+    for (const auto& p : tyInfos) {
+        w_.u32(p.first);
+        w_.u8(static_cast<std::uint8_t>(p.second->typeOrigin()));
+        writeType(p.second->type());
+    }
+
+    std::vector<std::pair<std::uint32_t, const Scope*>> scopesOf;
+    scopesOf.reserve(M_->scopeByNode_.size());
+    for (const auto& p : M_->scopeByNode_) {
+        auto it = nodeIdx_.find(p.first);
+        if (it != nodeIdx_.end())
+            scopesOf.push_back(std::make_pair(it->second, p.second));
+    }
+    w_.u32(static_cast<std::uint32_t>(scopesOf.size()));
+    for (const auto& p : scopesOf) {
+        w_.u32(p.first);
+        writeScope(p.second);
+    }
+
+    std::vector<std::pair<std::uint32_t, const ConstantValue*>> constVals;
+    constVals.reserve(M_->constValByNode_.size());
+    for (const auto& p : M_->constValByNode_) {
+        auto it = nodeIdx_.find(p.first);
+        if (it != nodeIdx_.end())
+            constVals.push_back(std::make_pair(it->second, &p.second));
+    }
+    w_.u32(static_cast<std::uint32_t>(constVals.size()));
+    for (const auto& p : constVals) {
+        w_.u32(p.first);
+        writeConstantValue(*p.second);
+    }
+}
+
+std::string SemanticModelSnapshot::take(const SemanticModel* semaModel)
+{
+    if (semaModel->P->snapshot_)
+        const_cast<SemanticModel*>(semaModel)->restoreSideTablesFromSnapshot();
+
+    std::string data;
+    SemanticModelSnapshotImpl::SnapshotWriter writer(semaModel, semaModel->P.get(), data);
+    writer.write();
+    return data;
+}
+
+//------//
+// Read //
+//------//
+
+std::unique_ptr<SemanticModelSnapshot> SemanticModelSnapshot::open(
+        const SyntaxTree* tree,
+        std::string data)
+{
+    Reader r(data);
+    if (r.u32() != kMagic
+            || r.u32() != kVersion
+            || r.u64() != fingerprintOf(tree))
+        return nullptr;
+    auto nodeCnt = r.u32();
+    auto sideTablesOffset = r.u32();
+    if (!r.ok() || sideTablesOffset > data.size())
+        return nullptr;
+
+    auto nodes = NodeEnumerator(tree).enumerate();
+    if (nodes.size() != nodeCnt)
+        return nullptr;
+
+    auto declsOffset = r.offset();
+    std::unique_ptr<SemanticModelSnapshot> snapshot(
+                new SemanticModelSnapshot(tree, std::move(data)));
+    snapshot->P->nodes_ = std::move(nodes);
+    snapshot->P->declsOffset_ = declsOffset;
+    snapshot->P->sideTablesOffset_ = sideTablesOffset;
+    return snapshot;
+}
+
+bool SemanticModelSnapshot::hasRestoredDeclarations() const
+{
+    return P->declsRestored_;
+}
+
+const SyntaxNode* SemanticModelSnapshot::SemanticModelSnapshotImpl::readNode(Reader& r)
+{
+    auto idx = r.u32();
+    if (idx >= nodes_.size()) {
+        r.fail();
+        return nullptr;
+    }
+    return nodes_[idx];
+}
+
+const Identifier* SemanticModelSnapshot::SemanticModelSnapshotImpl::readIdentifier(Reader& r)
+{
+    switch (IdentifierReference(r.u8())) {
+        case IdentifierReference::Null:
+            return nullptr;
+
+        case IdentifierReference::Text: {
+            auto s = r.text();
+            if (!r.ok())
+                return nullptr;
+            return const_cast<SyntaxTree*>(tree_)->findOrInsertIdentifier(s.first, s.second);
+        }
+
+        case IdentifierReference::SyntheticTag: {
+            auto idx = r.u32();
+            if (idx >= syntheticTags_.size())
+                break;
+            return syntheticTags_[idx];
+        }
+    }
+    r.fail();
+    return nullptr;
+}
+
+const Type* SemanticModelSnapshot::SemanticModelSnapshotImpl::readType(
+        Reader& r,
+        const Compilation* compilation)
+{
+    auto tyRef = TypeReference(r.u8());
+    auto v = r.u32();
+    switch (tyRef) {
+        case TypeReference::Null:
+            return nullptr;
+
+        case TypeReference::Local:
+            if (v >= tys_.size())
+                break;
+            return tys_[v];
+
+        case TypeReference::CanonicalBasic:
+            if (!isBasicTypeKind(v))
+                break;
+            return compilation->canonicalBasicType(BasicTypeKind(v));
+
+        case TypeReference::CanonicalVoid:
+            return compilation->canonicalVoidType();
+
+        case TypeReference::CanonicalError:
+            return compilation->canonicalErrorType();
+    }
+    r.fail();
+    return nullptr;
+}
+
+Scope* SemanticModelSnapshot::SemanticModelSnapshotImpl::readScope(Reader& r)
+{
+    auto idx = r.u32();
+    if (idx == 0)
+        return nullptr;
+    if (idx - 1 >= scopes_.size()) {
+        r.fail();
+        return nullptr;
+    }
+    return scopes_[idx - 1];
+}
+
+DeclarationSymbol* SemanticModelSnapshot::SemanticModelSnapshotImpl::readDeclaration(Reader& r)
+{
+    auto idx = r.u32();
+    if (idx == 0)
+        return nullptr;
+    if (idx - 1 >= decls_.size()) {
+        r.fail();
+        return nullptr;
+    }
+    return decls_[idx - 1];
+}
+
+ConstantValue SemanticModelSnapshot::SemanticModelSnapshotImpl::readConstantValue(Reader& r)
+{
+    auto known = r.u8();
+    auto basicTyK = r.u8();
+    auto bits = r.u64();
+    if (!known)
+        return ConstantValue();
+    if (!isBasicTypeKind(basicTyK)) {
+        r.fail();
+        return ConstantValue();
+    }
+    return ConstantValue(bits, BasicTypeKind(basicTyK));
+}
+
+void SemanticModelSnapshot::SemanticModelSnapshotImpl::readTypeRecord(
+        Reader& r,
+        SemanticModel* semaModel,
+        std::vector<Type*>::size_type idx,
+        bool link)
+{
+    // A type is created in a first pass and linked to the types it
+    // references in a second one.
+    auto compilation = semaModel->compilation();
+    auto tyK = TypeKind(r.u8());
+    switch (tyK) {
+        case TypeKind::Array: {
+            auto elemTy = readType(r, compilation);
+            auto szFlags = r.u8();
+            auto sz = r.u64();
+            if (szFlags > 3)
+                break;
+            if (link) {
+                tys_[idx]->asArrayType()->resetElementType(elemTy);
+                if (szFlags & 1)
+                    tys_[idx]->asArrayType()->setSize(sz);
+                if (szFlags & 2)
+                    tys_[idx]->asArrayType()->setUnspecifiedSize();
+            }
+            else
+                tys_[idx] = semaModel->keepType(std::unique_ptr<ArrayType>(new ArrayType(nullptr)));
+            return;
+        }
+
+        case TypeKind::Basic: {
+            auto basicTyK = r.u8();
+            if (!isBasicTypeKind(basicTyK))
+                break;
+            if (!link)
+                tys_[idx] = semaModel->keepType(
+                            std::unique_ptr<BasicType>(new BasicType(BasicTypeKind(basicTyK))));
+            return;
+        }
+
+        case TypeKind::Function: {
+            auto retTy = readType(r, compilation);
+            auto parmTyCnt = r.u32();
+            if (!r.fits(parmTyCnt, kTypeReferenceSize))
+                break;
+            std::vector<const Type*> parmTys(parmTyCnt);
+            for (auto& parmTy : parmTys)
+                parmTy = readType(r, compilation);
+            auto form = FunctionType::ParameterListForm(r.u8());
+            auto isVariadic = r.u8();
+            if (link) {
+                auto funcTy = tys_[idx]->asFunctionType();
+                funcTy->setReturnType(retTy);
+                for (const auto& parmTy : parmTys)
+                    funcTy->addParameterType(parmTy);
+            }
+            else {
+                std::unique_ptr<FunctionType> funcTy(new FunctionType(nullptr));
+                funcTy->setParameterListForm(form);
+                if (isVariadic)
+                    funcTy->markAsVariadic();
+                tys_[idx] = semaModel->keepType(std::move(funcTy));
+            }
+            return;
+        }
+
+        case TypeKind::Pointer: {
+            auto refedTy = readType(r, compilation);
+            auto fromArrayDecay = r.u8();
+            auto fromFuncDecay = r.u8();
+            if (link)
+                tys_[idx]->asPointerType()->resetReferencedType(refedTy);
+            else {
+                std::unique_ptr<PointerType> ptrTy(new PointerType(nullptr));
+                if (fromArrayDecay)
+                    ptrTy->markAsArisingFromArrayDecay();
+                if (fromFuncDecay)
+                    ptrTy->markAsArisingFromFunctionDecay();
+                tys_[idx] = semaModel->keepType(std::move(ptrTy));
+            }
+            return;
+        }
+
+        case TypeKind::TypedefName: {
+            auto tydefName = readIdentifier(r);
+            auto resolvedTy = readType(r, compilation);
+            if (link)
+                tys_[idx]->asTypedefNameType()->setResolvedSynonymizedType(resolvedTy);
+            else {
+                tys_[idx] = semaModel->keepType(
+                            std::unique_ptr<TypedefNameType>(new TypedefNameType(tydefName)));
+            }
+            return;
+        }
+
+        case TypeKind::Tag: {
+            auto tagTyK = TagTypeKind(r.u8());
+            auto tag = readIdentifier(r);
+            if (!link)
+                tys_[idx] = semaModel->keepType(std::unique_ptr<TagType>(new TagType(tagTyK, tag)));
+            return;
+        }
+
+        case TypeKind::Void:
+            if (!link)
+                tys_[idx] = semaModel->keepType(std::unique_ptr<VoidType>(new VoidType));
+            return;
+
+        case TypeKind::Qualified: {
+            auto unqualTy = readType(r, compilation);
+            auto quals = r.u8();
+            if (link)
+                tys_[idx]->asQualifiedType()->resetUnqualifiedType(unqualTy);
+            else {
+                std::unique_ptr<QualifiedType> qualTy(new QualifiedType(nullptr));
+                if (quals & 1)
+                    qualTy->qualifyWithConst();
+                if (quals & (1 << 1))
+                    qualTy->qualifyWithVolatile();
+                if (quals & (1 << 2))
+                    qualTy->qualifyWithRestrict();
+                if (quals & (1 << 3))
+                    qualTy->qualifyWithAtomic();
+                tys_[idx] = semaModel->keepType(std::move(qualTy));
+            }
+            return;
+        }
+
+        case TypeKind::Error:
+            if (!link)
+                tys_[idx] = semaModel->keepType(std::unique_ptr<ErrorType>(new ErrorType));
+            return;
+    }
+    r.fail();
+}
+
+DeclarationSymbol* SemanticModelSnapshot::SemanticModelSnapshotImpl::readDeclarationRecord(
+        Reader& r,
+        SemanticModel* semaModel)
+{
+    auto compilation = semaModel->compilation();
+    auto symK = SymbolKind(r.u8());
+    auto node = readNode(r);
+    auto containingSym = static_cast<const Symbol*>(readDeclaration(r));
+    if (!containingSym)
+        containingSym = semaModel->translationUnit();
+    auto scope = readScope(r);
+    if (!r.ok() || semaModel->P->declByNode_.count(node)) {
+        r.fail();
+        return nullptr;
+    }
+
+    std::unique_ptr<DeclarationSymbol> newDecl;
+    switch (symK) {
+        case SymbolKind::FunctionDeclaration:
+            newDecl.reset(new FunctionDeclarationSymbol(containingSym, tree_, scope));
+            break;
+        case SymbolKind::VariableDeclaration:
+            newDecl.reset(new VariableDeclarationSymbol(containingSym, tree_, scope));
+            break;
+        case SymbolKind::ParameterDeclaration:
+            newDecl.reset(new ParameterDeclarationSymbol(containingSym, tree_, scope));
+            break;
+        case SymbolKind::FieldDeclaration:
+            newDecl.reset(new FieldDeclarationSymbol(containingSym, tree_, scope));
+            break;
+        case SymbolKind::EnumeratorDeclaration:
+            newDecl.reset(new EnumeratorDeclarationSymbol(containingSym, tree_, scope));
+            break;
+
+        case SymbolKind::TypedefDeclaration: {
+            auto ty = const_cast<Type*>(readType(r, compilation));
+            if (!ty || ty->kind() != TypeKind::TypedefName) {
+                r.fail();
+                return nullptr;
+            }
+            auto tydefDecl = new TypedefDeclarationSymbol(
+                        containingSym, tree_, scope, ty->asTypedefNameType());
+            tydefDecl->setSynonymizedType(readType(r, compilation));
+            newDecl.reset(tydefDecl);
+            break;
+        }
+
+        case SymbolKind::StructDeclaration:
+        case SymbolKind::UnionDeclaration:
+        case SymbolKind::EnumDeclaration: {
+            auto ty = const_cast<Type*>(readType(r, compilation));
+            if (!ty || ty->kind() != TypeKind::Tag) {
+                r.fail();
+                return nullptr;
+            }
+            auto tagTy = ty->asTagType();
+            if (symK == SymbolKind::StructDeclaration)
+                newDecl.reset(new StructDeclarationSymbol(containingSym, tree_, scope, tagTy));
+            else if (symK == SymbolKind::UnionDeclaration)
+                newDecl.reset(new UnionDeclarationSymbol(containingSym, tree_, scope, tagTy));
+            else
+                newDecl.reset(new EnumDeclarationSymbol(containingSym, tree_, scope, tagTy));
+            break;
+        }
+
+        default:
+            r.fail();
+            return nullptr;
+    }
+
+    auto decl = semaModel->addDeclaration(node, std::move(newDecl));
+    PSY_ASSERT_2(decl, return nullptr);
+    if (decl->category() != DeclarationCategory::Type) {
+        MIXIN_NameableDeclarationSymbol::from(decl)->setName(readIdentifier(r));
+        MIXIN_TypeableDeclarationSymbol::from(decl)->setType(readType(r, compilation));
+        if (decl->kind() == SymbolKind::EnumeratorDeclaration)
+            decl->asEnumeratorDeclaration()->setValue(readConstantValue(r));
+        else if (decl->kind() == SymbolKind::FieldDeclaration) {
+            auto isBitFld = r.u8();
+            auto bitWidth = readConstantValue(r);
+            if (isBitFld)
+                decl->asFieldDeclaration()->setBitWidth(bitWidth);
+        }
+    }
+    return decl;
+}
+
+bool SemanticModelSnapshot::restoreDeclarations(SemanticModel* semaModel)
+{
+    PSY_ASSERT_2(!P->declsRestored_, return false);
+    P->declsRestored_ = true;
+
+    auto compilation = semaModel->compilation();
+    std::unique_ptr<TranslationUnitSymbol> unit(
+                new TranslationUnitSymbol(compilation->program(), P->tree_));
+    semaModel->setTranslationUnit(std::move(unit));
+
+    Reader r(P->data_, P->declsOffset_);
+
+    // Every synthetic tag is that of an (anonymous) tag in the tree.
+    auto syntheticTagCnt = r.u32();
+    if (!r.ok() || syntheticTagCnt > P->nodes_.size())
+        return false;
+    P->syntheticTags_.resize(syntheticTagCnt);
+    for (auto& tag : P->syntheticTags_)
+        tag = semaModel->freshSyntheticTag();
+
+    auto tyCnt = r.u32();
+    if (!r.fits(tyCnt, 1))
+        return false;
+    P->tys_.resize(tyCnt);
+    auto tysOffset = r.offset();
+    for (std::vector<Type*>::size_type i = 0; i < P->tys_.size() && r.ok(); ++i)
+        P->readTypeRecord(r, semaModel, i, false);
+    if (!r.ok())
+        return false;
+    Reader rr(P->data_, tysOffset);
+    for (std::vector<Type*>::size_type i = 0; i < P->tys_.size() && rr.ok(); ++i)
+        P->readTypeRecord(rr, semaModel, i, true);
+    if (!rr.ok())
+        return false;
+
+    // A scope is created after the scope that encloses it.
+    auto scopeCnt = r.u32();
+    if (!r.fits(scopeCnt, 1 + kIndexSize))
+        return false;
+    P->scopes_.resize(scopeCnt);
+    for (std::vector<Scope*>::size_type i = 0; i < P->scopes_.size(); ++i) {
+        auto scopeK = r.u8();
+        auto outerIdx = r.u32();
+        if (scopeK > static_cast<std::uint8_t>(ScopeKind::Block) || outerIdx > i)
+            return false;
+        P->scopes_[i] = semaModel->keepScope(std::unique_ptr<Scope>(new Scope(ScopeKind(scopeK))));
+        if (outerIdx)
+            P->scopes_[outerIdx - 1]->encloseScope(P->scopes_[i]);
+    }
+
+    // A declaration's containing symbol always precedes it.
+    auto declCnt = r.u32();
+    if (!r.fits(declCnt, 1 + 3 * kIndexSize))
+        return false;
+    P->decls_.reserve(declCnt);
+    for (std::uint32_t i = 0; i < declCnt && r.ok(); ++i)
+        P->decls_.push_back(P->readDeclarationRecord(r, semaModel));
+    if (!r.ok())
+        return false;
+
+    for (auto decl : P->decls_) {
+        if (decl->category() != DeclarationCategory::Type
+                || !decl->asTypeDeclaration()->asTagTypeDeclaration())
+            continue;
+        auto membCnt = r.u32();
+        if (!r.fits(membCnt, kIndexSize))
+            return false;
+        for (std::uint32_t i = 0; i < membCnt; ++i) {
+            auto membDecl = P->readDeclaration(r);
+            if (decl->kind() == SymbolKind::EnumDeclaration) {
+                if (!membDecl || membDecl->kind() != SymbolKind::EnumeratorDeclaration)
+                    return false;
+                decl->asTypeDeclaration()->asTagTypeDeclaration()->asEnumDeclaration()
+                        ->addEnumerator(membDecl->asEnumeratorDeclaration());
+            }
+            else {
+                if (!membDecl || membDecl->kind() != SymbolKind::FieldDeclaration)
+                    return false;
+                decl->asTypeDeclaration()->asTagTypeDeclaration()->asStructOrUnionDeclaration()
+                        ->addField(membDecl->asFieldDeclaration());
+            }
+        }
+    }
+
+    for (auto scope : P->scopes_) {
+        auto declCnt = r.u32();
+        if (!r.fits(declCnt, kIndexSize))
+            return false;
+        for (std::uint32_t i = 0; i < declCnt; ++i) {
+            auto decl = P->readDeclaration(r);
+            if (decl)
+                scope->addDeclaration(decl);
+        }
+        if (!r.ok())
+            return false;
+    }
+
+    auto readTypedef = [this, &r] () -> const TypedefDeclarationSymbol* {
+        auto decl = P->readDeclaration(r);
+        return decl ? decl->asTypedefDeclaration() : nullptr;
+    };
+    semaModel->set_ptrdiff_t_typedef(readTypedef());
+    semaModel->set_size_t_typedef(readTypedef());
+    semaModel->set_max_align_t_typedef(readTypedef());
+    semaModel->set_wchar_t_typedef(readTypedef());
+    semaModel->set_char16_t_typedef(readTypedef());
+    semaModel->set_char32_t_typedef(readTypedef());
+    if (!r.ok() || r.offset() != P->sideTablesOffset_)
+        return false;
+
+    // The side tables are restored on demand, so they're checked upfront.
+    return P->readSideTables(semaModel, false);
+}
+
+void SemanticModelSnapshot::restoreSideTables(SemanticModel* semaModel)
+{
+    PSY_ASSERT_2(P->declsRestored_, return);
+    // The side tables have been checked along with the declarations.
+    P->readSideTables(semaModel, true);
+}
+
+bool SemanticModelSnapshot::SemanticModelSnapshotImpl::readSideTables(
+        SemanticModel* semaModel,
+        bool apply)
+{
+    auto compilation = semaModel->compilation();
+    Reader r(data_, sideTablesOffset_);
+
+    auto tyInfoCnt = r.u32();
+    if (!r.fits(tyInfoCnt, kIndexSize + 1 + kTypeReferenceSize))
+        return false;
+    for (std::uint32_t i = 0; i < tyInfoCnt; ++i) {
+        auto node = readNode(r);
+        auto tyOrig = r.u8();
+        auto ty = readType(r, compilation);
+        if (tyOrig > static_cast<std::uint8_t>(TypeInfo::TypeOrigin::TypeName))
+            return false;
+        if (apply && node)
+            semaModel->setTypeInfoOf(node, TypeInfo(ty, TypeInfo::TypeOrigin(tyOrig)));
+    }
+    if (!r.ok())
+        return false;
+
+    auto scopeOfCnt = r.u32();
+    if (!r.fits(scopeOfCnt, 2 * kIndexSize))
+        return false;
+    for (std::uint32_t i = 0; i < scopeOfCnt; ++i) {
+        auto node = readNode(r);
+        auto scope = readScope(r);
+        if (apply && node)
+            semaModel->P->scopeByNode_[node] = scope;
+    }
+    if (!r.ok())
+        return false;
+
+    auto constValCnt = r.u32();
+    if (!r.fits(constValCnt, kIndexSize + kConstantValueSize))
+        return false;
+    for (std::uint32_t i = 0; i < constValCnt; ++i) {
+        auto node = readNode(r);
+        auto val = readConstantValue(r);
+        if (apply && node && val.isKnown())
+            semaModel->P->constValByNode_.emplace(node, val);
+    }
+    return r.ok();
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_SEMANTIC_MODEL_SNAPSHOT_H__
+#define PSYCHE_C_SEMANTIC_MODEL_SNAPSHOT_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+#include "../common/infra/Pimpl.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The SemanticModelSnapshot class.
+ *
+ * A serialized SemanticModel: its declarations, scopes, types, and
+ * the tables that map SyntaxNode(s) to them. A snapshot is keyed to the
+ * SyntaxTree from which the SemanticModel was computed; nodes are identified
+ * by their (preorder) position in that tree.
+ *
+ * A snapshot is restored in two parts, each one on demand: the declarations
+ * (alongside scopes and types) and the side tables (TypeInfo and Scope
+ * of nodes).
+ */
+class PSY_C_INTERNAL_API SemanticModelSnapshot
+{
+public:
+    ~SemanticModelSnapshot();
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelTester);
+
+    /**
+     * Take a snapshot of the given SemanticModel \c semaModel.
+     */
+    static std::string take(const SemanticModel* semaModel);
+
+    /**
+     * Open the snapshot \c data for the SyntaxTree \c tree; return \c nullptr
+     * if the snapshot doesn't match the tree.
+     */
+    static std::unique_ptr<SemanticModelSnapshot> open(const SyntaxTree* tree, std::string data);
+
+    /**
+     * Restore the declarations (and types) of \c this snapshot into \c semaModel;
+     * return \c false if the snapshot is malformed, in which case \c semaModel
+     * is left partially restored and must be discarded.
+     */
+    bool restoreDeclarations(SemanticModel* semaModel);
+    void restoreSideTables(SemanticModel* semaModel);
+
+    bool hasRestoredDeclarations() const;
+
+private:
+    DECL_PIMPL(SemanticModelSnapshot)
+    SemanticModelSnapshot(const SyntaxTree* tree, std::string data);
+    SemanticModelSnapshot(const SemanticModelSnapshot&) = delete;
+    SemanticModelSnapshot& operator=(const SemanticModelSnapshot&) = delete;
+};
+
+} // C
+} // psy
+
+#endif
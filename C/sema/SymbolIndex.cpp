@@ -0,0 +1,227 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SymbolIndex.h"
+
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <tuple>
+
+using namespace psy;
+using namespace C;
+
+struct SymbolIndex::SymbolIndexImpl
+{
+    struct Entry
+    {
+        std::string_view name_;
+        NameSpace ns_;
+        SymbolKind symK_;
+        const DeclarationSymbol* decl_;
+        const SyntaxTree* tree_;
+
+        bool operator<(const Entry& other) const
+        {
+            return std::tie(name_, ns_, symK_) < std::tie(other.name_, other.ns_, other.symK_);
+        }
+    };
+
+    /*
+     * The entries are sorted by name, then NameSpace, then SymbolKind. A name
+     * views the Identifier of its SyntaxTree, which outlives the entry.
+     */
+    std::vector<Entry> entries_;
+    mutable std::shared_mutex mutex_;
+
+    template <class PredT>
+    Declarations collect(std::string_view name, PredT pred) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto range = std::equal_range(
+                    entries_.begin(),
+                    entries_.end(),
+                    name,
+                    Compare());
+        Declarations decls;
+        for (auto it = range.first; it != range.second; ++it) {
+            if (pred(*it))
+                decls.push_back(it->decl_);
+        }
+        return decls;
+    }
+
+    struct Compare
+    {
+        bool operator()(const Entry& entry, std::string_view name) const { return entry.name_ < name; }
+        bool operator()(std::string_view name, const Entry& entry) const { return name < entry.name_; }
+    };
+};
+
+SymbolIndex::SymbolIndex()
+    : P(new SymbolIndexImpl)
+{}
+
+SymbolIndex::~SymbolIndex()
+{}
+
+void SymbolIndex::indexDeclarations(const SemanticModel* semaModel)
+{
+    auto tree = semaModel->syntaxTree();
+    std::vector<SymbolIndexImpl::Entry> entries;
+    for (auto decl : semaModel->declarations()) {
+        auto name = decl->denotingIdentifier();
+        // Anonymous declarations and untagged tags (with a synthetic tag) aren't indexed.
+        if (!name || !name->size() || name->c_str()[0] == '#')
+            continue;
+        entries.push_back({ std::string_view(name->c_str(), name->size()),
+                            decl->nameSpace(),
+                            decl->kind(),
+                            decl,
+                            tree });
+    }
+    std::stable_sort(entries.begin(), entries.end());
+
+    std::unique_lock<std::shared_mutex> lock(P->mutex_);
+    P->entries_.erase(
+            std::remove_if(P->entries_.begin(),
+                           P->entries_.end(),
+                           [tree] (const SymbolIndexImpl::Entry& entry) {
+                               return entry.tree_ == tree;
+                           }),
+            P->entries_.end());
+    auto mid = P->entries_.insert(P->entries_.end(), entries.begin(), entries.end());
+    std::inplace_merge(P->entries_.begin(), mid, P->entries_.end());
+}
+
+void SymbolIndex::discardDeclarations(const SyntaxTree* tree)
+{
+    std::unique_lock<std::shared_mutex> lock(P->mutex_);
+    P->entries_.erase(
+            std::remove_if(P->entries_.begin(),
+                           P->entries_.end(),
+                           [tree] (const SymbolIndexImpl::Entry& entry) {
+                               return entry.tree_ == tree;
+                           }),
+            P->entries_.end());
+}
+
+SymbolIndex::Declarations SymbolIndex::declarationsNamed(const std::string& name) const
+{
+    return P->collect(name, [] (const SymbolIndexImpl::Entry&) { return true; });
+}
+
+SymbolIndex::Declarations SymbolIndex::declarationsNamed(const std::string& name, NameSpace ns) const
+{
+    return P->collect(name, [ns] (const SymbolIndexImpl::Entry& entry) { return entry.ns_ == ns; });
+}
+
+SymbolIndex::Declarations SymbolIndex::declarationsNamed(const std::string& name, SymbolKind symK) const
+{
+    return P->collect(name, [symK] (const SymbolIndexImpl::Entry& entry) { return entry.symK_ == symK; });
+}
+
+SymbolIndex::Declarations SymbolIndex::declarationsWithNamePrefix(
+        const std::string& prefix,
+        std::size_t maxCount) const
+{
+    std::shared_lock<std::shared_mutex> lock(P->mutex_);
+    Declarations decls;
+    auto it = std::lower_bound(P->entries_.begin(),
+                               P->entries_.end(),
+                               std::string_view(prefix),
+                               SymbolIndexImpl::Compare());
+    for (; it != P->entries_.end() && decls.size() < maxCount; ++it) {
+        if (it->name_.compare(0, prefix.size(), prefix) != 0)
+            break;
+        decls.push_back(it->decl_);
+    }
+    return decls;
+}
+
+namespace
+{
+/*
+ * The cost of a fuzzy match of \p pattern in \p name: the position of the
+ * first matched character plus the number of gaps between matched characters;
+ * -1 if there's no match.
+ */
+int fuzzyMatchCost(const std::string& pattern, std::string_view name)
+{
+    int cost = 0;
+    std::size_t prevPos = 0;
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < pattern.size(); ++i) {
+        auto c = std::tolower(static_cast<unsigned char>(pattern[i]));
+        while (pos < name.size() && std::tolower(static_cast<unsigned char>(name[pos])) != c)
+            ++pos;
+        if (pos == name.size())
+            return -1;
+        if (i == 0)
+            cost += static_cast<int>(pos);
+        else if (pos != prevPos + 1)
+            ++cost;
+        prevPos = pos++;
+    }
+    return cost;
+}
+} // anonymous
+
+SymbolIndex::Declarations SymbolIndex::declarationsMatching(
+        const std::string& pattern,
+        std::size_t maxCount) const
+{
+    std::vector<std::pair<int, const SymbolIndexImpl::Entry*>> matches;
+    std::shared_lock<std::shared_mutex> lock(P->mutex_);
+    for (const auto& entry : P->entries_) {
+        auto cost = fuzzyMatchCost(pattern, entry.name_);
+        if (cost >= 0)
+            matches.emplace_back(cost, &entry);
+    }
+    std::stable_sort(matches.begin(),
+                     matches.end(),
+                     [] (const auto& a, const auto& b) {
+                         if (a.first != b.first)
+                             return a.first < b.first;
+                         return a.second->name_.size() < b.second->name_.size();
+                     });
+
+    Declarations decls;
+    for (const auto& match : matches) {
+        if (decls.size() == maxCount)
+            break;
+        decls.push_back(match.second->decl_);
+    }
+    return decls;
+}
+
+std::size_t SymbolIndex::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(P->mutex_);
+    return P->entries_.size();
+}
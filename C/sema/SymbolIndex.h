@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_SYMBOL_INDEX_H__
+#define PSYCHE_C_SYMBOL_INDEX_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "sema/NameSpace.h"
+#include "symbols/SymbolKind.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+#include "../common/infra/Pimpl.h"
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The SymbolIndex class.
+ *
+ * An index of the (named) DeclarationSymbols of the SyntaxTrees of a
+ * Compilation, keyed by name, NameSpace, and SymbolKind.
+ *
+ * The SymbolIndex is kept up to date as the SemanticModel of SyntaxTrees
+ * are computed and as SyntaxTrees are removed from the Compilation. Queries
+ * may be issued from multiple threads at once.
+ *
+ * \note Similar to:
+ * - \c Microsoft.CodeAnalysis.FindSymbols.SymbolFinder of Roslyn.
+ */
+class PSY_C_API SymbolIndex final
+{
+public:
+    ~SymbolIndex();
+
+    using Declarations = std::vector<const DeclarationSymbol*>;
+
+    //!@{
+    /**
+     * The DeclarationSymbols named \p name, optionally restricted to a NameSpace
+     * or to a SymbolKind.
+     */
+    Declarations declarationsNamed(const std::string& name) const;
+    Declarations declarationsNamed(const std::string& name, NameSpace ns) const;
+    Declarations declarationsNamed(const std::string& name, SymbolKind symK) const;
+    //!@}
+
+    /**
+     * The DeclarationSymbols whose name starts with \p prefix, ordered by name;
+     * at most \p maxCount are returned.
+     */
+    Declarations declarationsWithNamePrefix(
+            const std::string& prefix,
+            std::size_t maxCount = std::numeric_limits<std::size_t>::max()) const;
+
+    /**
+     * The DeclarationSymbols whose name matches \p pattern \a fuzzily: the
+     * characters of \p pattern must appear, case-insensitively and in the same
+     * order, in the name. The best matches (earliest and most contiguous) come
+     * first; at most \p maxCount are returned.
+     */
+    Declarations declarationsMatching(
+            const std::string& pattern,
+            std::size_t maxCount = std::numeric_limits<std::size_t>::max()) const;
+
+    /**
+     * The number of DeclarationSymbols in \c this SymbolIndex.
+     */
+    std::size_t size() const;
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+
+    SymbolIndex();
+    SymbolIndex(const SymbolIndex&) = delete;
+    SymbolIndex& operator=(const SymbolIndex&) = delete;
+
+    void indexDeclarations(const SemanticModel* semaModel);
+    void discardDeclarations(const SyntaxTree* tree);
+
+private:
+    DECL_PIMPL(SymbolIndex)
+};
+
+} // C
+} // psy
+
+#endif
@@ -159,6 +159,12 @@ SyntaxVisitor::Action TypeCanonicalizer::visitIdentifierDeclarator(
     return visitDeclarator_COMMON(node);
 }
 
+SyntaxVisitor::Action TypeCanonicalizer::visitAbstractDeclarator(
+        const AbstractDeclaratorSyntax* node)
+{
+    return visitDeclarator_COMMON(node);
+}
+
 const Type* TypeCanonicalizer::canonicalize(const Type* ty, const Scope* scope)
 {
     switch (ty->kind()) {
@@ -94,6 +94,7 @@ TypeChecker::TypeChecker(SemanticModel* semaModel, const SyntaxTree* tree)
     , uStrLitTy_(semaModel_->keepType(std::unique_ptr<ArrayType>(new ArrayType(char16Ty_))))
     , UStrLitTy_(semaModel_->keepType(std::unique_ptr<ArrayType>(new ArrayType(char32Ty_))))
     , LStrLitTy_(semaModel_->keepType(std::unique_ptr<ArrayType>(new ArrayType(wcharTy_))))
+    , lastEnumeratorDecl_(nullptr)
     , diagReporter_(this)
 {
 }
@@ -120,9 +121,13 @@ const Type* TypeChecker::unqualifiedAndResolved(const Type* ty)
             case TypeKind::Qualified:
                 ty = ty->asQualifiedType()->unqualifiedType();
                 break;
-            case TypeKind::TypedefName:
-                ty = ty->asTypedefNameType()->resolvedSynonymizedType();
+            case TypeKind::TypedefName: {
+                auto resolvedTy = ty->asTypedefNameType()->resolvedSynonymizedType();
+                if (!resolvedTy)
+                    return ty; // An unknown typedef name.
+                ty = resolvedTy;
                 break;
+            }
             default:
                 return ty;
         }
@@ -684,6 +689,77 @@ SyntaxVisitor::Action TypeChecker::visitFunctionDefinition(
     return Action::Visit;
 }
 
+SyntaxVisitor::Action TypeChecker::visitEnumeratorDeclaration(
+        const EnumeratorDeclarationSyntax* node)
+{
+    auto enumeratorDecl = semaModel_->enumeratorFor(node);
+    PSY_ASSERT_2(enumeratorDecl, return Action::Quit);
+
+    auto prevEnumeratorDecl = lastEnumeratorDecl_;
+    if (node->expression()) {
+        if (visit(node->expression()) == Action::Quit)
+            return Action::Quit;
+        enumeratorDecl->setValue(
+                    enumeratorValue(evaluateConstantExpression(node->expression())));
+    }
+    else if (prevEnumeratorDecl
+                && prevEnumeratorDecl->containingSymbol() == enumeratorDecl->containingSymbol()) {
+        // 6.7.2.2-3: The value follows from that of the previous enumerator.
+        enumeratorDecl->setValue(nextEnumeratorValue(prevEnumeratorDecl->value()));
+    }
+    else {
+        enumeratorDecl->setValue(ConstantValue(0, BasicTypeKind::Int_S));
+    }
+    lastEnumeratorDecl_ = enumeratorDecl;
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitStaticAssertDeclaration(
+        const StaticAssertDeclarationSyntax* node)
+{
+    if (visit(node->expression()) == Action::Quit)
+        return Action::Quit;
+    auto val = evaluateConstantExpression(node->expression());
+    if (val.isKnown() && val.isZero())
+        diagReporter_.StaticAssertionFailed(node->expression()->firstToken());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitBitfieldDeclarator(
+        const BitfieldDeclaratorSyntax* node)
+{
+    if (visit(node->expression()) == Action::Quit)
+        return Action::Quit;
+    auto decl = semaModel_->declarationBy(node);
+    PSY_ASSERT_2(decl && decl->kind() == SymbolKind::FieldDeclaration,
+                 return Action::Quit);
+    decl->asFieldDeclaration()->setBitWidth(
+                evaluateConstantExpression(node->expression()));
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeChecker::visitSubscriptSuffix(const SubscriptSuffixSyntax* node)
+{
+    if (!node->expression())
+        return Action::Skip;
+
+    if (visit(node->expression()) == Action::Quit)
+        return Action::Quit;
+    auto arrTy = semaModel_->arrayTypeOf(node);
+    if (!arrTy)
+        return Action::Skip;
+    auto val = evaluateConstantExpression(node->expression());
+    if (val.isKnown()
+            && (isUnsignedIntegerTypeKind(val.basicTypeKind()) || val.asSigned() >= 0)) {
+        arrTy->setSize(val.asUnsigned());
+    }
+
+    return Action::Skip;
+}
+
 SyntaxVisitor::Action TypeChecker::visitExtGNU_Attribute(const ExtGNU_AttributeSyntax*)
 {
     return Action::Quit;
@@ -806,6 +882,100 @@ BasicTypeKind selectTypeForValue(
 }
 } // anonymous
 
+BasicTypeKind TypeChecker::typeKindOfIntegerConstant(const IntegerConstant* intTk) const
+{
+    auto val = intTk->integerValue();
+    BasicTypeKind basicTyK;
+    switch (intTk->representationSuffix()) {
+        case IntegerConstant::RepresentationSuffix::None:
+            if (intTk->isOctalOrHexadecimal()) {
+                BasicTypeKind kinds[] = {BasicTypeKind::Int_S,
+                                         BasicTypeKind::Int_U,
+                                         BasicTypeKind::Long_S,
+                                         BasicTypeKind::Long_U,
+                                         BasicTypeKind::LongLong_S,
+                                         BasicTypeKind::LongLong_U};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            else {
+                BasicTypeKind kinds[] = {BasicTypeKind::Int_S,
+                                         BasicTypeKind::Long_S,
+                                         BasicTypeKind::LongLong_S};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            break;
+
+        case IntegerConstant::RepresentationSuffix::uOrU: {
+            BasicTypeKind kinds[] = {BasicTypeKind::Int_U,
+                                     BasicTypeKind::Long_U,
+                                     BasicTypeKind::LongLong_U};
+            basicTyK = selectTypeForValue(
+                        semaModel_->compilation()->platformOptions(),
+                        val,
+                        kinds);
+            break;
+        }
+        case IntegerConstant::RepresentationSuffix::lOrL:
+            if (intTk->isOctalOrHexadecimal()) {
+                BasicTypeKind kinds[] = {BasicTypeKind::Long_S,
+                                         BasicTypeKind::Long_U,
+                                         BasicTypeKind::LongLong_S,
+                                         BasicTypeKind::LongLong_U};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            else {
+                BasicTypeKind kinds[] = {BasicTypeKind::Long_S, BasicTypeKind::LongLong_S};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            break;
+
+        case IntegerConstant::RepresentationSuffix::lOrLAnduOrU: {
+            BasicTypeKind kinds[] = {BasicTypeKind::Long_U, BasicTypeKind::LongLong_U};
+            basicTyK = selectTypeForValue(
+                        semaModel_->compilation()->platformOptions(),
+                        val,
+                        kinds);
+            break;
+        }
+        case IntegerConstant::RepresentationSuffix::llOrLL:
+            if (intTk->isOctalOrHexadecimal()) {
+                BasicTypeKind kinds[] = {BasicTypeKind::LongLong_S, BasicTypeKind::LongLong_U};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            else {
+                BasicTypeKind kinds[] = {BasicTypeKind::LongLong_S};
+                basicTyK = selectTypeForValue(
+                            semaModel_->compilation()->platformOptions(),
+                            val,
+                            kinds);
+            }
+            break;
+        case IntegerConstant::RepresentationSuffix::llOrLLAnduOrU:
+            BasicTypeKind kinds[] = {BasicTypeKind::LongLong_U};
+            basicTyK = selectTypeForValue(
+                        semaModel_->compilation()->platformOptions(),
+                        val,
+                        kinds);
+            break;
+    }
+    return basicTyK;
+}
+
 SyntaxVisitor::Action TypeChecker::visitConstantExpression(const ConstantExpressionSyntax* node)
 {
     const Type* ty = nullptr;
@@ -813,101 +983,9 @@ SyntaxVisitor::Action TypeChecker::visitConstantExpression(const ConstantExpress
     switch (constantTk->kind()) {
         case Lexeme::LexemeKind::IntegerConstant: {
             auto intTk = constantTk->asIntegerConstant();
-            unsigned long long val;
-            try {
-                val = std::stoull(intTk->valueText(), nullptr, 0);
-            }
-            catch (const std::exception&) {
+            if (intTk->overflows())
                 return Action::Quit;
-            }
-            BasicTypeKind basicTyK;
-            switch (intTk->representationSuffix()) {
-                case IntegerConstant::RepresentationSuffix::None:
-                    if (intTk->isOctalOrHexadecimal()) {
-                        BasicTypeKind kinds[] = {BasicTypeKind::Int_S,
-                                                 BasicTypeKind::Int_U,
-                                                 BasicTypeKind::Long_S,
-                                                 BasicTypeKind::Long_U,
-                                                 BasicTypeKind::LongLong_S,
-                                                 BasicTypeKind::LongLong_U};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    else {
-                        BasicTypeKind kinds[] = {BasicTypeKind::Int_S,
-                                                 BasicTypeKind::Long_S,
-                                                 BasicTypeKind::LongLong_S};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    break;
-
-                case IntegerConstant::RepresentationSuffix::uOrU: {
-                    BasicTypeKind kinds[] = {BasicTypeKind::Int_U,
-                                             BasicTypeKind::Long_U,
-                                             BasicTypeKind::LongLong_U};
-                    basicTyK = selectTypeForValue(
-                                semaModel_->compilation()->platformOptions(),
-                                val,
-                                kinds);
-                    break;
-                }
-                case IntegerConstant::RepresentationSuffix::lOrL:
-                    if (intTk->isOctalOrHexadecimal()) {
-                        BasicTypeKind kinds[] = {BasicTypeKind::Long_S,
-                                                 BasicTypeKind::Long_U,
-                                                 BasicTypeKind::LongLong_S,
-                                                 BasicTypeKind::LongLong_U};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    else {
-                        BasicTypeKind kinds[] = {BasicTypeKind::Long_S, BasicTypeKind::LongLong_S};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    break;
-
-                case IntegerConstant::RepresentationSuffix::lOrLAnduOrU: {
-                    BasicTypeKind kinds[] = {BasicTypeKind::Long_U, BasicTypeKind::LongLong_U};
-                    basicTyK = selectTypeForValue(
-                                semaModel_->compilation()->platformOptions(),
-                                val,
-                                kinds);
-                    break;
-                }
-                case IntegerConstant::RepresentationSuffix::llOrLL:
-                    if (intTk->isOctalOrHexadecimal()) {
-                        BasicTypeKind kinds[] = {BasicTypeKind::LongLong_S, BasicTypeKind::LongLong_U};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    else {
-                        BasicTypeKind kinds[] = {BasicTypeKind::LongLong_S};
-                        basicTyK = selectTypeForValue(
-                                    semaModel_->compilation()->platformOptions(),
-                                    val,
-                                    kinds);
-                    }
-                    break;
-                case IntegerConstant::RepresentationSuffix::llOrLLAnduOrU:
-                    BasicTypeKind kinds[] = {BasicTypeKind::LongLong_U};
-                    basicTyK = selectTypeForValue(
-                                semaModel_->compilation()->platformOptions(),
-                                val,
-                                kinds);
-                    break;
-            }
+            auto basicTyK = typeKindOfIntegerConstant(intTk);
             ty =  semaModel_->compilation()->canonicalBasicType(basicTyK);
             break;
         }
@@ -1184,6 +1262,7 @@ SyntaxVisitor::Action TypeChecker::visitMemberAccessExpression(
         diagReporter_.UnknownMemberOfTag(node->memberName()->lastToken());
         return typeCheckError(node);
     }
+    semaModel_->addReference(membDecl, node->memberName());
     return typeChecked(node, membDecl->type());
 }
 
@@ -1292,7 +1371,7 @@ SyntaxVisitor::Action TypeChecker::visitCallExpression(
     std::vector<std::pair<const Type*, const ExpressionSyntax*>> argTysWithNode;
     for (auto iter = node->arguments(); iter; iter = iter->next) {
         VISIT(iter->value);
-        argTysWithNode.push_back(std::make_pair(ty_, iter->value));
+        argTysWithNode.push_back(std::make_pair(unqualifiedAndResolved(ty_), iter->value));
     }
     const auto& parmTys = funcTy->parameterTypes();
     switch (funcTy->parameterListForm()) {
@@ -1316,7 +1395,7 @@ SyntaxVisitor::Action TypeChecker::visitCallExpression(
             }
             auto parmTyIdx = 0U;
             for (; parmTyIdx < parmTys.size(); ++parmTyIdx) {
-                auto parmTy = parmTys[parmTyIdx];
+                auto parmTy = unqualifiedAndResolved(parmTys[parmTyIdx]);
                 auto argTyWithNode = argTysWithNode[parmTyIdx];
                 if (!isTypeAssignableFromOtherType(
                         parmTy,
@@ -1342,7 +1421,23 @@ SyntaxVisitor::Action TypeChecker::visitCallExpression(
 }
 
 SyntaxVisitor::Action TypeChecker::visitVAArgumentExpression(const VAArgumentExpressionSyntax*) { return Action::Skip; }
-SyntaxVisitor::Action TypeChecker::visitOffsetOfExpression(const OffsetOfExpressionSyntax*) { return Action::Skip; }
+SyntaxVisitor::Action TypeChecker::visitOffsetOfExpression(
+        const OffsetOfExpressionSyntax* node)
+{
+    VISIT(node->typeName());
+    auto offsetOfDesig = node->offsetOfDesignator()->asOffsetOfDesignator();
+    PSY_ASSERT_2(offsetOfDesig, return Action::Quit);
+    for (auto desigIt = offsetOfDesig->designators();
+            desigIt;
+            desigIt = desigIt->next) {
+        if (desigIt->value->kind() != SyntaxKind::ArrayDesignator)
+            continue;
+        VISIT(desigIt->value->asArrayDesignator()->expression());
+    }
+
+    return typeChecked(node, sizeTy_);
+}
+
 SyntaxVisitor::Action TypeChecker::visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax*) { return Action::Skip; }
 
 SyntaxVisitor::Action TypeChecker::visitBinaryExpression(const BinaryExpressionSyntax* node)
@@ -1614,6 +1709,13 @@ bool TypeChecker::isTypeAssignableFromOtherType(
 SyntaxVisitor::Action TypeChecker::visitSequencingExpression(const SequencingExpressionSyntax*) { return Action::Skip; }
 SyntaxVisitor::Action TypeChecker::visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax*) { return Action::Skip; }
 
+SyntaxVisitor::Action TypeChecker::visitAmbiguousCastOrBinaryExpression(
+        const AmbiguousCastOrBinaryExpressionSyntax* node)
+{
+    // An ambiguity that persists (and is diagnosed as such) can't be type checked.
+    return typeCheckError(node);
+}
+
 //------------//
 // Statements //
 //------------//
@@ -23,6 +23,7 @@
 
 #include "API.h"
 
+#include "sema/ConstantValue.h"
 #include "sema/TypeInfo.h"
 #include "syntax/Lexeme_StringLiteral.h"
 #include "syntax/SyntaxVisitor.h"
@@ -64,6 +65,7 @@ private:
     const Type* uStrLitTy_;
     const Type* UStrLitTy_;
     const Type* LStrLitTy_;
+    const EnumeratorDeclarationSymbol* lastEnumeratorDecl_;
 
     struct DiagnosticsReporter
     {
@@ -97,6 +99,7 @@ private:
         void ConversionBetweenIntegerAndPointerTypesInAssignment(SyntaxToken tk);
         void TooFewArgumentsToFunctionCall(SyntaxToken tk);
         void TooManyArgumentsToFunctionCall(SyntaxToken tk);
+        void StaticAssertionFailed(SyntaxToken tk);
 
         static const std::string ID_of_InvalidOperator;
         static const std::string ID_of_ExpectedExpressionOfArithmeticType;
@@ -117,6 +120,7 @@ private:
         static const std::string ID_of_ConversionBetweenIntegerAndPointerTypesInAssignment;
         static const std::string ID_of_TooFewArgumentsToFunctionCall;
         static const std::string ID_of_TooManyArgumentsToFunctionCall;
+        static const std::string ID_of_StaticAssertionFailed;
     };
     DiagnosticsReporter diagReporter_;
 
@@ -126,6 +130,12 @@ private:
 
     virtual Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
     virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+    virtual Action visitEnumeratorDeclaration(const EnumeratorDeclarationSyntax*) override;
+    virtual Action visitStaticAssertDeclaration(const StaticAssertDeclarationSyntax*) override;
+
+    /* Declarators */
+    virtual Action visitBitfieldDeclarator(const BitfieldDeclaratorSyntax*) override;
+    virtual Action visitSubscriptSuffix(const SubscriptSuffixSyntax*) override;
 
     /* Specifiers */
     virtual Action visitExtGNU_Attribute(const ExtGNU_AttributeSyntax*) override;
@@ -160,6 +170,7 @@ private:
     virtual Action visitAssignmentExpression(const AssignmentExpressionSyntax*) override;
     virtual Action visitSequencingExpression(const SequencingExpressionSyntax*) override;
     virtual Action visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax*) override;
+    virtual Action visitAmbiguousCastOrBinaryExpression(const AmbiguousCastOrBinaryExpressionSyntax*) override;
 
     /* Binary-like expressions */
     template <class BinaryLikeExprNodeT>
@@ -208,6 +219,21 @@ private:
             const Type* leftTy,
             const Type* rightTy);
 
+    /* Constant expressions */
+    ConstantValue evaluateConstantExpression(const ExpressionSyntax* node);
+    ConstantValue evaluateConstantExpression_CORE(const ExpressionSyntax* node);
+    ConstantValue evaluateUnaryOperation(const PrefixUnaryExpressionSyntax* node);
+    ConstantValue evaluateBinaryOperation(const BinaryExpressionSyntax* node);
+    ConstantValue evaluateConditionalOperation(const ConditionalExpressionSyntax* node);
+    ConstantValue valueOfConstant(const ConstantExpressionSyntax* node);
+    ConstantValue valueOfIdentifier(const IdentifierNameSyntax* node);
+    ConstantValue valueOfTypeTrait(const TypeTraitExpressionSyntax* node);
+    ConstantValue valueOfOffsetOf(const OffsetOfExpressionSyntax* node);
+    ConstantValue convertedConstantValue(ConstantValue val, BasicTypeKind basicTyK) const;
+    ConstantValue enumeratorValue(ConstantValue val) const;
+    ConstantValue nextEnumeratorValue(ConstantValue prevVal) const;
+    const BasicType* integerTypeOf(const SyntaxNode* node);
+
     //------------//
     // Statements //
     //------------//
@@ -231,6 +257,7 @@ private:
     static const Type* unqualifiedAndResolved(const Type* ty);
 
     const Type* typeOfStringLiteral(StringLiteral::EncodingPrefix encodingSuffix);
+    BasicTypeKind typeKindOfIntegerConstant(const IntegerConstant* intTk) const;
 
     void determineParameterListForm(FunctionDeclarationSymbol* func);
 
@@ -0,0 +1,721 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeChecker.h"
+
+#include "sema/Compilation.h"
+#include "sema/PlatformOptions.h"
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxUtilities.h"
+#include "types/Type_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <cctype>
+#include <cstring>
+#include <limits>
+
+using namespace psy;
+using namespace C;
+
+namespace
+{
+PlatformOptions::ArithmeticIntegerType arithmeticIntegerTypeOf(BasicTypeKind basicTyK)
+{
+    switch (basicTyK) {
+        case BasicTypeKind::Char:
+            return PlatformOptions::ArithmeticIntegerType::Char;
+        case BasicTypeKind::Char_S:
+            return PlatformOptions::ArithmeticIntegerType::Char_S;
+        case BasicTypeKind::Char_U:
+            return PlatformOptions::ArithmeticIntegerType::Char_U;
+        case BasicTypeKind::Short_S:
+            return PlatformOptions::ArithmeticIntegerType::Short_S;
+        case BasicTypeKind::Short_U:
+            return PlatformOptions::ArithmeticIntegerType::Short_U;
+        case BasicTypeKind::Int_S:
+            return PlatformOptions::ArithmeticIntegerType::Int_S;
+        case BasicTypeKind::Int_U:
+            return PlatformOptions::ArithmeticIntegerType::Int_U;
+        case BasicTypeKind::Long_S:
+            return PlatformOptions::ArithmeticIntegerType::Long_S;
+        case BasicTypeKind::Long_U:
+            return PlatformOptions::ArithmeticIntegerType::Long_U;
+        case BasicTypeKind::LongLong_S:
+            return PlatformOptions::ArithmeticIntegerType::LongLong_S;
+        case BasicTypeKind::LongLong_U:
+            return PlatformOptions::ArithmeticIntegerType::LongLong_U;
+        case BasicTypeKind::Bool:
+            return PlatformOptions::ArithmeticIntegerType::Bool;
+        default:
+            PSY_ASSERT_1(false);
+            return PlatformOptions::ArithmeticIntegerType::Int_S;
+    }
+}
+
+bool isSignedTypeKind(const PlatformOptions& platfOpts, BasicTypeKind basicTyK)
+{
+    if (basicTyK == BasicTypeKind::Char)
+        return platfOpts.maxValueOf(PlatformOptions::ArithmeticIntegerType::Char)
+                == platfOpts.maxValueOf(PlatformOptions::ArithmeticIntegerType::Char_S);
+    return isSignedIntegerTypeKind(basicTyK);
+}
+
+/*
+ * The width of an integer type isn't part of the PlatformOptions;
+ * it's derived from the type's maximum value.
+ */
+unsigned int widthOf(const PlatformOptions& platfOpts, BasicTypeKind basicTyK)
+{
+    auto max = platfOpts.maxValueOf(arithmeticIntegerTypeOf(basicTyK));
+    unsigned int w = 0;
+    for (; max; max >>= 1)
+        ++w;
+    return isSignedTypeKind(platfOpts, basicTyK) ? w + 1 : w;
+}
+
+/**
+ * \remark 6.3.1.1-1
+ */
+int rankOf(BasicTypeKind basicTyK)
+{
+    switch (basicTyK) {
+        case BasicTypeKind::Bool:
+            return 0;
+        case BasicTypeKind::Char:
+        case BasicTypeKind::Char_S:
+        case BasicTypeKind::Char_U:
+            return 1;
+        case BasicTypeKind::Short_S:
+        case BasicTypeKind::Short_U:
+            return 2;
+        case BasicTypeKind::Int_S:
+        case BasicTypeKind::Int_U:
+            return 3;
+        case BasicTypeKind::Long_S:
+        case BasicTypeKind::Long_U:
+            return 4;
+        default:
+            return 5;
+    }
+}
+
+BasicTypeKind unsignedTypeKindOf(BasicTypeKind basicTyK)
+{
+    switch (basicTyK) {
+        case BasicTypeKind::Char:
+        case BasicTypeKind::Char_S:
+            return BasicTypeKind::Char_U;
+        case BasicTypeKind::Short_S:
+            return BasicTypeKind::Short_U;
+        case BasicTypeKind::Int_S:
+            return BasicTypeKind::Int_U;
+        case BasicTypeKind::Long_S:
+            return BasicTypeKind::Long_U;
+        case BasicTypeKind::LongLong_S:
+            return BasicTypeKind::LongLong_U;
+        default:
+            return basicTyK;
+    }
+}
+
+/**
+ * \remark 6.3.1.1-2
+ */
+BasicTypeKind promotedTypeKind(const PlatformOptions& platfOpts, BasicTypeKind basicTyK)
+{
+    if (rankOf(basicTyK) >= rankOf(BasicTypeKind::Int_S))
+        return basicTyK;
+    auto w = widthOf(platfOpts, basicTyK);
+    auto intW = widthOf(platfOpts, BasicTypeKind::Int_S);
+    if (isSignedTypeKind(platfOpts, basicTyK) ? w <= intW : w < intW)
+        return BasicTypeKind::Int_S;
+    return BasicTypeKind::Int_U;
+}
+
+/**
+ * \remark 6.3.1.8-1
+ */
+BasicTypeKind commonTypeKind(const PlatformOptions& platfOpts,
+                             BasicTypeKind leftTyK,
+                             BasicTypeKind rightTyK)
+{
+    leftTyK = promotedTypeKind(platfOpts, leftTyK);
+    rightTyK = promotedTypeKind(platfOpts, rightTyK);
+    if (leftTyK == rightTyK)
+        return leftTyK;
+
+    auto leftIsSigned = isSignedTypeKind(platfOpts, leftTyK);
+    if (leftIsSigned == isSignedTypeKind(platfOpts, rightTyK))
+        return rankOf(leftTyK) >= rankOf(rightTyK) ? leftTyK : rightTyK;
+
+    auto signedTyK = leftIsSigned ? leftTyK : rightTyK;
+    auto unsignedTyK = leftIsSigned ? rightTyK : leftTyK;
+    if (rankOf(unsignedTyK) >= rankOf(signedTyK))
+        return unsignedTyK;
+    if (widthOf(platfOpts, signedTyK) > widthOf(platfOpts, unsignedTyK))
+        return signedTyK;
+    return unsignedTypeKindOf(signedTyK);
+}
+
+/**
+ * \remark 6.4.4.4
+ */
+unsigned long long decodeCharacter(const char* chars)
+{
+    auto p = std::strchr(chars, '\'');
+    if (!p)
+        return 0;
+    ++p;
+    if (*p != '\\')
+        return static_cast<unsigned char>(*p);
+
+    ++p;
+    switch (*p) {
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'r': return '\r';
+        case 'a': return '\a';
+        case 'b': return '\b';
+        case 'f': return '\f';
+        case 'v': return '\v';
+        case 'e': return 27; // GNU
+        case 'x': {
+            unsigned long long v = 0;
+            for (++p; std::isxdigit(static_cast<unsigned char>(*p)); ++p)
+                v = v * 16 + (std::isdigit(static_cast<unsigned char>(*p))
+                                ? *p - '0'
+                                : std::tolower(static_cast<unsigned char>(*p)) - 'a' + 10);
+            return v;
+        }
+        default:
+            if (*p >= '0' && *p <= '7') {
+                unsigned long long v = 0;
+                for (int i = 0; i < 3 && *p >= '0' && *p <= '7'; ++i, ++p)
+                    v = v * 8 + (*p - '0');
+                return v;
+            }
+            return static_cast<unsigned char>(*p);
+    }
+}
+
+/*
+ * The field by the given name, looked up through anonymous structures
+ * and unions; the offset, in bits, of the field is added to \p bitOffset.
+ */
+const FieldDeclarationSymbol* lookUpField(
+        const Compilation* compilation,
+        const TagDeclarationSymbol* tagTyDecl,
+        const Identifier* name,
+        unsigned long long& bitOffset)
+{
+    if (!tagTyDecl->asStructOrUnionDeclaration())
+        return nullptr;
+    for (auto fld : tagTyDecl->asStructOrUnionDeclaration()->fields()) {
+        if (fld->name() == name || *fld->name() == *name) {
+            auto fldLayout = compilation->layoutOf(fld);
+            if (!fldLayout.isKnown())
+                return nullptr;
+            bitOffset += fldLayout.offsetInBits();
+            return fld;
+        }
+    }
+    for (auto fld : tagTyDecl->asStructOrUnionDeclaration()->fields()) {
+        if (!fld->isAnonymousStructureOrUnion()
+                || !fld->type()->asTagType()->declaration()) {
+            continue;
+        }
+        auto innerBitOffset = bitOffset;
+        auto innerFld = lookUpField(compilation,
+                                    fld->type()->asTagType()->declaration(),
+                                    name,
+                                    innerBitOffset);
+        if (!innerFld)
+            continue;
+        auto fldLayout = compilation->layoutOf(fld);
+        if (!fldLayout.isKnown())
+            return nullptr;
+        bitOffset = innerBitOffset + fldLayout.offsetInBits();
+        return innerFld;
+    }
+    return nullptr;
+}
+} // anonymous
+
+/**
+ * \remark 6.5.3.4-2 and 6.5.3.4-3
+ */
+ConstantValue TypeChecker::valueOfTypeTrait(const TypeTraitExpressionSyntax* node)
+{
+    const SyntaxNode* tyNode = nullptr;
+    switch (node->tyReference()->kind()) {
+        case SyntaxKind::ExpressionAsTypeReference:
+            tyNode = node->tyReference()->asExpressionAsTypeReference()->expression();
+            break;
+        case SyntaxKind::TypeNameAsTypeReference:
+            tyNode = node->tyReference()->asTypeNameAsTypeReference()->typeName();
+            break;
+        default:
+            return ConstantValue();
+    }
+    auto ty = semaModel_->typeInfoOf_CORE(tyNode).type();
+    auto sizeTy = unqualifiedAndResolved(sizeTy_);
+    if (!ty || sizeTy->kind() != TypeKind::Basic)
+        return ConstantValue();
+
+    auto tyLayout = semaModel_->compilation()->layoutOf(ty);
+    auto sizeTyK = sizeTy->asBasicType()->kind();
+    switch (node->kind()) {
+        case SyntaxKind::SizeofExpression:
+            if (!tyLayout.hasKnownSize())
+                return ConstantValue();
+            return ConstantValue(tyLayout.size(), sizeTyK);
+        case SyntaxKind::AlignofExpression:
+            if (!tyLayout.hasKnownAlignment())
+                return ConstantValue();
+            return ConstantValue(tyLayout.alignment(), sizeTyK);
+        default:
+            PSY_ASSERT_1(false);
+            return ConstantValue();
+    }
+}
+
+/**
+ * \remark 7.19-3
+ */
+ConstantValue TypeChecker::valueOfOffsetOf(const OffsetOfExpressionSyntax* node)
+{
+    auto ty = semaModel_->typeInfoOf_CORE(node->typeName()).type();
+    auto sizeTy = unqualifiedAndResolved(sizeTy_);
+    auto offsetOfDesig = node->offsetOfDesignator()->asOffsetOfDesignator();
+    if (!ty || sizeTy->kind() != TypeKind::Basic || !offsetOfDesig)
+        return ConstantValue();
+
+    auto compilation = semaModel_->compilation();
+    unsigned long long bitOffset = 0;
+    auto designateField = [&] (SyntaxToken identTk) -> bool {
+        ty = unqualifiedAndResolved(ty);
+        if (ty->kind() != TypeKind::Tag
+                || !ty->asTagType()->declaration()
+                || !identTk.lexeme()) {
+            return false;
+        }
+        auto fld = lookUpField(compilation,
+                               ty->asTagType()->declaration(),
+                               identTk.lexeme()->asIdentifier(),
+                               bitOffset);
+        // The member designator shall not specify a bit-field.
+        if (!fld || fld->isBitField())
+            return false;
+        ty = fld->type();
+        return true;
+    };
+
+    if (!designateField(offsetOfDesig->identifierToken()))
+        return ConstantValue();
+    for (auto desigIt = offsetOfDesig->designators(); desigIt; desigIt = desigIt->next) {
+        auto desig = desigIt->value;
+        switch (desig->kind()) {
+            case SyntaxKind::FieldDesignator:
+                if (!designateField(desig->asFieldDesignator()->identifierToken()))
+                    return ConstantValue();
+                break;
+
+            case SyntaxKind::ArrayDesignator: {
+                ty = unqualifiedAndResolved(ty);
+                if (ty->kind() != TypeKind::Array)
+                    return ConstantValue();
+                ty = ty->asArrayType()->elementType();
+                auto idx = evaluateConstantExpression(desig->asArrayDesignator()->expression());
+                auto elemTyLayout = compilation->layoutOf(ty);
+                if (!idx.isKnown() || !elemTyLayout.hasKnownSize())
+                    return ConstantValue();
+                bitOffset += idx.asUnsigned() * elemTyLayout.size() * 8;
+                break;
+            }
+
+            default:
+                return ConstantValue();
+        }
+    }
+    return convertedConstantValue(ConstantValue(bitOffset / 8, sizeTy->asBasicType()->kind()),
+                                  sizeTy->asBasicType()->kind());
+}
+
+ConstantValue TypeChecker::convertedConstantValue(ConstantValue val, BasicTypeKind basicTyK) const
+{
+    if (!val.isKnown())
+        return val;
+
+    if (basicTyK == BasicTypeKind::Bool)
+        return ConstantValue(val.asUnsigned() != 0, basicTyK);
+
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    auto w = widthOf(platfOpts, basicTyK);
+    auto bits = val.asUnsigned();
+    if (w < std::numeric_limits<unsigned long long>::digits) {
+        auto mask = (1ULL << w) - 1;
+        bits &= mask;
+        if (isSignedTypeKind(platfOpts, basicTyK) && ((bits >> (w - 1)) & 1))
+            bits |= ~mask;
+    }
+    return ConstantValue(bits, basicTyK);
+}
+
+const BasicType* TypeChecker::integerTypeOf(const SyntaxNode* node)
+{
+    auto ty = semaModel_->typeInfoOf_CORE(node).type();
+    if (!ty)
+        return nullptr;
+    ty = unqualifiedAndResolved(ty);
+    if (ty->kind() != TypeKind::Basic
+            || !isIntegerTypeKind(ty->asBasicType()->kind())) {
+        return nullptr;
+    }
+    return ty->asBasicType();
+}
+
+ConstantValue TypeChecker::evaluateConstantExpression(const ExpressionSyntax* node)
+{
+    if (!node)
+        return ConstantValue();
+
+    auto val = semaModel_->constantValueOf(node);
+    if (val.isKnown())
+        return val;
+
+    val = evaluateConstantExpression_CORE(node);
+    if (val.isKnown())
+        semaModel_->setConstantValueOf(node, val);
+    return val;
+}
+
+ConstantValue TypeChecker::evaluateConstantExpression_CORE(const ExpressionSyntax* node)
+{
+    switch (node->kind()) {
+        case SyntaxKind::IntegerConstantExpression:
+        case SyntaxKind::CharacterConstantExpression:
+            return valueOfConstant(node->asConstantExpression());
+
+        case SyntaxKind::IdentifierName:
+            return valueOfIdentifier(node->asIdentifierName());
+
+        case SyntaxKind::ParenthesizedExpression:
+            return evaluateConstantExpression(
+                        node->asParenthesizedExpression()->expression());
+
+        case SyntaxKind::UnaryPlusExpression:
+        case SyntaxKind::UnaryMinusExpression:
+        case SyntaxKind::BitwiseNotExpression:
+        case SyntaxKind::LogicalNotExpression:
+            return evaluateUnaryOperation(node->asPrefixUnaryExpression());
+
+        case SyntaxKind::MultiplyExpression:
+        case SyntaxKind::DivideExpression:
+        case SyntaxKind::ModuleExpression:
+        case SyntaxKind::AddExpression:
+        case SyntaxKind::SubstractExpression:
+        case SyntaxKind::LeftShiftExpression:
+        case SyntaxKind::RightShiftExpression:
+        case SyntaxKind::LessThanExpression:
+        case SyntaxKind::LessThanOrEqualExpression:
+        case SyntaxKind::GreaterThanExpression:
+        case SyntaxKind::GreaterThanOrEqualExpression:
+        case SyntaxKind::EqualsExpression:
+        case SyntaxKind::NotEqualsExpression:
+        case SyntaxKind::BitwiseANDExpression:
+        case SyntaxKind::BitwiseXORExpression:
+        case SyntaxKind::BitwiseORExpression:
+        case SyntaxKind::LogicalANDExpression:
+        case SyntaxKind::LogicalORExpression:
+            return evaluateBinaryOperation(node->asBinaryExpression());
+
+        case SyntaxKind::ConditionalExpression:
+            return evaluateConditionalOperation(node->asConditionalExpression());
+
+        case SyntaxKind::CastExpression: {
+            auto castExpr = node->asCastExpression();
+            auto val = evaluateConstantExpression(castExpr->expression());
+            auto basicTy = integerTypeOf(castExpr);
+            if (!basicTy)
+                return ConstantValue();
+            return convertedConstantValue(val, basicTy->kind());
+        }
+
+        case SyntaxKind::SizeofExpression:
+        case SyntaxKind::AlignofExpression:
+            return valueOfTypeTrait(node->asTypeTraitExpression());
+
+        case SyntaxKind::OffsetOfExpression:
+            return valueOfOffsetOf(node->asOffsetOfExpression());
+
+        default:
+            return ConstantValue();
+    }
+}
+
+ConstantValue TypeChecker::valueOfConstant(const ConstantExpressionSyntax* node)
+{
+    auto constantTk = node->constantToken().lexeme();
+    if (!constantTk)
+        return ConstantValue();
+
+    switch (constantTk->kind()) {
+        case Lexeme::LexemeKind::IntegerConstant: {
+            auto intTk = constantTk->asIntegerConstant();
+            if (intTk->overflows())
+                return ConstantValue();
+            auto basicTyK = typeKindOfIntegerConstant(intTk);
+            return convertedConstantValue(ConstantValue(intTk->integerValue(), basicTyK), basicTyK);
+        }
+
+        case Lexeme::LexemeKind::CharacterConstant: {
+            auto charTk = constantTk->asCharacterConstant();
+            auto v = decodeCharacter(charTk->c_str());
+            const Type* ty = nullptr;
+            switch (charTk->encodingPrefix()) {
+                case CharacterConstant::EncodingPrefix::None: {
+                    // 6.4.4.4-10: An integer character constant has type int,
+                    // and its value is that of a char converted to int.
+                    auto val = convertedConstantValue(ConstantValue(v, BasicTypeKind::Char),
+                                                      BasicTypeKind::Char);
+                    return convertedConstantValue(val, BasicTypeKind::Int_S);
+                }
+                case CharacterConstant::EncodingPrefix::u:
+                    ty = char16Ty_;
+                    break;
+                case CharacterConstant::EncodingPrefix::U:
+                    ty = char32Ty_;
+                    break;
+                case CharacterConstant::EncodingPrefix::L:
+                    ty = wcharTy_;
+                    break;
+            }
+            ty = unqualifiedAndResolved(ty);
+            if (ty->kind() != TypeKind::Basic)
+                return ConstantValue();
+            auto basicTyK = ty->asBasicType()->kind();
+            return convertedConstantValue(ConstantValue(v, basicTyK), basicTyK);
+        }
+
+        default:
+            return ConstantValue();
+    }
+}
+
+ConstantValue TypeChecker::valueOfIdentifier(const IdentifierNameSyntax* node)
+{
+    auto scope = semaModel_->scopeOf(node);
+    if (!scope)
+        return ConstantValue();
+    auto decl = scope->searchForDeclaration(
+                identifierFrom(node),
+                NameSpace::OrdinaryIdentifiers);
+    if (!decl || decl->kind() != SymbolKind::EnumeratorDeclaration)
+        return ConstantValue();
+    return decl->asEnumeratorDeclaration()->value();
+}
+
+ConstantValue TypeChecker::evaluateUnaryOperation(const PrefixUnaryExpressionSyntax* node)
+{
+    auto val = evaluateConstantExpression(node->expression());
+    if (!val.isKnown())
+        return val;
+
+    if (node->kind() == SyntaxKind::LogicalNotExpression)
+        return ConstantValue(val.isZero(), BasicTypeKind::Int_S);
+
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    auto tyK = promotedTypeKind(platfOpts, val.basicTypeKind());
+    val = convertedConstantValue(val, tyK);
+    switch (node->kind()) {
+        case SyntaxKind::UnaryPlusExpression:
+            return val;
+        case SyntaxKind::UnaryMinusExpression:
+            return convertedConstantValue(ConstantValue(0 - val.asUnsigned(), tyK), tyK);
+        case SyntaxKind::BitwiseNotExpression:
+            return convertedConstantValue(ConstantValue(~val.asUnsigned(), tyK), tyK);
+        default:
+            PSY_ASSERT_1(false);
+            return ConstantValue();
+    }
+}
+
+ConstantValue TypeChecker::evaluateBinaryOperation(const BinaryExpressionSyntax* node)
+{
+    auto leftVal = evaluateConstantExpression(node->left());
+    switch (node->kind()) {
+        case SyntaxKind::LogicalANDExpression:
+            if (leftVal.isZero())
+                return ConstantValue(0, BasicTypeKind::Int_S);
+            break;
+        case SyntaxKind::LogicalORExpression:
+            if (leftVal.isKnown() && !leftVal.isZero())
+                return ConstantValue(1, BasicTypeKind::Int_S);
+            break;
+        default:
+            break;
+    }
+
+    auto rightVal = evaluateConstantExpression(node->right());
+    if (!leftVal.isKnown() || !rightVal.isKnown())
+        return ConstantValue();
+
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    switch (node->kind()) {
+        case SyntaxKind::LogicalANDExpression:
+        case SyntaxKind::LogicalORExpression:
+            return ConstantValue(!rightVal.isZero(), BasicTypeKind::Int_S);
+
+        case SyntaxKind::LeftShiftExpression:
+        case SyntaxKind::RightShiftExpression: {
+            // 6.5.7-3: The type of the result is that of the promoted left operand.
+            auto tyK = promotedTypeKind(platfOpts, leftVal.basicTypeKind());
+            if ((isSignedTypeKind(platfOpts, rightVal.basicTypeKind()) && rightVal.asSigned() < 0)
+                    || rightVal.asUnsigned() >= widthOf(platfOpts, tyK)) {
+                return ConstantValue();
+            }
+            leftVal = convertedConstantValue(leftVal, tyK);
+            auto n = rightVal.asUnsigned();
+            if (node->kind() == SyntaxKind::LeftShiftExpression)
+                return convertedConstantValue(ConstantValue(leftVal.asUnsigned() << n, tyK), tyK);
+            if (isSignedTypeKind(platfOpts, tyK))
+                return ConstantValue(static_cast<unsigned long long>(leftVal.asSigned() >> n), tyK);
+            return ConstantValue(leftVal.asUnsigned() >> n, tyK);
+        }
+
+        default:
+            break;
+    }
+
+    auto tyK = commonTypeKind(platfOpts, leftVal.basicTypeKind(), rightVal.basicTypeKind());
+    leftVal = convertedConstantValue(leftVal, tyK);
+    rightVal = convertedConstantValue(rightVal, tyK);
+    auto isSigned = isSignedTypeKind(platfOpts, tyK);
+    auto l = leftVal.asUnsigned();
+    auto r = rightVal.asUnsigned();
+
+    switch (node->kind()) {
+        case SyntaxKind::MultiplyExpression:
+            return convertedConstantValue(ConstantValue(l * r, tyK), tyK);
+
+        case SyntaxKind::DivideExpression:
+        case SyntaxKind::ModuleExpression: {
+            if (r == 0)
+                return ConstantValue();
+            auto isDiv = node->kind() == SyntaxKind::DivideExpression;
+            if (!isSigned)
+                return ConstantValue(isDiv ? l / r : l % r, tyK);
+            auto sl = leftVal.asSigned();
+            auto sr = rightVal.asSigned();
+            if (sl == std::numeric_limits<long long>::min() && sr == -1)
+                return ConstantValue(isDiv ? l : 0, tyK);
+            return convertedConstantValue(
+                        ConstantValue(static_cast<unsigned long long>(isDiv ? sl / sr : sl % sr), tyK),
+                        tyK);
+        }
+
+        case SyntaxKind::AddExpression:
+            return convertedConstantValue(ConstantValue(l + r, tyK), tyK);
+        case SyntaxKind::SubstractExpression:
+            return convertedConstantValue(ConstantValue(l - r, tyK), tyK);
+
+        case SyntaxKind::LessThanExpression:
+            return ConstantValue(isSigned ? leftVal.asSigned() < rightVal.asSigned() : l < r,
+                                 BasicTypeKind::Int_S);
+        case SyntaxKind::LessThanOrEqualExpression:
+            return ConstantValue(isSigned ? leftVal.asSigned() <= rightVal.asSigned() : l <= r,
+                                 BasicTypeKind::Int_S);
+        case SyntaxKind::GreaterThanExpression:
+            return ConstantValue(isSigned ? leftVal.asSigned() > rightVal.asSigned() : l > r,
+                                 BasicTypeKind::Int_S);
+        case SyntaxKind::GreaterThanOrEqualExpression:
+            return ConstantValue(isSigned ? leftVal.asSigned() >= rightVal.asSigned() : l >= r,
+                                 BasicTypeKind::Int_S);
+        case SyntaxKind::EqualsExpression:
+            return ConstantValue(l == r, BasicTypeKind::Int_S);
+        case SyntaxKind::NotEqualsExpression:
+            return ConstantValue(l != r, BasicTypeKind::Int_S);
+
+        case SyntaxKind::BitwiseANDExpression:
+            return ConstantValue(l & r, tyK);
+        case SyntaxKind::BitwiseXORExpression:
+            return ConstantValue(l ^ r, tyK);
+        case SyntaxKind::BitwiseORExpression:
+            return ConstantValue(l | r, tyK);
+
+        default:
+            PSY_ASSERT_1(false);
+            return ConstantValue();
+    }
+}
+
+ConstantValue TypeChecker::evaluateConditionalOperation(const ConditionalExpressionSyntax* node)
+{
+    auto condVal = evaluateConstantExpression(node->condition());
+    if (!condVal.isKnown())
+        return condVal;
+
+    // A GNU conditional without a middle operand yields its condition.
+    auto trueVal = node->whenTrue()
+            ? evaluateConstantExpression(node->whenTrue())
+            : condVal;
+    auto falseVal = evaluateConstantExpression(node->whenFalse());
+    if (!trueVal.isKnown() || !falseVal.isKnown())
+        return ConstantValue();
+
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    auto tyK = commonTypeKind(platfOpts, trueVal.basicTypeKind(), falseVal.basicTypeKind());
+    return convertedConstantValue(condVal.isZero() ? falseVal : trueVal, tyK);
+}
+
+ConstantValue TypeChecker::enumeratorValue(ConstantValue val) const
+{
+    if (!val.isKnown())
+        return val;
+
+    // 6.7.2.2-2: An enumerator's value is representable as an int; as a
+    // (GNU) extension, a value that isn't keeps the type of its expression.
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    auto intMax = platfOpts.maxValueOf(PlatformOptions::ArithmeticIntegerType::Int_S);
+    auto fitsInt = isSignedTypeKind(platfOpts, val.basicTypeKind())
+            ? (val.asSigned() >= -static_cast<long long>(intMax) - 1
+                    && val.asSigned() <= static_cast<long long>(intMax))
+            : val.asUnsigned() <= intMax;
+    if (!fitsInt)
+        return val;
+    return convertedConstantValue(val, BasicTypeKind::Int_S);
+}
+
+ConstantValue TypeChecker::nextEnumeratorValue(ConstantValue prevVal) const
+{
+    if (!prevVal.isKnown())
+        return prevVal;
+
+    const auto& platfOpts = semaModel_->compilation()->platformOptions();
+    auto tyK = commonTypeKind(platfOpts, prevVal.basicTypeKind(), BasicTypeKind::Int_S);
+    prevVal = convertedConstantValue(prevVal, tyK);
+    return enumeratorValue(
+                convertedConstantValue(ConstantValue(prevVal.asUnsigned() + 1, tyK), tyK));
+}
@@ -0,0 +1,1055 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeInferrer.h"
+
+#include "syntax/SyntaxTree.h"
+
+#include "sema/Scope.h"
+#include "sema/Compilation.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxToken.h"
+#include "syntax/SyntaxUtilities.h"
+#include "types/Type_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace psy;
+using namespace C;
+
+#define VISIT(NODE) \
+    do { \
+        if (visit(NODE) == Action::Quit) return Action::Quit; \
+    } while (0)
+
+namespace
+{
+std::string spell(const std::string& spec, const std::string& decltor)
+{
+    if (decltor.empty())
+        return spec;
+    return spec + " " + decltor;
+}
+} // anonymous
+
+TypeInferrer::TypeInferrer(SemanticModel* semaModel, const SyntaxTree* tree)
+    : SyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , visitEpoch_(0)
+    , term_(0)
+    , retTerm_(0)
+    , initTarget_(0)
+    , hasInitTarget_(false)
+{}
+
+TypeInferrer::~TypeInferrer()
+{}
+
+void TypeInferrer::inferTypes()
+{
+    retTerm_ = newVariable();
+    visit(tree_->root());
+
+    // The deferred (arithmetic) constraints only bind terms that remained
+    // either variables or known types.
+    for (const auto& [a, b] : hints_) {
+        auto ka = kindOf(a);
+        auto kb = kindOf(b);
+        if ((ka == TermKind::Variable || ka == TermKind::Known)
+                && (kb == TermKind::Variable || kb == TermKind::Known)) {
+            unify(a, b);
+        }
+    }
+
+    semaModel_->setSynthesizedDeclarations(synthesize());
+}
+
+//-------//
+// Terms //
+//-------//
+
+TypeInferrer::TermIndex TypeInferrer::newTerm(TermKind kind, std::string name)
+{
+    TermIndex t = static_cast<TermIndex>(terms_.size());
+    terms_.push_back(Term{ kind, t, 0, std::move(name), {}, {}, 0 });
+    return t;
+}
+
+TypeInferrer::TermIndex TypeInferrer::newVariable()
+{
+    return newTerm(TermKind::Variable);
+}
+
+TypeInferrer::TermIndex TypeInferrer::newKnown(std::string name)
+{
+    return newTerm(TermKind::Known, std::move(name));
+}
+
+TypeInferrer::TermIndex TypeInferrer::newPointer(TermIndex refedTerm)
+{
+    auto t = newTerm(TermKind::Pointer);
+    terms_[t].args_.push_back(refedTerm);
+    return t;
+}
+
+TypeInferrer::TermIndex TypeInferrer::find(TermIndex t)
+{
+    while (terms_[t].parent_ != t) {
+        terms_[t].parent_ = terms_[terms_[t].parent_].parent_;
+        t = terms_[t].parent_;
+    }
+    return t;
+}
+
+TypeInferrer::TermKind TypeInferrer::kindOf(TermIndex t)
+{
+    return terms_[find(t)].kind_;
+}
+
+bool TypeInferrer::occurs(TermIndex var, TermIndex t)
+{
+    // Mostly, a variable is bound to a fresh variable or a known type.
+    t = find(t);
+    if (t == var)
+        return true;
+    if (terms_[t].args_.empty() && terms_[t].fields_.empty())
+        return false;
+
+    if (++visitEpoch_ == 0) {
+        for (auto& term : terms_)
+            term.visitEpoch_ = 0;
+        visitEpoch_ = 1;
+    }
+    pending_.clear();
+    pending_.push_back(t);
+    while (!pending_.empty()) {
+        auto r = find(pending_.back());
+        pending_.pop_back();
+        if (r == var)
+            return true;
+        if (terms_[r].visitEpoch_ == visitEpoch_)
+            continue;
+        terms_[r].visitEpoch_ = visitEpoch_;
+        for (auto arg : terms_[r].args_)
+            pending_.push_back(arg);
+        for (const auto& field : terms_[r].fields_)
+            pending_.push_back(field.second);
+    }
+    return false;
+}
+
+void TypeInferrer::link(TermIndex from, TermIndex to)
+{
+    terms_[from].parent_ = to;
+}
+
+void TypeInferrer::unify(TermIndex a, TermIndex b)
+{
+    a = find(a);
+    b = find(b);
+    if (a == b)
+        return;
+
+    auto ka = terms_[a].kind_;
+    auto kb = terms_[b].kind_;
+    if (ka == TermKind::Variable && kb == TermKind::Variable) {
+        if (terms_[a].rank_ < terms_[b].rank_)
+            std::swap(a, b);
+        link(b, a);
+        if (terms_[a].rank_ == terms_[b].rank_)
+            ++terms_[a].rank_;
+        return;
+    }
+    if (ka == TermKind::Variable) {
+        if (!occurs(a, b))
+            link(a, b);
+        return;
+    }
+    if (kb == TermKind::Variable) {
+        if (!occurs(b, a))
+            link(b, a);
+        return;
+    }
+
+    // Distinct shapes are left alone: C has conversions between them.
+    if (ka != kb)
+        return;
+
+    switch (ka) {
+        case TermKind::Pointer: {
+            auto refedA = terms_[a].args_[0];
+            auto refedB = terms_[b].args_[0];
+            link(a, b);
+            unify(refedA, refedB);
+            return;
+        }
+
+        case TermKind::Function: {
+            if (terms_[a].args_.size() > terms_[b].args_.size())
+                std::swap(a, b);
+            auto argsA = terms_[a].args_;
+            auto argsB = terms_[b].args_;
+            link(a, b);
+            for (std::size_t idx = 0; idx < argsA.size(); ++idx)
+                unify(argsA[idx], argsB[idx]);
+            return;
+        }
+
+        case TermKind::Record: {
+            auto fieldsA = std::move(terms_[a].fields_);
+            terms_[a].fields_.clear();
+            link(a, b);
+            for (const auto& [name, fieldTerm] : fieldsA)
+                unify(requireField(b, name), fieldTerm);
+            return;
+        }
+
+        default:
+            return;
+    }
+}
+
+void TypeInferrer::constrain(TermIndex a, TermIndex b)
+{
+    auto ka = kindOf(a);
+    auto kb = kindOf(b);
+    if ((ka == TermKind::Variable && kb == TermKind::Known)
+            || (ka == TermKind::Known && kb == TermKind::Variable)) {
+        hint(a, b);
+        return;
+    }
+    unify(a, b);
+}
+
+void TypeInferrer::hint(TermIndex a, TermIndex b)
+{
+    hints_.emplace_back(a, b);
+}
+
+TypeInferrer::TermIndex TypeInferrer::requirePointer(TermIndex t)
+{
+    auto r = find(t);
+    switch (terms_[r].kind_) {
+        case TermKind::Variable: {
+            auto refedTerm = newVariable();
+            terms_[r].kind_ = TermKind::Pointer;
+            terms_[r].args_.push_back(refedTerm);
+            return refedTerm;
+        }
+
+        case TermKind::Pointer:
+            return terms_[r].args_[0];
+
+        case TermKind::Function:
+            return r;
+
+        default:
+            return newVariable();
+    }
+}
+
+TypeInferrer::TermIndex TypeInferrer::requireField(TermIndex t, const std::string& name)
+{
+    auto r = find(t);
+    if (terms_[r].kind_ == TermKind::Variable)
+        terms_[r].kind_ = TermKind::Record;
+    if (terms_[r].kind_ != TermKind::Record)
+        return newVariable();
+
+    for (const auto& [fieldName, fieldTerm] : terms_[r].fields_) {
+        if (fieldName == name)
+            return fieldTerm;
+    }
+    auto fieldTerm = newVariable();
+    terms_[r].fields_.emplace_back(name, fieldTerm);
+    return fieldTerm;
+}
+
+TypeInferrer::TermIndex TypeInferrer::requireFunction(
+        TermIndex t,
+        const std::vector<TermIndex>& argTerms)
+{
+    auto r = find(t);
+    if (terms_[r].kind_ == TermKind::Pointer) {
+        auto refed = find(terms_[r].args_[0]);
+        if (terms_[refed].kind_ == TermKind::Variable
+                || terms_[refed].kind_ == TermKind::Function) {
+            r = refed;
+        }
+    }
+
+    switch (terms_[r].kind_) {
+        case TermKind::Variable: {
+            std::vector<TermIndex> args { newVariable() };
+            for (auto argTerm : argTerms) {
+                auto parmTerm = newVariable();
+                if (!occurs(r, argTerm))
+                    constrain(parmTerm, argTerm);
+                args.push_back(parmTerm);
+            }
+            terms_[r].kind_ = TermKind::Function;
+            terms_[r].args_ = std::move(args);
+            return terms_[r].args_[0];
+        }
+
+        case TermKind::Function: {
+            auto args = terms_[r].args_;
+            for (std::size_t idx = 1; idx < args.size() && idx <= argTerms.size(); ++idx)
+                constrain(args[idx], argTerms[idx - 1]);
+            return args[0];
+        }
+
+        default:
+            return newVariable();
+    }
+}
+
+//-------------//
+// Translation //
+//-------------//
+
+TypeInferrer::TermIndex TypeInferrer::termOf(const Type* ty, TermIndex errTerm)
+{
+    if (!ty)
+        return errTerm;
+
+    switch (ty->kind()) {
+        case TypeKind::Array:
+            return newPointer(termOf(ty->asArrayType()->elementType(), errTerm));
+
+        case TypeKind::Basic: {
+            auto basicTyK = ty->asBasicType()->kind();
+            switch (basicTyK) {
+                case BasicTypeKind::Short_S:
+                    return newKnown("short");
+                case BasicTypeKind::Int_S:
+                    return newKnown("int");
+                case BasicTypeKind::Long_S:
+                    return newKnown("long");
+                case BasicTypeKind::LongLong_S:
+                    return newKnown("long long");
+                default: {
+                    std::ostringstream oss;
+                    oss << basicTyK;
+                    return newKnown(oss.str());
+                }
+            }
+        }
+
+        case TypeKind::Function: {
+            auto funcTy = ty->asFunctionType();
+            std::vector<TermIndex> args { termOf(funcTy->returnType(), errTerm) };
+            for (auto parmTy : funcTy->parameterTypes())
+                args.push_back(termOf(parmTy, newVariable()));
+            auto t = newTerm(TermKind::Function);
+            terms_[t].args_ = std::move(args);
+            return t;
+        }
+
+        case TypeKind::Pointer:
+            return newPointer(termOf(ty->asPointerType()->referencedType(), errTerm));
+
+        case TypeKind::TypedefName: {
+            auto tydefNameTy = ty->asTypedefNameType();
+            auto resolvedTy = tydefNameTy->resolvedSynonymizedType();
+            if (!resolvedTy)
+                return errTerm;
+            switch (resolvedTy->kind()) {
+                case TypeKind::Array:
+                case TypeKind::Function:
+                case TypeKind::Pointer:
+                    return termOf(resolvedTy, errTerm);
+                default:
+                    return newKnown(tydefNameTy->typedefName()->c_str());
+            }
+        }
+
+        case TypeKind::Tag: {
+            auto tagTy = ty->asTagType();
+            std::string keyword;
+            switch (tagTy->kind()) {
+                case TagTypeKind::Struct:
+                    keyword = "struct ";
+                    break;
+                case TagTypeKind::Union:
+                    keyword = "union ";
+                    break;
+                case TagTypeKind::Enum:
+                    keyword = "enum ";
+                    break;
+            }
+            return newKnown(keyword + tagTy->tag()->c_str());
+        }
+
+        case TypeKind::Void:
+            return newKnown("void");
+
+        case TypeKind::Qualified:
+            return termOf(ty->asQualifiedType()->unqualifiedType(), errTerm);
+
+        case TypeKind::Error:
+            return errTerm;
+    }
+    PSY_ASSERT_1(false);
+    return errTerm;
+}
+
+TypeInferrer::TermIndex TypeInferrer::termOfIdentifier(
+        const Identifier* ident,
+        IdentifierTerms& identTerms)
+{
+    auto it = identTerms.termByIdent_.find(ident);
+    if (it != identTerms.termByIdent_.end())
+        return it->second;
+    auto t = newVariable();
+    identTerms.termByIdent_.emplace(ident, t);
+    identTerms.idents_.emplace_back(ident, t);
+    return t;
+}
+
+TypeInferrer::TermIndex TypeInferrer::termOfUnknownTypedefNameIn(
+        const SpecifierListSyntax* specs,
+        const Scope* scope)
+{
+    for (auto it = specs; it; it = it->next) {
+        auto tydefName = it->value->asTypedefName();
+        if (!tydefName)
+            continue;
+        auto ident = tydefName->identifierToken().lexeme()->asIdentifier();
+        if (!ident
+                || (scope && scope->searchForDeclaration(ident, NameSpace::OrdinaryIdentifiers)))
+            break;
+        return termOfIdentifier(ident, unknownTydefs_);
+    }
+    return newVariable();
+}
+
+TypeInferrer::TermIndex TypeInferrer::termOfDeclaration(
+        const DeclarationSymbol* decl,
+        TermIndex errTerm)
+{
+    auto it = declTerms_.find(decl);
+    if (it != declTerms_.end())
+        return it->second;
+
+    auto typeableDecl = MIXIN_TypeableDeclarationSymbol::from(decl);
+    auto t = typeableDecl
+            ? termOf(typeableDecl->type(), errTerm)
+            : newVariable();
+    declTerms_.emplace(decl, t);
+    return t;
+}
+
+TypeInferrer::TermIndex TypeInferrer::termOfTypeName(const TypeNameSyntax* node)
+{
+    auto decl = semaModel_->declarationBy(node->declarator());
+    if (!decl)
+        return newVariable();
+    auto errTerm = termOfUnknownTypedefNameIn(node->specifiers(), decl->enclosingScope());
+    return termOfDeclaration(decl, errTerm);
+}
+
+SyntaxVisitor::Action TypeInferrer::bindDeclarator(
+        const DeclaratorSyntax* decltor,
+        const SpecifierListSyntax* specs)
+{
+    auto decl = semaModel_->declarationBy(decltor);
+    if (!decl)
+        return visit(decltor);
+
+    auto errTerm = termOfUnknownTypedefNameIn(specs, decl->enclosingScope());
+    auto t = termOfDeclaration(decl, errTerm);
+
+    auto outerParmTerms = std::move(parmTerms_);
+    parmTerms_.clear();
+    initTarget_ = t;
+    hasInitTarget_ = decl->category() == DeclarationCategory::Object;
+    auto action = visit(decltor);
+    hasInitTarget_ = false;
+
+    // The terms of the parameters are more precise than the ones of the
+    // function's type (e.g., for an unknown typedef name).
+    auto r = find(t);
+    if (terms_[r].kind_ == TermKind::Function
+            && terms_[r].args_.size() == parmTerms_.size() + 1) {
+        auto args = terms_[r].args_;
+        for (std::size_t idx = 0; idx < parmTerms_.size(); ++idx)
+            unify(args[idx + 1], parmTerms_[idx]);
+    }
+    parmTerms_ = std::move(outerParmTerms);
+
+    return action == Action::Quit ? Action::Quit : Action::Skip;
+}
+
+//-----------//
+// Synthesis //
+//-----------//
+
+std::string TypeInferrer::nameOfRecord(TermIndex t)
+{
+    auto r = find(t);
+    auto it = recNames_.find(r);
+    if (it != recNames_.end())
+        return it->second;
+    auto name = "psy_record_" + std::to_string(recs_.size() + 1);
+    recNames_.emplace(r, name);
+    recs_.push_back(r);
+    return name;
+}
+
+std::string TypeInferrer::declare(TermIndex t, const std::string& decltor)
+{
+    auto r = find(t);
+    switch (terms_[r].kind_) {
+        case TermKind::Variable:
+            return spell("int", decltor);
+
+        case TermKind::Known:
+            return spell(terms_[r].name_, decltor);
+
+        case TermKind::Pointer: {
+            auto refed = find(terms_[r].args_[0]);
+            if (terms_[refed].kind_ == TermKind::Function)
+                return declare(refed, "(*" + decltor + ")");
+            return declare(refed, "*" + decltor);
+        }
+
+        case TermKind::Function: {
+            auto args = terms_[r].args_;
+            std::string parms;
+            for (std::size_t idx = 1; idx < args.size(); ++idx) {
+                if (idx > 1)
+                    parms += ", ";
+                parms += declare(args[idx], "");
+            }
+            if (parms.empty())
+                parms = "void";
+            return declare(args[0], decltor + "(" + parms + ")");
+        }
+
+        case TermKind::Record:
+            return spell("struct " + nameOfRecord(r), decltor);
+    }
+    PSY_ASSERT_1(false);
+    return spell("int", decltor);
+}
+
+void TypeInferrer::defineRecord(TermIndex t, std::vector<bool>& defined, std::string& text)
+{
+    auto r = find(t);
+    if (defined[r])
+        return;
+    defined[r] = true;
+
+    // A field whose type is a record (not a pointer to one) requires that
+    // record's definition first.
+    auto fields = terms_[r].fields_;
+    for (const auto& field : fields) {
+        auto fieldR = find(field.second);
+        if (terms_[fieldR].kind_ == TermKind::Record)
+            defineRecord(fieldR, defined, text);
+    }
+
+    auto def = "struct " + nameOfRecord(r) + "\n{\n";
+    for (const auto& [name, fieldTerm] : fields) {
+        auto fieldName = kindOf(fieldTerm) == TermKind::Function
+                ? "(*" + name + ")"
+                : name;
+        def += "    " + declare(fieldTerm, fieldName) + ";\n";
+    }
+    def += "};\n";
+    text += def;
+}
+
+std::string TypeInferrer::synthesize()
+{
+    // A record that is the type of an unknown typedef name is named after it.
+    for (const auto& [ident, t] : unknownTydefs_.idents_) {
+        auto r = find(t);
+        if (terms_[r].kind_ == TermKind::Record && !recNames_.count(r)) {
+            recNames_.emplace(r, ident->c_str());
+            recs_.push_back(r);
+        }
+    }
+
+    std::string tydefs;
+    for (const auto& [ident, t] : unknownTydefs_.idents_) {
+        std::string name = ident->c_str();
+        tydefs += "typedef " + declare(t, name) + ";\n";
+    }
+
+    std::string objs;
+    std::string funcs;
+    for (const auto& [ident, t] : undeclIdents_.idents_) {
+        std::string name = ident->c_str();
+        if (kindOf(t) == TermKind::Function)
+            funcs += declare(t, name) + ";\n";
+        else
+            objs += declare(t, name) + ";\n";
+    }
+
+    // Definitions may name further records, hence the index-based loop.
+    std::string recDefs;
+    std::vector<bool> defined(terms_.size(), false);
+    for (std::size_t idx = 0; idx < recs_.size(); ++idx)
+        defineRecord(recs_[idx], defined, recDefs);
+
+    std::string fwdDecls;
+    for (auto r : recs_)
+        fwdDecls += "struct " + recNames_[r] + ";\n";
+
+    return fwdDecls + tydefs + recDefs + objs + funcs;
+}
+
+//--------------//
+// Declarations //
+//--------------//
+
+SyntaxVisitor::Action TypeInferrer::visitVariableAndOrFunctionDeclaration(
+        const VariableAndOrFunctionDeclarationSyntax* node)
+{
+    for (auto it = node->declarators(); it; it = it->next) {
+        if (bindDeclarator(it->value, node->specifiers()) == Action::Quit)
+            return Action::Quit;
+    }
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitParameterDeclaration(
+        const ParameterDeclarationSyntax* node)
+{
+    auto decl = semaModel_->parameterFor(node);
+    TermIndex t;
+    if (decl) {
+        auto errTerm = termOfUnknownTypedefNameIn(node->specifiers(), decl->enclosingScope());
+        t = termOfDeclaration(decl, errTerm);
+        auto outerParmTerms = std::move(parmTerms_);
+        parmTerms_.clear();
+        VISIT(node->declarator());
+        parmTerms_ = std::move(outerParmTerms);
+    }
+    else {
+        t = newVariable();
+    }
+    parmTerms_.push_back(t);
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitFunctionDefinition(
+        const FunctionDefinitionSyntax* node)
+{
+    auto decl = semaModel_->functionFor(node);
+    if (!decl)
+        return Action::Skip;
+
+    auto errTerm = termOfUnknownTypedefNameIn(node->specifiers(), decl->enclosingScope());
+    auto t = termOfDeclaration(decl, errTerm);
+
+    auto outerParmTerms = std::move(parmTerms_);
+    parmTerms_.clear();
+    VISIT(node->declarator());
+    auto r = find(t);
+    if (terms_[r].kind_ == TermKind::Function) {
+        auto args = terms_[r].args_;
+        if (args.size() == parmTerms_.size() + 1) {
+            for (std::size_t idx = 0; idx < parmTerms_.size(); ++idx)
+                unify(args[idx + 1], parmTerms_[idx]);
+        }
+        retTerm_ = args[0];
+    }
+    else {
+        retTerm_ = newVariable();
+    }
+    parmTerms_ = std::move(outerParmTerms);
+
+    VISIT(node->body());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*)
+{
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitEnumDeclaration(const EnumDeclarationSyntax*)
+{
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitTypedefDeclaration(const TypedefDeclarationSyntax*)
+{
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitExtGNU_Attribute(const ExtGNU_AttributeSyntax*)
+{
+    return Action::Skip;
+}
+
+/* Initializers */
+
+SyntaxVisitor::Action TypeInferrer::visitExpressionInitializer(const ExpressionInitializerSyntax* node)
+{
+    auto hasTarget = hasInitTarget_;
+    auto target = initTarget_;
+    hasInitTarget_ = false;
+    VISIT(node->expression());
+    if (hasTarget)
+        constrain(target, term_);
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitBraceEnclosedInitializer(const BraceEnclosedInitializerSyntax* node)
+{
+    hasInitTarget_ = false;
+    VISIT(node->initializerList());
+    return Action::Skip;
+}
+
+//-------------//
+// Expressions //
+//-------------//
+
+SyntaxVisitor::Action TypeInferrer::visitIdentifierName(const IdentifierNameSyntax* node)
+{
+    auto scope = semaModel_->scopeOf(node);
+    if (!scope) {
+        term_ = newVariable();
+        return Action::Skip;
+    }
+
+    auto ident = identifierFrom(node);
+    auto decl = scope->searchForDeclaration(ident, NameSpace::OrdinaryIdentifiers);
+    if (!decl) {
+        term_ = termOfIdentifier(ident, undeclIdents_);
+        return Action::Skip;
+    }
+    term_ = decl->category() == DeclarationCategory::Type
+            ? newVariable()
+            : termOfDeclaration(decl, newVariable());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitPredefinedName(const PredefinedNameSyntax*)
+{
+    term_ = newPointer(newKnown("char"));
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitConstantExpression(const ConstantExpressionSyntax* node)
+{
+    switch (node->kind()) {
+        case SyntaxKind::FloatingConstantExpression:
+            term_ = newKnown("double");
+            break;
+        case SyntaxKind::ImaginaryIntegerConstantExpression:
+        case SyntaxKind::ImaginaryFloatingConstantExpression:
+            term_ = newKnown("double _Complex");
+            break;
+        case SyntaxKind::NULL_ConstantExpression:
+            term_ = newPointer(newVariable());
+            break;
+        default:
+            term_ = newKnown("int");
+            break;
+    }
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitStringLiteralExpression(const StringLiteralExpressionSyntax*)
+{
+    term_ = newPointer(newKnown("char"));
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitParenthesizedExpression(const ParenthesizedExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitGenericSelectionExpression(const GenericSelectionExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    term_ = newVariable();
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitExtGNU_EnclosedCompoundStatementExpression(
+        const ExtGNU_EnclosedCompoundStatementExpressionSyntax* node)
+{
+    VISIT(node->statement());
+    term_ = newVariable();
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitExtGNU_ComplexValuedExpression(
+        const ExtGNU_ComplexValuedExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitPrefixUnaryExpression(const PrefixUnaryExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    switch (node->kind()) {
+        case SyntaxKind::AddressOfExpression:
+            term_ = newPointer(term_);
+            break;
+        case SyntaxKind::PointerIndirectionExpression:
+            term_ = requirePointer(term_);
+            break;
+        case SyntaxKind::LogicalNotExpression:
+            term_ = newKnown("int");
+            break;
+        default:
+            break;
+    }
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitPostfixUnaryExpression(const PostfixUnaryExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitMemberAccessExpression(const MemberAccessExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    auto recTerm = node->kind() == SyntaxKind::IndirectMemberAccessExpression
+            ? requirePointer(term_)
+            : term_;
+
+    // The members of a known type are those computed by the type checker.
+    if (kindOf(recTerm) == TermKind::Known) {
+        term_ = termOf(semaModel_->typeInfoOf(node).type(), newVariable());
+        return Action::Skip;
+    }
+    term_ = requireField(recTerm, identifierFrom(node->memberName())->c_str());
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitArraySubscriptExpression(const ArraySubscriptExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    auto arrTerm = term_;
+    VISIT(node->argument());
+    auto idxTerm = term_;
+    if (kindOf(arrTerm) == TermKind::Known && kindOf(idxTerm) != TermKind::Known)
+        std::swap(arrTerm, idxTerm);
+    hint(idxTerm, newKnown("int"));
+    term_ = requirePointer(arrTerm);
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitTypeTraitExpression(const TypeTraitExpressionSyntax* node)
+{
+    VISIT(node->tyReference());
+    term_ = newKnown("unsigned long");
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitCastExpression(const CastExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    term_ = termOfTypeName(node->typeName());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitCallExpression(const CallExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    auto calleeTerm = term_;
+    std::vector<TermIndex> argTerms;
+    for (auto it = node->arguments(); it; it = it->next) {
+        VISIT(it->value);
+        argTerms.push_back(term_);
+    }
+    term_ = requireFunction(calleeTerm, argTerms);
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitVAArgumentExpression(const VAArgumentExpressionSyntax* node)
+{
+    VISIT(node->expression());
+    term_ = termOfTypeName(node->typeName());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitOffsetOfExpression(const OffsetOfExpressionSyntax*)
+{
+    term_ = newKnown("unsigned long");
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax* node)
+{
+    auto t = termOfTypeName(node->typeName());
+    VISIT(node->initializer());
+    term_ = t;
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitBinaryExpression(const BinaryExpressionSyntax* node)
+{
+    VISIT(node->left());
+    auto leftTerm = term_;
+    VISIT(node->right());
+    auto rightTerm = term_;
+
+    switch (node->kind()) {
+        case SyntaxKind::AddExpression:
+        case SyntaxKind::SubstractExpression: {
+            auto leftK = kindOf(leftTerm);
+            auto rightK = kindOf(rightTerm);
+            if (leftK == TermKind::Pointer) {
+                term_ = rightK == TermKind::Pointer
+                        ? newKnown("long")
+                        : leftTerm;
+            }
+            else if (rightK == TermKind::Pointer) {
+                term_ = rightTerm;
+            }
+            else {
+                hint(leftTerm, rightTerm);
+                term_ = leftTerm;
+            }
+            break;
+        }
+
+        case SyntaxKind::MultiplyExpression:
+        case SyntaxKind::DivideExpression:
+        case SyntaxKind::ModuleExpression:
+        case SyntaxKind::BitwiseANDExpression:
+        case SyntaxKind::BitwiseXORExpression:
+        case SyntaxKind::BitwiseORExpression:
+            hint(leftTerm, rightTerm);
+            term_ = leftTerm;
+            break;
+
+        case SyntaxKind::LeftShiftExpression:
+        case SyntaxKind::RightShiftExpression:
+            term_ = leftTerm;
+            break;
+
+        case SyntaxKind::LessThanExpression:
+        case SyntaxKind::LessThanOrEqualExpression:
+        case SyntaxKind::GreaterThanExpression:
+        case SyntaxKind::GreaterThanOrEqualExpression:
+        case SyntaxKind::EqualsExpression:
+        case SyntaxKind::NotEqualsExpression:
+            if (kindOf(leftTerm) == TermKind::Pointer || kindOf(rightTerm) == TermKind::Pointer)
+                unify(leftTerm, rightTerm);
+            else
+                hint(leftTerm, rightTerm);
+            term_ = newKnown("int");
+            break;
+
+        default:
+            term_ = newKnown("int");
+            break;
+    }
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitConditionalExpression(const ConditionalExpressionSyntax* node)
+{
+    VISIT(node->condition());
+    auto trueTerm = term_;
+    if (node->whenTrue()) {
+        VISIT(node->whenTrue());
+        trueTerm = term_;
+    }
+    VISIT(node->whenFalse());
+    constrain(trueTerm, term_);
+    term_ = trueTerm;
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitAssignmentExpression(const AssignmentExpressionSyntax* node)
+{
+    VISIT(node->left());
+    auto leftTerm = term_;
+    VISIT(node->right());
+    auto rightTerm = term_;
+
+    switch (node->kind()) {
+        case SyntaxKind::BasicAssignmentExpression:
+            constrain(leftTerm, rightTerm);
+            break;
+
+        case SyntaxKind::AddAssignmentExpression:
+        case SyntaxKind::SubtractAssignmentExpression:
+            if (kindOf(leftTerm) != TermKind::Pointer)
+                hint(leftTerm, rightTerm);
+            break;
+
+        case SyntaxKind::LeftShiftAssignmentExpression:
+        case SyntaxKind::RightShiftAssignmentExpression:
+            break;
+
+        default:
+            hint(leftTerm, rightTerm);
+            break;
+    }
+    term_ = leftTerm;
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitSequencingExpression(const SequencingExpressionSyntax* node)
+{
+    VISIT(node->left());
+    VISIT(node->right());
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action TypeInferrer::visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax* node)
+{
+    VISIT(node->constantExpression());
+    VISIT(node->expression1());
+    VISIT(node->expression2());
+    term_ = newVariable();
+    return Action::Skip;
+}
+
+//------------//
+// Statements //
+//------------//
+
+SyntaxVisitor::Action TypeInferrer::visitReturnStatement(const ReturnStatementSyntax* node)
+{
+    if (node->expression()) {
+        VISIT(node->expression());
+        constrain(retTerm_, term_);
+    }
+    return Action::Skip;
+}
@@ -0,0 +1,200 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef PSYCHE_C_TYPE_INFERRER_H__
+#define PSYCHE_C_TYPE_INFERRER_H__
+
+#include "API.h"
+
+#include "syntax/SyntaxVisitor.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The TypeInferrer class.
+ *
+ * Infer the types of the undeclared identifiers and of the unknown typedef
+ * names of a SyntaxTree, from how they're used, and synthesize declarations
+ * for them.
+ *
+ * Every expression is given a \a term; a term is either a variable or a
+ * "shape" (pointer, function, record, or a known type). Shape constraints
+ * are solved eagerly, as they're generated, by unification over a union-find
+ * structure of terms; constraints that stem from arithmetic are deferred
+ * until the whole tree has been visited, so that they only bind the terms
+ * that didn't acquire a shape of their own.
+ *
+ * \remark The model is a subset of that of \c formalism/muC.hs.
+ */
+class PSY_C_INTERNAL_API TypeInferrer final : protected SyntaxVisitor
+{
+public:
+    ~TypeInferrer();
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+
+    TypeInferrer(SemanticModel* semaModel, const SyntaxTree* tree);
+    TypeInferrer(const TypeInferrer&) = delete;
+    void operator=(const TypeInferrer&) = delete;
+
+    void inferTypes();
+
+private:
+    SemanticModel* semaModel_;
+
+    using TermIndex = std::uint32_t;
+
+    enum class TermKind : std::uint8_t
+    {
+        Variable,
+        Known,
+        Pointer,
+        Function,
+        Record
+    };
+
+    struct Term
+    {
+        TermKind kind_;
+        TermIndex parent_;
+        std::uint32_t rank_;
+        std::string name_;
+        std::vector<TermIndex> args_;
+        std::vector<std::pair<std::string, TermIndex>> fields_;
+        std::uint32_t visitEpoch_;
+    };
+    std::vector<Term> terms_;
+
+    /* A term is visited (by occurs) if stamped with the current epoch. */
+    std::uint32_t visitEpoch_;
+    std::vector<TermIndex> pending_;
+
+    TermIndex term_;
+    TermIndex retTerm_;
+    TermIndex initTarget_;
+    bool hasInitTarget_;
+    std::vector<TermIndex> parmTerms_;
+    std::vector<std::pair<TermIndex, TermIndex>> hints_;
+
+    std::unordered_map<const DeclarationSymbol*, TermIndex> declTerms_;
+
+    /* Kept in order of first appearance, for a stable synthesis. */
+    struct IdentifierTerms
+    {
+        std::unordered_map<const Identifier*, TermIndex> termByIdent_;
+        std::vector<std::pair<const Identifier*, TermIndex>> idents_;
+    };
+    IdentifierTerms unknownTydefs_;
+    IdentifierTerms undeclIdents_;
+
+    /* Terms */
+    TermIndex newTerm(TermKind kind, std::string name = std::string());
+    TermIndex newVariable();
+    TermIndex newKnown(std::string name);
+    TermIndex newPointer(TermIndex refedTerm);
+    TermIndex find(TermIndex t);
+    TermKind kindOf(TermIndex t);
+    bool occurs(TermIndex var, TermIndex t);
+    void link(TermIndex from, TermIndex to);
+    void unify(TermIndex a, TermIndex b);
+    void constrain(TermIndex a, TermIndex b);
+    void hint(TermIndex a, TermIndex b);
+    TermIndex requirePointer(TermIndex t);
+    TermIndex requireField(TermIndex t, const std::string& name);
+    TermIndex requireFunction(TermIndex t, const std::vector<TermIndex>& argTerms);
+
+    /* Translation */
+    TermIndex termOf(const Type* ty, TermIndex errTerm);
+    TermIndex termOfIdentifier(const Identifier* ident, IdentifierTerms& identTerms);
+    TermIndex termOfUnknownTypedefNameIn(const SpecifierListSyntax* specs, const Scope* scope);
+    TermIndex termOfDeclaration(const DeclarationSymbol* decl, TermIndex errTerm);
+    TermIndex termOfTypeName(const TypeNameSyntax* node);
+    Action bindDeclarator(const DeclaratorSyntax* decltor, const SpecifierListSyntax* specs);
+
+    /* Synthesis */
+    std::unordered_map<TermIndex, std::string> recNames_;
+    std::vector<TermIndex> recs_;
+    std::string synthesize();
+    std::string declare(TermIndex t, const std::string& decltor);
+    std::string nameOfRecord(TermIndex t);
+    void defineRecord(TermIndex t, std::vector<bool>& defined, std::string& text);
+
+    //--------------//
+    // Declarations //
+    //--------------//
+
+    virtual Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
+    virtual Action visitParameterDeclaration(const ParameterDeclarationSyntax*) override;
+    virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+    virtual Action visitStructOrUnionDeclaration(const StructOrUnionDeclarationSyntax*) override;
+    virtual Action visitEnumDeclaration(const EnumDeclarationSyntax*) override;
+    virtual Action visitTypedefDeclaration(const TypedefDeclarationSyntax*) override;
+    virtual Action visitExtGNU_Attribute(const ExtGNU_AttributeSyntax*) override;
+
+    /* Initializers */
+    virtual Action visitExpressionInitializer(const ExpressionInitializerSyntax*) override;
+    virtual Action visitBraceEnclosedInitializer(const BraceEnclosedInitializerSyntax*) override;
+
+    //-------------//
+    // Expressions //
+    //-------------//
+
+    virtual Action visitIdentifierName(const IdentifierNameSyntax*) override;
+    virtual Action visitPredefinedName(const PredefinedNameSyntax*) override;
+    virtual Action visitConstantExpression(const ConstantExpressionSyntax*) override;
+    virtual Action visitStringLiteralExpression(const StringLiteralExpressionSyntax*) override;
+    virtual Action visitParenthesizedExpression(const ParenthesizedExpressionSyntax*) override;
+    virtual Action visitGenericSelectionExpression(const GenericSelectionExpressionSyntax*) override;
+    virtual Action visitExtGNU_EnclosedCompoundStatementExpression(const ExtGNU_EnclosedCompoundStatementExpressionSyntax*) override;
+    virtual Action visitExtGNU_ComplexValuedExpression(const ExtGNU_ComplexValuedExpressionSyntax*) override;
+    virtual Action visitPrefixUnaryExpression(const PrefixUnaryExpressionSyntax*) override;
+    virtual Action visitPostfixUnaryExpression(const PostfixUnaryExpressionSyntax*) override;
+    virtual Action visitMemberAccessExpression(const MemberAccessExpressionSyntax*) override;
+    virtual Action visitArraySubscriptExpression(const ArraySubscriptExpressionSyntax*) override;
+    virtual Action visitTypeTraitExpression(const TypeTraitExpressionSyntax*) override;
+    virtual Action visitCastExpression(const CastExpressionSyntax*) override;
+    virtual Action visitCallExpression(const CallExpressionSyntax*) override;
+    virtual Action visitVAArgumentExpression(const VAArgumentExpressionSyntax*) override;
+    virtual Action visitOffsetOfExpression(const OffsetOfExpressionSyntax*) override;
+    virtual Action visitCompoundLiteralExpression(const CompoundLiteralExpressionSyntax*) override;
+    virtual Action visitBinaryExpression(const BinaryExpressionSyntax*) override;
+    virtual Action visitConditionalExpression(const ConditionalExpressionSyntax*) override;
+    virtual Action visitAssignmentExpression(const AssignmentExpressionSyntax*) override;
+    virtual Action visitSequencingExpression(const SequencingExpressionSyntax*) override;
+    virtual Action visitExtGNU_ChooseExpression(const ExtGNU_ChooseExpressionSyntax*) override;
+
+    //------------//
+    // Statements //
+    //------------//
+
+    virtual Action visitReturnStatement(const ReturnStatementSyntax*) override;
+};
+
+} // C
+} // psy
+
+#endif
@@ -62,6 +62,7 @@ public:
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
     PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
 private:
     TypeInfo(const Type* ty, TypeOrigin tyOrig);
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeLayout.h"
+
+using namespace psy;
+using namespace C;
+
+TypeLayout::TypeLayout()
+    : sz_(0)
+    , align_(0)
+    , hasKnownSz_(false)
+    , hasKnownAlign_(false)
+{}
+
+TypeLayout::TypeLayout(unsigned long long align)
+    : sz_(0)
+    , align_(align)
+    , hasKnownSz_(false)
+    , hasKnownAlign_(true)
+{}
+
+TypeLayout::TypeLayout(unsigned long long sz, unsigned long long align)
+    : sz_(sz)
+    , align_(align)
+    , hasKnownSz_(true)
+    , hasKnownAlign_(true)
+{}
+
+TypeLayout::~TypeLayout()
+{}
+
+bool TypeLayout::hasKnownSize() const
+{
+    return hasKnownSz_;
+}
+
+unsigned long long TypeLayout::size() const
+{
+    return sz_;
+}
+
+bool TypeLayout::hasKnownAlignment() const
+{
+    return hasKnownAlign_;
+}
+
+unsigned long long TypeLayout::alignment() const
+{
+    return align_;
+}
+
+namespace psy {
+namespace C {
+
+std::ostream& operator<<(std::ostream& os, const TypeLayout& tyLayout)
+{
+    os << "<TypeLayout |";
+    os << " size:";
+    if (tyLayout.hasKnownSize())
+        os << tyLayout.size();
+    else
+        os << "?";
+    os << " alignment:";
+    if (tyLayout.hasKnownAlignment())
+        os << tyLayout.alignment();
+    else
+        os << "?";
+    os << ">";
+    return os;
+}
+
+} // C
+} // psy
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_TYPE_LAYOUT_H__
+#define PSYCHE_C_TYPE_LAYOUT_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <ostream>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The TypeLayout class.
+ *
+ * The size and alignment, in bytes, of a Type, as of the PlatformOptions of
+ * a Compilation.
+ *
+ * \remark 6.2.8 and 6.5.3.4
+ *
+ * \note Similar to:
+ * - \c clang::TypeInfo and \c clang::ASTRecordLayout of LLVM/Clang.
+ */
+class PSY_C_API TypeLayout final
+{
+public:
+    /**
+     * Create a TypeLayout of unknown size and alignment.
+     */
+    TypeLayout();
+    ~TypeLayout();
+
+    /**
+     * Whether the size of \c this TypeLayout is known.
+     *
+     * \remark The size of an incomplete type (e.g., an array of unknown
+     * size) is unknown, but its alignment may be known.
+     */
+    bool hasKnownSize() const;
+
+    /**
+     * The size, in bytes, of \c this TypeLayout.
+     *
+     * \remark The result is meaningful only if the size is known.
+     */
+    unsigned long long size() const;
+
+    /**
+     * Whether the alignment of \c this TypeLayout is known.
+     */
+    bool hasKnownAlignment() const;
+
+    /**
+     * The alignment, in bytes, of \c this TypeLayout.
+     *
+     * \remark The result is meaningful only if the alignment is known.
+     */
+    unsigned long long alignment() const;
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(TypeLayoutCalculator);
+
+    explicit TypeLayout(unsigned long long align);
+    TypeLayout(unsigned long long sz, unsigned long long align);
+
+private:
+    unsigned long long sz_;
+    unsigned long long align_;
+    bool hasKnownSz_;
+    bool hasKnownAlign_;
+};
+
+PSY_C_API std::ostream& operator<<(std::ostream& os, const TypeLayout& tyLayout);
+
+} // C
+} // psy
+
+#endif
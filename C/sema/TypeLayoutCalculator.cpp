@@ -0,0 +1,342 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TypeLayoutCalculator.h"
+
+#include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+#include "types/Type_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <algorithm>
+
+using namespace psy;
+using namespace C;
+
+namespace
+{
+unsigned long long roundedUp(unsigned long long v, unsigned long long align)
+{
+    return align ? (v + align - 1) / align * align : v;
+}
+
+/*
+ * The size of an integer type isn't part of the PlatformOptions;
+ * it's derived from the maximum value of the type's unsigned version.
+ */
+unsigned long long sizeOfIntegerType(const PlatformOptions& platformOpts, BasicTypeKind basicTyK)
+{
+    PlatformOptions::ArithmeticIntegerType arithIntTy;
+    switch (basicTyK) {
+        case BasicTypeKind::Char:
+        case BasicTypeKind::Char_S:
+        case BasicTypeKind::Char_U:
+            arithIntTy = PlatformOptions::ArithmeticIntegerType::Char_U;
+            break;
+        case BasicTypeKind::Short_S:
+        case BasicTypeKind::Short_U:
+            arithIntTy = PlatformOptions::ArithmeticIntegerType::Short_U;
+            break;
+        case BasicTypeKind::Int_S:
+        case BasicTypeKind::Int_U:
+            arithIntTy = PlatformOptions::ArithmeticIntegerType::Int_U;
+            break;
+        case BasicTypeKind::Long_S:
+        case BasicTypeKind::Long_U:
+            arithIntTy = PlatformOptions::ArithmeticIntegerType::Long_U;
+            break;
+        case BasicTypeKind::LongLong_S:
+        case BasicTypeKind::LongLong_U:
+            arithIntTy = PlatformOptions::ArithmeticIntegerType::LongLong_U;
+            break;
+        default:
+            PSY_ASSERT_1(false);
+            return 0;
+    }
+    auto max = platformOpts.maxValueOf(arithIntTy);
+    unsigned long long w = 0;
+    for (; max; max >>= 1)
+        ++w;
+    return roundedUp(w, 8) / 8;
+}
+
+bool isArrayOfUnspecifiedSize(const Type* ty)
+{
+    while (ty) {
+        switch (ty->kind()) {
+            case TypeKind::Array:
+                return ty->asArrayType()->hasUnspecifiedSize();
+            case TypeKind::Qualified:
+                ty = ty->asQualifiedType()->unqualifiedType();
+                break;
+            case TypeKind::TypedefName:
+                ty = ty->asTypedefNameType()->resolvedSynonymizedType();
+                break;
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+} // anonymous
+
+TypeLayoutCalculator::TypeLayoutCalculator(const PlatformOptions& platformOpts)
+    : platformOpts_(platformOpts)
+{}
+
+void TypeLayoutCalculator::discardLayouts()
+{
+    tagTyLayouts_.clear();
+    fldLayouts_.clear();
+}
+
+TypeLayout TypeLayoutCalculator::layoutOf(const Type* ty)
+{
+    switch (ty->kind()) {
+        case TypeKind::Basic:
+            return layoutOfBasicType(ty->asBasicType()->kind());
+
+        case TypeKind::Pointer:
+            return layoutOfPointerType();
+
+        case TypeKind::Array: {
+            auto arrTy = ty->asArrayType();
+            auto elemTyLayout = layoutOf(arrTy->elementType());
+            if (!elemTyLayout.hasKnownSize())
+                return TypeLayout();
+            if (!arrTy->hasKnownSize())
+                return TypeLayout(elemTyLayout.alignment());
+            return TypeLayout(arrTy->size() * elemTyLayout.size(),
+                              elemTyLayout.alignment());
+        }
+
+        case TypeKind::Qualified:
+            return layoutOf(ty->asQualifiedType()->unqualifiedType());
+
+        case TypeKind::TypedefName: {
+            auto resolvedTy = ty->asTypedefNameType()->resolvedSynonymizedType();
+            if (!resolvedTy)
+                return TypeLayout();
+            return layoutOf(resolvedTy);
+        }
+
+        case TypeKind::Tag:
+            return layoutOfTagType(ty->asTagType());
+
+        // 6.2.5-19 and 6.5.3.4-1
+        case TypeKind::Void:
+        case TypeKind::Function:
+        case TypeKind::Error:
+            return TypeLayout();
+    }
+    PSY_ASSERT_1(false);
+    return TypeLayout();
+}
+
+FieldLayout TypeLayoutCalculator::layoutOf(const FieldDeclarationSymbol* fld)
+{
+    auto it = fldLayouts_.find(fld);
+    if (it != fldLayouts_.end())
+        return it->second;
+
+    auto containingSym = fld->containingSymbol();
+    if (!containingSym || !containingSym->asStructOrUnionDeclaration())
+        return FieldLayout();
+    layoutOfStructOrUnion(containingSym->asStructOrUnionDeclaration());
+
+    it = fldLayouts_.find(fld);
+    return it != fldLayouts_.end() ? it->second : FieldLayout();
+}
+
+TypeLayout TypeLayoutCalculator::layoutOfBasicType(BasicTypeKind basicTyK) const
+{
+    auto dataModel = platformOpts_.dataModel();
+    switch (basicTyK) {
+        case BasicTypeKind::Bool:
+            return TypeLayout(1, 1);
+
+        case BasicTypeKind::Float:
+            return TypeLayout(4, 4);
+
+        case BasicTypeKind::Double:
+            return TypeLayout(8, dataModel == PlatformOptions::DataModel::ILP32 ? 4 : 8);
+
+        case BasicTypeKind::LongDouble:
+            switch (dataModel) {
+                case PlatformOptions::DataModel::ILP32:
+                    return TypeLayout(12, 4);
+                case PlatformOptions::DataModel::LP64:
+                    return TypeLayout(16, 16);
+                case PlatformOptions::DataModel::LLP64:
+                    return TypeLayout(8, 8);
+            }
+            PSY_ASSERT_1(false);
+            return TypeLayout();
+
+        // 6.2.5-13
+        case BasicTypeKind::FloatComplex:
+        case BasicTypeKind::DoubleComplex:
+        case BasicTypeKind::LongDoubleComplex: {
+            auto realTyLayout = layoutOfBasicType(
+                        basicTyK == BasicTypeKind::FloatComplex
+                            ? BasicTypeKind::Float
+                            : basicTyK == BasicTypeKind::DoubleComplex
+                                ? BasicTypeKind::Double
+                                : BasicTypeKind::LongDouble);
+            return TypeLayout(2 * realTyLayout.size(), realTyLayout.alignment());
+        }
+
+        default: {
+            auto sz = sizeOfIntegerType(platformOpts_, basicTyK);
+            // Under ILP32, 64-bit integers are aligned as 32-bit ones.
+            return TypeLayout(sz,
+                              dataModel == PlatformOptions::DataModel::ILP32
+                                    ? std::min(sz, 4ULL)
+                                    : sz);
+        }
+    }
+}
+
+TypeLayout TypeLayoutCalculator::layoutOfPointerType() const
+{
+    switch (platformOpts_.dataModel()) {
+        case PlatformOptions::DataModel::ILP32:
+            return TypeLayout(4, 4);
+        case PlatformOptions::DataModel::LP64:
+        case PlatformOptions::DataModel::LLP64:
+            return TypeLayout(8, 8);
+    }
+    PSY_ASSERT_1(false);
+    return TypeLayout();
+}
+
+TypeLayout TypeLayoutCalculator::layoutOfTagType(const TagType* tagTy)
+{
+    switch (tagTy->kind()) {
+        case TagTypeKind::Struct:
+        case TagTypeKind::Union: {
+            auto tagTyDecl = tagTy->declaration();
+            if (!tagTyDecl || !tagTyDecl->asStructOrUnionDeclaration())
+                return TypeLayout();
+            return layoutOfStructOrUnion(tagTyDecl->asStructOrUnionDeclaration());
+        }
+
+        // 6.7.2.2-4: The compatible integer type is implementation-defined;
+        // like in GCC, it's taken as an int.
+        case TagTypeKind::Enum:
+            return layoutOfBasicType(BasicTypeKind::Int_S);
+    }
+    PSY_ASSERT_1(false);
+    return TypeLayout();
+}
+
+/**
+ * \remark 6.7.2.1-15 through 6.7.2.1-18
+ */
+TypeLayout TypeLayoutCalculator::layoutOfStructOrUnion(
+        const StructOrUnionDeclarationSymbol* tagTyDecl)
+{
+    auto it = tagTyLayouts_.find(tagTyDecl);
+    if (it != tagTyLayouts_.end())
+        return it->second;
+
+    // A structure or union can't contain an instance of itself.
+    if (!inCalculation_.insert(tagTyDecl).second)
+        return TypeLayout();
+
+    auto isUnion = tagTyDecl->kind() == SymbolKind::UnionDeclaration;
+    auto flds = tagTyDecl->fields();
+
+    // The next free bit of a structure, or the largest member of a union.
+    unsigned long long bitOffset = 0;
+    unsigned long long align = 1;
+    auto isKnown = true;
+    for (auto fldIt = flds.begin(); fldIt != flds.end(); ++fldIt) {
+        auto fld = *fldIt;
+        auto fldTyLayout = layoutOf(fld->type());
+        if (!fldTyLayout.hasKnownAlignment()) {
+            isKnown = false;
+            break;
+        }
+        auto fldAlignInBits = fldTyLayout.alignment() * 8;
+
+        if (fld->isBitField()) {
+            if (!fld->bitWidth().isKnown() || !fldTyLayout.hasKnownSize()) {
+                isKnown = false;
+                break;
+            }
+            auto width = fld->bitWidth().asUnsigned();
+            auto unitInBits = fldTyLayout.size() * 8;
+            if (isUnion) {
+                fldLayouts_[fld] = FieldLayout(0);
+                bitOffset = std::max(bitOffset, width);
+            }
+            else {
+                // A bit-field of width zero closes the current unit, and
+                // a bit-field that doesn't fit in its unit starts a new one.
+                if (width == 0
+                        || bitOffset / unitInBits != (bitOffset + width - 1) / unitInBits) {
+                    bitOffset = roundedUp(bitOffset, fldAlignInBits);
+                }
+                fldLayouts_[fld] = FieldLayout(bitOffset);
+                bitOffset += width;
+            }
+            // An unnamed bit-field doesn't affect the alignment.
+            if (!fld->name()->valueText().empty())
+                align = std::max(align, fldTyLayout.alignment());
+            continue;
+        }
+
+        if (!fldTyLayout.hasKnownSize()) {
+            // A flexible array member is the last member of a structure
+            // with more than one named member, and is declared as an array
+            // without a size; an array whose size isn't known otherwise
+            // (e.g., one that couldn't be evaluated) makes the layout unknown.
+            auto isFlexibleArrMemb = !isUnion
+                    && fldIt + 1 == flds.end()
+                    && fldIt != flds.begin()
+                    && isArrayOfUnspecifiedSize(fld->type());
+            if (!isFlexibleArrMemb) {
+                isKnown = false;
+                break;
+            }
+        }
+        auto szInBits = fldTyLayout.hasKnownSize() ? fldTyLayout.size() * 8 : 0;
+        if (isUnion) {
+            fldLayouts_[fld] = FieldLayout(0);
+            bitOffset = std::max(bitOffset, szInBits);
+        }
+        else {
+            bitOffset = roundedUp(bitOffset, fldAlignInBits);
+            fldLayouts_[fld] = FieldLayout(bitOffset);
+            bitOffset += szInBits;
+        }
+        align = std::max(align, fldTyLayout.alignment());
+    }
+    inCalculation_.erase(tagTyDecl);
+
+    if (!isKnown)
+        return TypeLayout();
+
+    TypeLayout tyLayout(roundedUp(roundedUp(bitOffset, 8) / 8, align), align);
+    tagTyLayouts_.emplace(tagTyDecl, tyLayout);
+    return tyLayout;
+}
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_TYPE_LAYOUT_CALCULATOR_H__
+#define PSYCHE_C_TYPE_LAYOUT_CALCULATOR_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "sema/FieldLayout.h"
+#include "sema/PlatformOptions.h"
+#include "sema/TypeLayout.h"
+#include "types/TypeKind_Basic.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The TypeLayoutCalculator class.
+ *
+ * Calculates the TypeLayout of types and the FieldLayout of fields, as
+ * of a data model, in the manner of the System V ABIs (without packing,
+ * nor alignment attributes). The layout of a structure or union (and of
+ * its fields) is calculated once and cached.
+ */
+class PSY_C_INTERNAL_API TypeLayoutCalculator final
+{
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+
+    TypeLayoutCalculator(const PlatformOptions& platformOpts);
+    TypeLayoutCalculator(const TypeLayoutCalculator&) = delete;
+    void operator=(const TypeLayoutCalculator&) = delete;
+
+    TypeLayout layoutOf(const Type* ty);
+    FieldLayout layoutOf(const FieldDeclarationSymbol* fld);
+
+    void discardLayouts();
+
+private:
+    const PlatformOptions& platformOpts_;
+    std::unordered_map<const TagDeclarationSymbol*, TypeLayout> tagTyLayouts_;
+    std::unordered_map<const FieldDeclarationSymbol*, FieldLayout> fldLayouts_;
+    std::unordered_set<const TagDeclarationSymbol*> inCalculation_;
+
+    TypeLayout layoutOfBasicType(BasicTypeKind basicTyK) const;
+    TypeLayout layoutOfPointerType() const;
+    TypeLayout layoutOfTagType(const TagType* tagTy);
+    TypeLayout layoutOfStructOrUnion(const StructOrUnionDeclarationSymbol* tagTyDecl);
+};
+
+} // C
+} // psy
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "UnusedDeclarationChecker.h"
+
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxUtilities.h"
+#include "syntax/SyntaxVisitor__MACROS__.inc"
+
+#include "../common/infra/Assertions.h"
+
+using namespace psy;
+using namespace C;
+
+UnusedDeclarationChecker::UnusedDeclarationChecker(SemanticModel* semaModel, const SyntaxTree* tree)
+    : SyntaxVisitor(tree)
+    , semaModel_(semaModel)
+    , diagReporter_(this)
+{}
+
+void UnusedDeclarationChecker::checkUnusedDeclarations()
+{
+    if (!semaModel_->referencesAreComplete())
+        return;
+    visit(tree_->root());
+}
+
+SyntaxVisitor::Action UnusedDeclarationChecker::visitTranslationUnit(const TranslationUnitSyntax* node)
+{
+    for (auto declIt = node->declarations(); declIt; declIt = declIt->next)
+        visit(declIt->value);
+
+    for (auto name : internalNames_) {
+        const auto& entity = internalEntities_.at(name);
+        if (entity.isDefined_ && !entity.isReferenced_)
+            diagReporter_.UnusedStaticDeclaration(entity.tk_);
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action UnusedDeclarationChecker::visitVariableAndOrFunctionDeclaration(
+        const VariableAndOrFunctionDeclarationSyntax* node)
+{
+    for (auto decltorIt = node->declarators(); decltorIt; decltorIt = decltorIt->next) {
+        auto decl = semaModel_->declarationBy(decltorIt->value);
+        if (!decl)
+            continue;
+        switch (decl->linkage()) {
+            case Linkage::Internal:
+                noteInternalEntity(
+                        decl,
+                        decltorIt->value,
+                        decl->asVariableDeclaration()
+                            && decl->enclosingScope()->kind() == ScopeKind::File);
+                break;
+
+            case Linkage::None:
+                if (decl->asVariableDeclaration() && !semaModel_->isReferenced(decl)) {
+                    diagReporter_.UnusedLocalVariable(
+                        SyntaxUtilities::innermostDeclaratorOf(decltorIt->value)->firstToken());
+                }
+                break;
+
+            case Linkage::External:
+                break;
+        }
+    }
+
+    return Action::Skip;
+}
+
+SyntaxVisitor::Action UnusedDeclarationChecker::visitFunctionDefinition(
+        const FunctionDefinitionSyntax* node)
+{
+    auto func = semaModel_->functionFor(node);
+    PSY_ASSERT_2(func, return Action::Quit);
+    if (func->linkage() == Linkage::Internal)
+        noteInternalEntity(func, node->declarator(), true);
+
+    VISIT(node->body());
+
+    return Action::Skip;
+}
+
+void UnusedDeclarationChecker::noteInternalEntity(
+        const DeclarationSymbol* decl,
+        const DeclaratorSyntax* decltor,
+        bool isDefinition)
+{
+    auto name = decl->denotingIdentifier();
+    auto isReferenced = semaModel_->isReferenced(decl);
+    auto it = internalEntities_.find(name);
+    if (it == internalEntities_.end()) {
+        internalNames_.push_back(name);
+        internalEntities_.emplace(
+                name,
+                InternalEntity {
+                    SyntaxUtilities::innermostDeclaratorOf(decltor)->firstToken(),
+                    isDefinition,
+                    isReferenced });
+        return;
+    }
+    it->second.isDefined_ |= isDefinition;
+    it->second.isReferenced_ |= isReferenced;
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_UNUSED_DECLARATION_CHECKER_H__
+#define PSYCHE_C_UNUSED_DECLARATION_CHECKER_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "syntax/SyntaxToken.h"
+#include "syntax/SyntaxVisitor.h"
+#include "../common/diagnostics/DiagnosticDescriptor.h"
+#include "../common/infra/AccessSpecifiers.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The UnusedDeclarationChecker class.
+ *
+ * Diagnoses the variables of block scope, and the objects and functions of
+ * \a internal \a linkage, that aren't referenced in a SyntaxTree.
+ *
+ * \remark The check relies on the references recorded by the ReferenceRecorder;
+ * if those are incomplete (e.g., because an identifier wasn't bound), nothing
+ * is diagnosed.
+ */
+class PSY_C_INTERNAL_API UnusedDeclarationChecker final : protected SyntaxVisitor
+{
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(Compilation);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelTester);
+
+    UnusedDeclarationChecker(SemanticModel* semaModel, const SyntaxTree* tree);
+    UnusedDeclarationChecker(const UnusedDeclarationChecker&) = delete;
+    void operator=(const UnusedDeclarationChecker&) = delete;
+
+    void checkUnusedDeclarations();
+
+private:
+    SemanticModel* semaModel_;
+
+    // The declarations of an identifier with internal linkage denote the
+    // same entity, so a reference to any of them is a use of it.
+    struct InternalEntity
+    {
+        SyntaxToken tk_;
+        bool isDefined_;
+        bool isReferenced_;
+    };
+    std::vector<const Identifier*> internalNames_;
+    std::unordered_map<const Identifier*, InternalEntity> internalEntities_;
+
+    struct DiagnosticsReporter
+    {
+        DiagnosticsReporter(UnusedDeclarationChecker* checker)
+            : checker_(checker)
+        {}
+        UnusedDeclarationChecker* checker_;
+
+        void diagnose(DiagnosticDescriptor&& desc, SyntaxToken tk);
+
+        void UnusedLocalVariable(SyntaxToken tk);
+        void UnusedStaticDeclaration(SyntaxToken tk);
+
+        static const std::string ID_of_UnusedLocalVariable;
+        static const std::string ID_of_UnusedStaticDeclaration;
+    };
+    DiagnosticsReporter diagReporter_;
+
+    void noteInternalEntity(const DeclarationSymbol* decl,
+                            const DeclaratorSyntax* decltor,
+                            bool isDefinition);
+
+    //--------------//
+    // Declarations //
+    //--------------//
+    virtual Action visitTranslationUnit(const TranslationUnitSyntax*) override;
+    virtual Action visitVariableAndOrFunctionDeclaration(const VariableAndOrFunctionDeclarationSyntax*) override;
+    virtual Action visitFunctionDefinition(const FunctionDefinitionSyntax*) override;
+};
+
+} // C
+} // psy
+
+#endif
@@ -26,6 +26,8 @@ using namespace C;
 
 extern "C" {
 
+PLUGIN_API int pluginApiVersion() { return PLUGIN_API_VERSION; }
+
 PLUGIN_API StdLibInterceptor* newInterceptor() { return new StdLibInterceptor; }
 PLUGIN_API void deleteInterceptor(StdLibInterceptor* p) { delete p; }
 
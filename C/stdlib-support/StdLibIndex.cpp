@@ -21,314 +21,456 @@
 #include "StdLibIndex.h"
 
 #include "sema/Compilation.h"
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "symbols/Symbol_ALL.h"
+#include "types/Type_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
+#include "syntax/SyntaxNodes.h"
+#include "syntax/SyntaxTree.h"
+#include "syntax/SyntaxUtilities.h"
+#include "syntax/SyntaxVisitor.h"
 
-#include <algorithm>
-#include <cstring>
-#include <iostream>
-#include <iterator>
+#include <array>
+#include <cstdint>
+#include <set>
 #include <unordered_set>
 
 using namespace psy;
 using namespace C;
 
-// C89/90
-const StdLibIndex::Index StdLibIndex::c89idx_
-    {
-        { "assert.h",
-            {
-                { "assert", SymbolKind::Value }
-            }
-        },
-        { "errno.h",
-            {
-                { "errno", SymbolKind::Value }
-            }
-        },
-        { "ctype.h",
-            {
-                { "isalnum", SymbolKind::Value },
-                { "isalpha", SymbolKind::Value },
-                { "islower", SymbolKind::Value },
-                { "isupper", SymbolKind::Value },
-                { "isdigit", SymbolKind::Value },
-                { "isxdigit", SymbolKind::Value },
-                { "iscntrl", SymbolKind::Value },
-                { "isgraph", SymbolKind::Value },
-                { "isspace", SymbolKind::Value },
-                { "isprint", SymbolKind::Value },
-                { "ispunch", SymbolKind::Value },
-                { "tolower", SymbolKind::Value },
-                { "toupper", SymbolKind::Value }
-            }
-        },
-        { "setjmp.h",
-            {
-                { "setjmp", SymbolKind::Value },
-                { "longjmp", SymbolKind::Value },
-                { "jmp_buf", SymbolKind::Type }
-            }
-        },
-        { "signal.h",
-            {
-                { "signal", SymbolKind::Value },
-                { "raise", SymbolKind::Value },
-                { "sig_atomic_t", SymbolKind::Type },
-                { "SIG_DFL", SymbolKind::Value },
-                { "SIG_IGN", SymbolKind::Value },
-                { "SIG_ERR", SymbolKind::Value },
-                { "SIGTERM", SymbolKind::Value },
-                { "SIGSEGV", SymbolKind::Value },
-                { "SIGINT", SymbolKind::Value },
-                { "SIGILL", SymbolKind::Value },
-                { "SIGABRT", SymbolKind::Value },
-                { "SIGFPE", SymbolKind::Value },
-            }
-        },
-        { "stdlib.h",
-            {
-                { "abort", SymbolKind::Value },
-                { "exit", SymbolKind::Value },
-                { "atexit", SymbolKind::Value },
-                { "EXIT_SUCCESS", SymbolKind::Value },
-                { "EXIT_FAILURE", SymbolKind::Value },
-                { "system", SymbolKind::Value },
-                { "getenv", SymbolKind::Value },
-                { "malloc", SymbolKind::Value },
-                { "calloc", SymbolKind::Value },
-                { "realloc", SymbolKind::Value },
-                { "free", SymbolKind::Value },
-                { "atof", SymbolKind::Value },
-                { "atoi", SymbolKind::Value },
-                { "atol", SymbolKind::Value },
-                { "strtol", SymbolKind::Value },
-                { "strtoul", SymbolKind::Value },
-                { "strtod", SymbolKind::Value },
-                { "strtold", SymbolKind::Value },
-                { "mblen", SymbolKind::Value },
-                { "mbtowc", SymbolKind::Value },
-                { "wctomb", SymbolKind::Value },
-                { "mbstowcs", SymbolKind::Value },
-                { "wcstombs", SymbolKind::Value },
-            }
-        },
-        { "string.h",
-            {
-                { "strcpy", SymbolKind::Value },
-                { "strncpy", SymbolKind::Value },
-                { "strcat", SymbolKind::Value },
-                { "strncat", SymbolKind::Value },
-                { "strxfrm", SymbolKind::Value },
-                { "strlen", SymbolKind::Value },
-                { "strcmp", SymbolKind::Value },
-                { "strncmp", SymbolKind::Value },
-                { "strcoll", SymbolKind::Value },
-                { "strchr", SymbolKind::Value },
-                { "strspn", SymbolKind::Value },
-                { "strcspn", SymbolKind::Value }
-            }
-        },
-        { "stdio.h",
-            {
-                { "fopen", SymbolKind::Value },
-                { "freopen", SymbolKind::Value },
-                { "fclose", SymbolKind::Value },
-                { "fflush", SymbolKind::Value },
-                { "setbuf", SymbolKind::Value },
-                { "setvbuf", SymbolKind::Value },
-                { "fwide", SymbolKind::Value },
-                { "fread", SymbolKind::Value },
-                { "fwrite", SymbolKind::Value },
-                { "fgetc", SymbolKind::Value },
-                { "getc", SymbolKind::Value },
-                { "fgets", SymbolKind::Value },
-                { "fputc", SymbolKind::Value },
-                { "putc", SymbolKind::Value },
-                { "fputs", SymbolKind::Value },
-                { "getchar", SymbolKind::Value },
-                { "gets", SymbolKind::Value },
-                { "putchar", SymbolKind::Value },
-                { "puts", SymbolKind::Value },
-                { "ungetc", SymbolKind::Value },
-                { "fgetwc", SymbolKind::Value },
-                { "getwc", SymbolKind::Value },
-                { "fgetws", SymbolKind::Value },
-                { "fputwc", SymbolKind::Value },
-                { "putwc", SymbolKind::Value },
-                { "fputws", SymbolKind::Value },
-                { "getwchar", SymbolKind::Value },
-                { "putwchar", SymbolKind::Value },
-                { "ungetwc", SymbolKind::Value },
-                { "scanf", SymbolKind::Value },
-                { "fscanf", SymbolKind::Value },
-                { "sscanf", SymbolKind::Value },
-                { "printf", SymbolKind::Value },
-                { "fprintf", SymbolKind::Value },
-                { "sprintf", SymbolKind::Value },
-                { "vprintf", SymbolKind::Value },
-                { "vfprintf", SymbolKind::Value },
-                { "vsprintf", SymbolKind::Value },
-                { "wscanf", SymbolKind::Value },
-                { "swscanf", SymbolKind::Value },
-                { "ftell", SymbolKind::Value },
-                { "fgetpos", SymbolKind::Value },
-                { "fseek", SymbolKind::Value },
-                { "fsetpos", SymbolKind::Value },
-                { "rewind", SymbolKind::Value },
-                { "clearerr", SymbolKind::Value },
-                { "feof", SymbolKind::Value },
-                { "ferror", SymbolKind::Value },
-                { "perror", SymbolKind::Value },
-                { "remove", SymbolKind::Value },
-                { "rename", SymbolKind::Value },
-                { "tmpfile", SymbolKind::Value },
-                { "tmpnam", SymbolKind::Value },
-                { "FILE", SymbolKind::Type },
-                { "fpos_t", SymbolKind::Type },
-                { "stdin", SymbolKind::Value },
-                { "stdout", SymbolKind::Value },
-                { "stderr", SymbolKind::Value },
-                { "EOF", SymbolKind::Value },
-                { "FOPEN_MAX", SymbolKind::Value },
-                { "FILENAME_MAX", SymbolKind::Value },
-                { "BUFSIZ", SymbolKind::Value },
-                { "_IOFBF", SymbolKind::Value },
-                { "_IOLBF", SymbolKind::Value },
-                { "_IONBF", SymbolKind::Value },
-                { "SEEK_SET", SymbolKind::Value },
-                { "SEEK_CUR", SymbolKind::Value },
-                { "SEEK_END", SymbolKind::Value },
-                { "TMP_MAX", SymbolKind::Value },
-                { "L_tmpnam", SymbolKind::Value }
-            }
-        },
-        { "wchar.h",
-            {
-                { "wchar_t", SymbolKind::Value },
-                { "mbstate_t", SymbolKind::Value },
+namespace {
+
+using Symbol = StdLibIndex::Symbol;
+using SymbolKind = StdLibIndex::SymbolKind;
+using Version = StdLibIndex::Version;
+
+constexpr Symbol kSymbols[] =
+{
+    // C89/90
+    { "assert", "assert.h", SymbolKind::Value, Version::C89 },
+    { "errno", "errno.h", SymbolKind::Value, Version::C89 },
+    { "isalnum", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isalpha", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "islower", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isupper", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isdigit", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isxdigit", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "iscntrl", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isgraph", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isspace", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "isprint", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "ispunct", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "tolower", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "toupper", "ctype.h", SymbolKind::Value, Version::C89 },
+    { "setjmp", "setjmp.h", SymbolKind::Value, Version::C89 },
+    { "longjmp", "setjmp.h", SymbolKind::Value, Version::C89 },
+    { "jmp_buf", "setjmp.h", SymbolKind::Type, Version::C89 },
+    { "signal", "signal.h", SymbolKind::Value, Version::C89 },
+    { "raise", "signal.h", SymbolKind::Value, Version::C89 },
+    { "sig_atomic_t", "signal.h", SymbolKind::Type, Version::C89 },
+    { "SIG_DFL", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIG_IGN", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIG_ERR", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGTERM", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGSEGV", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGINT", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGILL", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGABRT", "signal.h", SymbolKind::Value, Version::C89 },
+    { "SIGFPE", "signal.h", SymbolKind::Value, Version::C89 },
+    { "abort", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "exit", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "atexit", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "EXIT_SUCCESS", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "EXIT_FAILURE", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "system", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "getenv", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "malloc", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "calloc", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "realloc", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "free", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "atof", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "atoi", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "atol", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "strtol", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "strtoul", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "strtod", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "mblen", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "mbtowc", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "wctomb", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "mbstowcs", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "wcstombs", "stdlib.h", SymbolKind::Value, Version::C89 },
+    { "strcpy", "string.h", SymbolKind::Value, Version::C89 },
+    { "strncpy", "string.h", SymbolKind::Value, Version::C89 },
+    { "strcat", "string.h", SymbolKind::Value, Version::C89 },
+    { "strncat", "string.h", SymbolKind::Value, Version::C89 },
+    { "strxfrm", "string.h", SymbolKind::Value, Version::C89 },
+    { "strlen", "string.h", SymbolKind::Value, Version::C89 },
+    { "strcmp", "string.h", SymbolKind::Value, Version::C89 },
+    { "strncmp", "string.h", SymbolKind::Value, Version::C89 },
+    { "strcoll", "string.h", SymbolKind::Value, Version::C89 },
+    { "strchr", "string.h", SymbolKind::Value, Version::C89 },
+    { "strspn", "string.h", SymbolKind::Value, Version::C89 },
+    { "strcspn", "string.h", SymbolKind::Value, Version::C89 },
+    { "fopen", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "freopen", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fclose", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fflush", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "setbuf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "setvbuf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fwide", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fread", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fwrite", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fgetc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "getc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fgets", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fputc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "putc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fputs", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "getchar", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "gets", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "putchar", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "puts", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "ungetc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fgetwc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "getwc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fgetws", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fputwc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "putwc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fputws", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "getwchar", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "putwchar", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "ungetwc", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "scanf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fscanf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "sscanf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "printf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fprintf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "sprintf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "vprintf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "vfprintf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "vsprintf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "wscanf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "swscanf", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "ftell", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fgetpos", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fseek", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "fsetpos", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "rewind", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "clearerr", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "feof", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "ferror", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "perror", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "remove", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "rename", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "tmpfile", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "tmpnam", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "FILE", "stdio.h", SymbolKind::Type, Version::C89 },
+    { "fpos_t", "stdio.h", SymbolKind::Type, Version::C89 },
+    { "stdin", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "stdout", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "stderr", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "EOF", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "FOPEN_MAX", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "FILENAME_MAX", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "BUFSIZ", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "_IOFBF", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "_IOLBF", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "_IONBF", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "SEEK_SET", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "SEEK_CUR", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "SEEK_END", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "TMP_MAX", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "L_tmpnam", "stdio.h", SymbolKind::Value, Version::C89 },
+    { "wchar_t", "wchar.h", SymbolKind::Type, Version::C89 },
+    { "mbstate_t", "wchar.h", SymbolKind::Type, Version::C89 },
+    { "iswalnum", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswalpha", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswlower", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswupper", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswdigit", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswxdigit", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswcntrl", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswgraph", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswspace", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswblank", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswprint", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswpunct", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "iswctype", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "wctype_t", "wctype.h", SymbolKind::Type, Version::C89 },
+    { "wctrans_t", "wctype.h", SymbolKind::Type, Version::C89 },
+    { "wint_t", "wctype.h", SymbolKind::Type, Version::C89 },
+    { "towlower", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "towupper", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "towctrans", "wctype.h", SymbolKind::Value, Version::C89 },
+    { "wctrans", "wctype.h", SymbolKind::Value, Version::C89 },
+    // C99
+    { "isblank", "ctype.h", SymbolKind::Value, Version::C99 },
+    { "_Exit", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "atoll", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "strtoll", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "strtoull", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "strtof", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "strtold", "stdlib.h", SymbolKind::Value, Version::C99 },
+    { "strtoimax", "inttypes.h", SymbolKind::Value, Version::C99 },
+    { "strtoumax", "inttypes.h", SymbolKind::Value, Version::C99 },
+    // C11
+    { "static_assert", "assert.h", SymbolKind::Value, Version::C11 },
+    { "errno_t", "errno.h", SymbolKind::Type, Version::C11 },
+    { "strcpy_s", "string.h", SymbolKind::Value, Version::C11 },
+    { "strncpy_s", "string.h", SymbolKind::Value, Version::C11 },
+    { "strcat_s", "string.h", SymbolKind::Value, Version::C11 },
+    { "strncat_s", "string.h", SymbolKind::Value, Version::C11 },
+    { "strnlen_s", "string.h", SymbolKind::Value, Version::C11 },
+    { "quick_exit", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "at_quick_exit", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "getenv_s", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "aligned_alloc", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "wctomb_s", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "mbstowcs_s", "stdlib.h", SymbolKind::Value, Version::C11 },
+    { "wcstombs_s", "stdlib.h", SymbolKind::Value, Version::C11 },
+};
+
+constexpr std::size_t kSymbolCnt = sizeof(kSymbols) / sizeof(kSymbols[0]);
+
+/*
+ * The table is a "hash and displace" one: an identifier is first hashed
+ * into a bucket, whose (precomputed) seed is then used to rehash it into
+ * a slot that no other identifier occupies.
+ */
+constexpr std::size_t kBucketCnt = kSymbolCnt / 4 + 1;
+constexpr std::size_t kSlotCnt = [] {
+    std::size_t n = 1;
+    while (n < 2 * kSymbolCnt)
+        n <<= 1;
+    return n;
+}();
+constexpr std::size_t kMaxBucketSize = 16;
+
+constexpr std::uint32_t hash(std::string_view s, std::uint32_t seed)
+{
+    // FNV-1a.
+    std::uint32_t h = 2166136261u ^ seed;
+    for (auto c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+constexpr std::size_t bucketOf(std::string_view s)
+{
+    return hash(s, 0) % kBucketCnt;
+}
+
+constexpr std::size_t slotOf(std::string_view s, std::uint32_t seed)
+{
+    return hash(s, seed) & (kSlotCnt - 1);
+}
+
+struct PerfectHash
+{
+    std::array<std::uint32_t, kBucketCnt> seeds_ {};
+    std::array<std::int16_t, kSlotCnt> slots_ {};
+};
+
+constexpr PerfectHash buildPerfectHash()
+{
+    PerfectHash ph;
+    for (auto& slot : ph.slots_)
+        slot = -1;
+
+    std::array<std::size_t, kBucketCnt> sizes {};
+    for (std::size_t i = 0; i < kSymbolCnt; ++i)
+        ++sizes[bucketOf(kSymbols[i].name_)];
+
+    // Place the largest buckets first, while the table is emptier.
+    for (std::size_t size = kMaxBucketSize; size > 0; --size) {
+        for (std::size_t b = 0; b < kBucketCnt; ++b) {
+            if (sizes[b] != size)
+                continue;
+
+            std::array<std::size_t, kMaxBucketSize> members {};
+            std::size_t cnt = 0;
+            for (std::size_t i = 0; i < kSymbolCnt; ++i) {
+                if (bucketOf(kSymbols[i].name_) == b)
+                    members[cnt++] = i;
             }
-        },
-        { "wctype.h",
-            {
-                { "iswalnum", SymbolKind::Value },
-                { "iswalpha", SymbolKind::Value },
-                { "iswlower", SymbolKind::Value },
-                { "iswupper", SymbolKind::Value },
-                { "iswdigit", SymbolKind::Value },
-                { "iswxdigit", SymbolKind::Value },
-                { "iswcntrl", SymbolKind::Value },
-                { "iswgraph", SymbolKind::Value },
-                { "iswspace", SymbolKind::Value },
-                { "iswblank", SymbolKind::Value },
-                { "iswprint", SymbolKind::Value },
-                { "iswpunct", SymbolKind::Value },
-                { "iswctype", SymbolKind::Value },
-                { "wctype_t", SymbolKind::Type },
-                { "wctrans_t", SymbolKind::Type },
-                { "wint_t", SymbolKind::Type },
-                { "towlower", SymbolKind::Value },
-                { "towupper", SymbolKind::Value },
-                { "towctrans", SymbolKind::Value },
-                { "wctrans", SymbolKind::Value }
+
+            for (std::uint32_t seed = 1; ; ++seed) {
+                std::array<std::size_t, kMaxBucketSize> slots {};
+                bool fits = true;
+                for (std::size_t m = 0; fits && m < cnt; ++m) {
+                    slots[m] = slotOf(kSymbols[members[m]].name_, seed);
+                    if (ph.slots_[slots[m]] != -1)
+                        fits = false;
+                    for (std::size_t n = 0; fits && n < m; ++n) {
+                        if (slots[n] == slots[m])
+                            fits = false;
+                    }
+                }
+                if (!fits)
+                    continue;
+
+                ph.seeds_[b] = seed;
+                for (std::size_t m = 0; m < cnt; ++m)
+                    ph.slots_[slots[m]] = static_cast<std::int16_t>(members[m]);
+                break;
             }
         }
-    };
+    }
+
+    return ph;
+}
+
+constexpr PerfectHash kPerfectHash = buildPerfectHash();
+
+constexpr bool bucketsAreSmall()
+{
+    std::array<std::size_t, kBucketCnt> sizes {};
+    for (std::size_t i = 0; i < kSymbolCnt; ++i) {
+        if (++sizes[bucketOf(kSymbols[i].name_)] > kMaxBucketSize)
+            return false;
+    }
+    return true;
+}
+
+static_assert(bucketsAreSmall(), "bucket too large");
+
+/*
+ * Collect the identifiers (in expressions and as typedef names) that don't
+ * resolve to a declaration.
+ */
+class UnresolvedIdentifiersCollector final : public SyntaxVisitor
+{
+public:
+    UnresolvedIdentifiersCollector(const SemanticModel* semaModel)
+        : SyntaxVisitor(semaModel->syntaxTree())
+        , semaModel_(semaModel)
+        , fileScope_(nullptr)
+    {}
+
+    std::vector<std::string_view> collect()
+    {
+        visit(tree_->root());
+
+        // The scope of a typedef name isn't recorded, so it's looked up in
+        // the file scope and, failing that, among the typedefs declared in
+        // any block (not only in the blocks that enclose the name).
+        for (auto ident : tydefNames_) {
+            if (blockTydefNameSet_.count(ident))
+                continue;
+            if (!fileScope_
+                    || !fileScope_->searchForDeclaration(ident, NameSpace::OrdinaryIdentifiers))
+                addUnresolved(ident);
+        }
+        return std::move(unresolved_);
+    }
 
-// C99
-const StdLibIndex::Index StdLibIndex::c99idx_
+    Action visitIdentifierName(const IdentifierNameSyntax* node) override
     {
-        { "ctype.h",
-            {
-                { "isblank", SymbolKind::Value }
-            }
-        },
-        { "stdlib.h",
-            {
-                { "_Exit", SymbolKind::Value },
-                { "atoll", SymbolKind::Value },
-                { "strtoll", SymbolKind::Value },
-                { "strtoull", SymbolKind::Value },
-                { "strtof", SymbolKind::Value },
-                { "strtold", SymbolKind::Value },
-                { "strtoimax", SymbolKind::Value },
-                { "strtoumax", SymbolKind::Value }
-            }
-        },
-        { "inttypes.h",
-            {
-                { "strtoimax", SymbolKind::Value },
-                { "strtoumax", SymbolKind::Value }
-            }
+        // An identifier that resolves in one scope may not resolve in another,
+        // so only an unresolved one is known to need no further lookup.
+        auto ident = identifierFrom(node);
+        if (unresolvedSet_.count(ident))
+            return Action::Skip;
+
+        auto scope = semaModel_->scopeOf(node);
+        if (scope) {
+            noteFileScope(scope);
+            if (scope->searchForDeclaration(ident, NameSpace::OrdinaryIdentifiers))
+                return Action::Skip;
         }
-    };
+        addUnresolved(ident);
+
+        return Action::Skip;
+    }
 
-// C11
-const StdLibIndex::Index StdLibIndex::c11idx_
+    Action visitTypedefName(const TypedefNameSyntax* node) override
     {
-        { "assert.h",
-            {
-                { "static_assert", SymbolKind::Value }
-            }
-        },
-        { "errno.h",
-            {
-                { "errno_t", SymbolKind::Type }
-            }
-        },
-        { "string.h",
-            {
-                { "strcpy_s", SymbolKind::Value },
-                { "strncpy_s", SymbolKind::Value },
-                { "strcat_s", SymbolKind::Value },
-                { "strncat_s", SymbolKind::Value },
-                { "strnlen_s", SymbolKind::Value }
-            }
-        },
-        { "stdlib.h",
-            {
-                { "quick_exit", SymbolKind::Value },
-                { "at_quick_exit", SymbolKind::Value },
-                { "getenv_s", SymbolKind::Value },
-                { "aligned_alloc", SymbolKind::Value },
-                { "wctomb_s", SymbolKind::Value },
-                { "mbstowcs_s", SymbolKind::Value },
-                { "wcstombs_s", SymbolKind::Value },
-            }
+        auto ident = node->identifierToken().lexeme()->asIdentifier();
+        if (tydefNameSet_.insert(ident).second)
+            tydefNames_.push_back(ident);
+
+        return Action::Skip;
+    }
+
+    Action visitIdentifierDeclarator(const IdentifierDeclaratorSyntax* node) override
+    {
+        auto decl = semaModel_->declarationBy(node);
+        if (!decl || !decl->enclosingScope())
+            return Action::Visit;
+
+        noteFileScope(decl->enclosingScope());
+        if (decl->asTypedefDeclaration()
+                && decl->enclosingScope()->kind() == ScopeKind::Block) {
+            auto tydefDecl = decl->asTypedefDeclaration();
+            blockTydefNameSet_.insert(tydefDecl->introducedSynonymType()->typedefName());
         }
-    };
 
+        return Action::Visit;
+    }
+
+private:
+    const SemanticModel* semaModel_;
+    const Scope* fileScope_;
+    std::unordered_set<const Identifier*> tydefNameSet_;
+    std::vector<const Identifier*> tydefNames_;
+    std::unordered_set<const Identifier*> blockTydefNameSet_;
+    std::unordered_set<const Identifier*> unresolvedSet_;
+    std::vector<std::string_view> unresolved_;
+
+    void noteFileScope(const Scope* scope)
+    {
+        if (fileScope_)
+            return;
+        fileScope_ = scope;
+        while (fileScope_->outerScope())
+            fileScope_ = fileScope_->outerScope();
+    }
+
+    void addUnresolved(const Identifier* ident)
+    {
+        if (unresolvedSet_.insert(ident).second)
+            unresolved_.emplace_back(ident->c_str(), ident->size());
+    }
+};
+
+} // anonymous
 
 StdLibIndex::StdLibIndex(Version std)
     : std_(std)
 {}
 
-std::vector<std::string> StdLibIndex::inspect(const Compilation& c) const
+std::vector<std::string> StdLibIndex::inspect(const Compilation& compilation) const
 {
-    std::vector<std::string> v;
-
-    //...
-
-    return v;
+    std::set<std::string> headers;
+    for (auto tree : compilation.syntaxTrees()) {
+        auto semaModel = compilation.computeSemanticModel(tree);
+        UnresolvedIdentifiersCollector collector(semaModel);
+        for (auto name : collector.collect()) {
+            auto sym = lookUp(name);
+            if (sym)
+                headers.insert(sym->header_);
+        }
+    }
+    return std::vector<std::string>(headers.begin(), headers.end());
 }
 
 bool StdLibIndex::recognizes(const char* ident) const
 {
-    // TODO: Index by string length.
+    return lookUp(ident) != nullptr;
+}
 
-    auto f = [ident] (const Index& idx) {
-        for (const auto& v : idx) {
-            for (const auto& api : v.second) {
-                if (!strcmp(api.first, ident))
-                    return true;
-            }
-        }
-        return false;
-    };
-
-    return f(c89idx_)
-                ? true
-                : std_ == Version::C99 && f(c99idx_)
-                    ? true
-                    : std_ == Version::C11
-                        ? f(c11idx_)
-                        : false;
+const StdLibIndex::Symbol* StdLibIndex::lookUp(std::string_view ident) const
+{
+    auto seed = kPerfectHash.seeds_[bucketOf(ident)];
+    auto idx = kPerfectHash.slots_[slotOf(ident, seed)];
+    if (idx == -1)
+        return nullptr;
+
+    const auto& sym = kSymbols[idx];
+    if (ident != sym.name_ || sym.std_ > std_)
+        return nullptr;
+    return &sym;
 }
@@ -23,42 +23,67 @@
 
 #include "Fwds.h"
 #include <string>
-#include <unordered_map>
-#include <utility>
+#include <string_view>
 #include <vector>
 
 namespace psy {
 namespace C {
 
+/**
+ * \brief The StdLibIndex class.
+ *
+ * An index, from identifier to the standard header that declares it, built
+ * (at compile time) as a perfect hash table.
+ */
 class StdLibIndex final
 {
 public:
-    enum class Version
+    enum class Version : char
     {
         C89,
         C99,
         C11
     };
 
+    enum class SymbolKind : char
+    {
+        Type,
+        Value
+    };
+
+    /**
+     * \brief The StdLibIndex::Symbol struct.
+     */
+    struct Symbol
+    {
+        const char* name_;
+        const char* header_;
+        SymbolKind kind_;
+        Version std_;
+    };
+
     StdLibIndex(Version std);
 
+    /**
+     * The (minimal) set of headers that declare the identifiers that are
+     * left unresolved in the given Compilation, sorted by name.
+     */
     std::vector<std::string> inspect(const Compilation&) const;
 
+    /**
+     * Whether the identifier \p ident is that of a Symbol in the standard
+     * version of \c this StdLibIndex.
+     */
     bool recognizes(const char* ident) const;
 
-private:
-    enum class SymbolKind : char
-    {
-        Type,
-        Value
-    };
-    using StdSymbol = std::pair<const char*, SymbolKind>;
-    using Index = std::unordered_map<const char*, std::vector<StdSymbol>>;
+    /**
+     * The Symbol of identifier \p ident in the standard version of \c this
+     * StdLibIndex, if any.
+     */
+    const Symbol* lookUp(std::string_view ident) const;
 
+private:
     Version std_;
-    static const Index c89idx_;
-    static const Index c99idx_;
-    static const Index c11idx_;
 };
 
 } // C
@@ -20,10 +20,40 @@
 
 #include "StdLibInspector.h"
 
+#include "sema/Compilation.h"
+#include "syntax/SyntaxTree.h"
+
 using namespace psy;
 using namespace C;
 
-std::vector<std::string> StdLibInspector::detectRequiredHeaders(const std::string& source)
+namespace {
+
+StdLibIndex::Version versionOf(LanguageDialect::Std std)
 {
-    return { };
+    switch (std) {
+        case LanguageDialect::Std::C89_90:
+            return StdLibIndex::Version::C89;
+        case LanguageDialect::Std::C99:
+            return StdLibIndex::Version::C99;
+        case LanguageDialect::Std::C11:
+        case LanguageDialect::Std::C17_18:
+            return StdLibIndex::Version::C11;
+    }
+    return StdLibIndex::Version::C11;
+}
+
+} // anonymous
+
+std::vector<std::string> StdLibInspector::detectRequiredHeaders(const std::string& source,
+                                                                LanguageDialect::Std std)
+{
+    auto tree = SyntaxTree::parseText(source,
+                                      TextPreprocessingState::Unpreprocessed,
+                                      TextCompleteness::Fragment,
+                                      ParseOptions(LanguageDialect(std)));
+    auto compilation = Compilation::create(tree->filePath());
+    compilation->addSyntaxTree(tree.get());
+
+    StdLibIndex index(versionOf(std));
+    return index.inspect(*compilation);
 }
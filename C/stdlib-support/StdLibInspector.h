@@ -21,6 +21,7 @@
 #ifndef PSYCHE_STDLIB_SOURCE_INSPECTOR_H__
 #define PSYCHE_STDLIB_SOURCE_INSPECTOR_H__
 
+#include "StdLibIndex.h"
 #include "plugin-api/SourceInspector.h"
 
 namespace psy {
@@ -29,7 +30,10 @@ namespace C {
 class StdLibInspector final : SourceInspector
 {
 public:
-    std::vector<std::string> detectRequiredHeaders(const std::string&) override;
+    using SourceInspector::detectRequiredHeaders;
+
+    std::vector<std::string> detectRequiredHeaders(const std::string&,
+                                                   LanguageDialect::Std) override;
 };
 
 } // C
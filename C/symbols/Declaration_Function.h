@@ -63,6 +63,7 @@ public:
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     DECL_PIMPL_SUB(Function);
     FunctionDeclarationSymbol(const Symbol* containingSym,
@@ -38,7 +38,10 @@ struct MemberDeclarationSymbol::MemberDeclarationImpl : DeclarationImpl
                           containingSym,
                           tree,
                           enclosingScope,
-                          NameSpace::Members)
+                          // 6.2.3-1: Enumeration constants are ordinary identifiers.
+                          symK == SymbolKind::EnumeratorDeclaration
+                              ? NameSpace::OrdinaryIdentifiers
+                              : NameSpace::Members)
         , name_(nullptr)
         , ty_(nullptr)
     {}
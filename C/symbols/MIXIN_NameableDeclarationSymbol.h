@@ -42,6 +42,7 @@ public:
 
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     virtual void setName(const Identifier* name) = 0;
 };
@@ -44,6 +44,7 @@ public:
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     virtual void setType(const Type* ty) = 0;
 };
@@ -40,6 +40,16 @@ EnumeratorDeclarationSymbol::EnumeratorDeclarationSymbol(
                               enclosingScope)
 {}
 
+ConstantValue EnumeratorDeclarationSymbol::value() const
+{
+    return val_;
+}
+
+void EnumeratorDeclarationSymbol::setValue(ConstantValue val)
+{
+    val_ = val;
+}
+
 namespace psy {
 namespace C {
 
@@ -50,6 +60,8 @@ std::ostream& operator<<(std::ostream& os, const EnumeratorDeclarationSymbol* en
     os << "<Enumerator |";
     os << " name:" << enumerator->name()->valueText();
     os << " type:" << enumerator->type();
+    if (enumerator->value().isKnown())
+        os << " value:" << enumerator->value().asSigned();
     os << ">";
     return os;
 }
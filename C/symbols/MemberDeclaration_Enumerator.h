@@ -23,6 +23,8 @@
 
 #include "Declaration_Member.h"
 
+#include "sema/ConstantValue.h"
+
 namespace psy {
 namespace C {
 
@@ -40,12 +42,26 @@ public:
     virtual const EnumeratorDeclarationSymbol* asEnumeratorDeclaration() const override { return this; }
     //!@}
 
+    /**
+     * The value of \c this EnumeratorDeclarationSymbol.
+     *
+     * \remark 6.7.2.2-3
+     */
+    ConstantValue value() const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     EnumeratorDeclarationSymbol(const Symbol* containingSym,
                                 const SyntaxTree* tree,
                                 const Scope* enclosingScope);
+
+    void setValue(ConstantValue val);
+
+private:
+    ConstantValue val_;
 };
 
 PSY_C_API std::ostream& operator<<(std::ostream& os, const EnumeratorDeclarationSymbol* enumerator);
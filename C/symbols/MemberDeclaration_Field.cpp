@@ -38,6 +38,7 @@ FieldDeclarationSymbol::FieldDeclarationSymbol(
                               containingSym,
                               tree,
                               enclosingScope)
+    , isBitFld_(false)
 {}
 
 bool FieldDeclarationSymbol::isAnonymousStructureOrUnion() const
@@ -47,6 +48,22 @@ bool FieldDeclarationSymbol::isAnonymousStructureOrUnion() const
             && type()->asTagType()->isUntagged();
 }
 
+bool FieldDeclarationSymbol::isBitField() const
+{
+    return isBitFld_;
+}
+
+ConstantValue FieldDeclarationSymbol::bitWidth() const
+{
+    return bitWidth_;
+}
+
+void FieldDeclarationSymbol::setBitWidth(ConstantValue width)
+{
+    isBitFld_ = true;
+    bitWidth_ = width;
+}
+
 namespace psy {
 namespace C {
 
@@ -57,6 +74,8 @@ std::ostream& operator<<(std::ostream& os, const FieldDeclarationSymbol* fld)
     os << "<Field |";
     os << " name:" << fld->name()->valueText();
     os << " type:" << fld->type();
+    if (fld->isBitField() && fld->bitWidth().isKnown())
+        os << " bit-width:" << fld->bitWidth().asUnsigned();
     os << ">";
     return os;
 }
@@ -23,6 +23,8 @@
 
 #include "Declaration_Member.h"
 
+#include "sema/ConstantValue.h"
+
 namespace psy {
 namespace C {
 
@@ -45,12 +47,34 @@ public:
 
     bool isAnonymousStructureOrUnion() const;
 
+    /**
+     * Whether \c this FieldDeclarationSymbol is a \a bit-field.
+     *
+     * \remark 6.7.2.1-9
+     */
+    bool isBitField() const;
+
+    /**
+     * The width, in bits, of \c this FieldDeclarationSymbol, if it's a \a bit-field.
+     *
+     * \remark 6.7.2.1-4
+     */
+    ConstantValue bitWidth() const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     FieldDeclarationSymbol(const Symbol* containingSym,
                            const SyntaxTree* tree,
                            const Scope* enclosingScope);
+
+    void setBitWidth(ConstantValue width);
+
+private:
+    bool isBitFld_;
+    ConstantValue bitWidth_;
 };
 
 PSY_C_API std::ostream& operator<<(std::ostream& os, const FieldDeclarationSymbol* fld);
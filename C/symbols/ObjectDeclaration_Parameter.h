@@ -45,6 +45,7 @@ public:
 
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     ParameterDeclarationSymbol(const Symbol* containingSym,
               const SyntaxTree* tree,
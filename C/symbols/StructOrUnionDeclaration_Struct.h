@@ -43,6 +43,7 @@ public:
 
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     StructDeclarationSymbol(
             const Symbol* containingSym,
@@ -49,6 +49,16 @@ const NameSpace DeclarationSymbol::nameSpace() const
     return NameSpace(P->F_.ns_);
 }
 
+Linkage DeclarationSymbol::linkage() const
+{
+    return Linkage(P->F_.linkage_);
+}
+
+void DeclarationSymbol::setLinkage(Linkage linkage)
+{
+    P->F_.linkage_ = static_cast<std::uint32_t>(linkage);
+}
+
 DeclarationCategory DeclarationSymbol::category() const
 {
     switch (kind()) {
@@ -26,6 +26,7 @@
 
 #include "Symbol.h"
 #include "DeclarationCategory.h"
+#include "Linkage.h"
 #include "sema/NameSpace.h"
 #include "syntax/SyntaxReference.h"
 #include "../common/location/Location.h"
@@ -68,6 +69,13 @@ public:
      */
     const NameSpace nameSpace() const;
 
+    /**
+     * The Linkage of \c this DeclarationSymbol.
+     *
+     * \remark 6.2.2
+     */
+    Linkage linkage() const;
+
 protected:
     DECL_PIMPL_SUB(Declaration);
     DeclarationSymbol(DeclarationImpl* p);
@@ -79,6 +87,11 @@ protected:
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(Scope);
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
+    PSY_GRANT_INTERNAL_ACCESS(SymbolIndex);
+    PSY_GRANT_INTERNAL_ACCESS(LinkageResolver);
+    PSY_GRANT_INTERNAL_ACCESS(UnusedDeclarationChecker);
+
+    void setLinkage(Linkage linkage);
 };
 
 PSY_C_API std::ostream& operator<<(std::ostream& os, const DeclarationSymbol* decl);
@@ -21,6 +21,10 @@
 #include "Symbol__IMPL__.inc"
 #include "Symbol_Program.h"
 
+#include "symbols/Symbol_ALL.h"
+
+#include <algorithm>
+
 using namespace psy;
 using namespace C;
 
@@ -33,7 +37,150 @@ struct ProgramSymbol::ProgramImpl : SymbolImpl
 
 ProgramSymbol::ProgramSymbol()
     : Symbol(new ProgramImpl)
+    , nextTagGroup_(0)
+{
+}
+
+std::vector<const DeclarationSymbol*> ProgramSymbol::externalDeclarationsNamed(
+        const std::string& name) const
+{
+    std::vector<const DeclarationSymbol*> decls;
+    auto externDecls = externalDeclarations(name);
+    if (!externDecls)
+        return decls;
+    decls.reserve(externDecls->size());
+    for (const auto& externDecl : *externDecls)
+        decls.push_back(externDecl.decl_);
+    return decls;
+}
+
+const DeclarationSymbol* ProgramSymbol::externalDefinitionNamed(const std::string& name) const
+{
+    auto externDecls = externalDeclarations(name);
+    if (!externDecls)
+        return nullptr;
+    const DeclarationSymbol* tentativeDef = nullptr;
+    for (const auto& externDecl : *externDecls) {
+        switch (externDecl.defK_) {
+            case DefinitionKind::None:
+                break;
+            case DefinitionKind::Tentative:
+                if (!tentativeDef)
+                    tentativeDef = externDecl.decl_;
+                break;
+            case DefinitionKind::Full:
+                return externDecl.decl_;
+        }
+    }
+    return tentativeDef;
+}
+
+std::vector<const TagDeclarationSymbol*> ProgramSymbol::compatibleTagDeclarations(
+        const TagDeclarationSymbol* tagDecl) const
+{
+    std::vector<const TagDeclarationSymbol*> tagDecls;
+    auto nameIt = tagNames_.find(tagDecl);
+    if (nameIt == tagNames_.end())
+        return tagDecls;
+    const auto& linkedTagDecls = tagDecls_.at(nameIt->second);
+    auto it = std::find_if(linkedTagDecls.begin(),
+                           linkedTagDecls.end(),
+                           [tagDecl] (const auto& linkedTagDecl) {
+                               return linkedTagDecl.tagDecl_ == tagDecl;
+                           });
+    PSY_ASSERT_2(it != linkedTagDecls.end(), return tagDecls);
+    for (const auto& linkedTagDecl : linkedTagDecls) {
+        if (linkedTagDecl.group_ == it->group_)
+            tagDecls.push_back(linkedTagDecl.tagDecl_);
+    }
+    return tagDecls;
+}
+
+const std::vector<ProgramSymbol::ExternalDeclaration>* ProgramSymbol::externalDeclarations(
+        const std::string& name) const
 {
+    auto it = externDecls_.find(name);
+    if (it == externDecls_.end())
+        return nullptr;
+    return &it->second;
+}
+
+void ProgramSymbol::addExternalDeclaration(const std::string& name, ExternalDeclaration externDecl)
+{
+    externDecls_[name].push_back(externDecl);
+}
+
+std::vector<const TagDeclarationSymbol*> ProgramSymbol::tagDeclarationsNamed(
+        const std::string& name) const
+{
+    std::vector<const TagDeclarationSymbol*> tagDecls;
+    auto it = tagDecls_.find(name);
+    if (it == tagDecls_.end())
+        return tagDecls;
+    for (const auto& linkedTagDecl : it->second)
+        tagDecls.push_back(linkedTagDecl.tagDecl_);
+    return tagDecls;
+}
+
+void ProgramSymbol::addTagDeclaration(
+        const std::string& name,
+        const TagDeclarationSymbol* tagDecl,
+        const SyntaxTree* tree,
+        const TagDeclarationSymbol* compatibleTagDecl)
+{
+    auto& linkedTagDecls = tagDecls_[name];
+    auto group = nextTagGroup_;
+    if (compatibleTagDecl) {
+        auto it = std::find_if(linkedTagDecls.begin(),
+                               linkedTagDecls.end(),
+                               [compatibleTagDecl] (const auto& linkedTagDecl) {
+                                   return linkedTagDecl.tagDecl_ == compatibleTagDecl;
+                               });
+        PSY_ASSERT_1(it != linkedTagDecls.end());
+        if (it != linkedTagDecls.end())
+            group = it->group_;
+    }
+    if (group == nextTagGroup_)
+        ++nextTagGroup_;
+    linkedTagDecls.push_back({ tagDecl, tree, group });
+    tagNames_[tagDecl] = name;
+}
+
+void ProgramSymbol::discardDeclarations(const SyntaxTree* tree)
+{
+    for (auto it = externDecls_.begin(); it != externDecls_.end();) {
+        auto& externDecls = it->second;
+        externDecls.erase(
+                std::remove_if(externDecls.begin(),
+                               externDecls.end(),
+                               [tree] (const auto& externDecl) {
+                                   return externDecl.tree_ == tree;
+                               }),
+                externDecls.end());
+        if (externDecls.empty())
+            it = externDecls_.erase(it);
+        else
+            ++it;
+    }
+
+    for (auto it = tagDecls_.begin(); it != tagDecls_.end();) {
+        auto& linkedTagDecls = it->second;
+        for (const auto& linkedTagDecl : linkedTagDecls) {
+            if (linkedTagDecl.tree_ == tree)
+                tagNames_.erase(linkedTagDecl.tagDecl_);
+        }
+        linkedTagDecls.erase(
+                std::remove_if(linkedTagDecls.begin(),
+                               linkedTagDecls.end(),
+                               [tree] (const auto& linkedTagDecl) {
+                                   return linkedTagDecl.tree_ == tree;
+                               }),
+                linkedTagDecls.end());
+        if (linkedTagDecls.empty())
+            it = tagDecls_.erase(it);
+        else
+            ++it;
+    }
 }
 
 namespace psy {
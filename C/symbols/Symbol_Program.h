@@ -29,6 +29,11 @@
 #include "../common/infra/AccessSpecifiers.h"
 #include "../common/infra/Pimpl.h"
 
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace psy {
 namespace C {
 
@@ -48,12 +53,76 @@ public:
     virtual const ProgramSymbol* asProgram() const override { return this; }
     //!@}
 
+    /**
+     * The declarations, throughout the TranslationUnits of \c this Program,
+     * of the object or function named \p name with \a external \a linkage.
+     *
+     * \remark 6.2.2-2
+     */
+    std::vector<const DeclarationSymbol*> externalDeclarationsNamed(const std::string& name) const;
+
+    /**
+     * The \a external \a definition, if any, of the object or function named
+     * \p name with \a external \a linkage. A \a tentative \a definition is
+     * the result only in the absence of any other \a definition.
+     *
+     * \remark 6.9-5 and 6.9.2
+     */
+    const DeclarationSymbol* externalDefinitionNamed(const std::string& name) const;
+
+    /**
+     * The TagDeclarationSymbols, throughout the TranslationUnits of \c this
+     * Program, whose types are compatible with that of \p tagDecl (which is
+     * itself included).
+     *
+     * \remark 6.2.7-1
+     */
+    std::vector<const TagDeclarationSymbol*> compatibleTagDeclarations(
+            const TagDeclarationSymbol* tagDecl) const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(Compilation);
     PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    PSY_GRANT_INTERNAL_ACCESS(LinkageResolver);
 
     DECL_PIMPL_SUB(Program);
     ProgramSymbol();
+
+    enum class DefinitionKind : std::uint8_t
+    {
+        None,
+        Tentative,
+        Full,
+    };
+
+    struct ExternalDeclaration
+    {
+        const DeclarationSymbol* decl_;
+        const SyntaxTree* tree_;
+        DefinitionKind defK_;
+    };
+
+    const std::vector<ExternalDeclaration>* externalDeclarations(const std::string& name) const;
+    void addExternalDeclaration(const std::string& name, ExternalDeclaration externDecl);
+    std::vector<const TagDeclarationSymbol*> tagDeclarationsNamed(const std::string& name) const;
+    void addTagDeclaration(const std::string& name,
+                           const TagDeclarationSymbol* tagDecl,
+                           const SyntaxTree* tree,
+                           const TagDeclarationSymbol* compatibleTagDecl);
+    void discardDeclarations(const SyntaxTree* tree);
+
+private:
+    struct LinkedTagDeclaration
+    {
+        const TagDeclarationSymbol* tagDecl_;
+        const SyntaxTree* tree_;
+        std::size_t group_;
+    };
+
+    std::unordered_map<std::string, std::vector<ExternalDeclaration>> externDecls_;
+    std::unordered_map<std::string, std::vector<LinkedTagDeclaration>> tagDecls_;
+    std::unordered_map<const TagDeclarationSymbol*, std::string> tagNames_;
+    std::size_t nextTagGroup_;
 };
 
 PSY_C_API std::ostream& operator<<(std::ostream& os, const ProgramSymbol* prog);
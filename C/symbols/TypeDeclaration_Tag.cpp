@@ -22,6 +22,7 @@
 #include "TypeDeclaration_Tag.h"
 
 #include "symbols/Symbol_ALL.h"
+#include "syntax/Lexeme_Identifier.h"
 #include "types/Type_Tag.h"
 
 #include <algorithm>
@@ -84,7 +85,11 @@ const MemberDeclarationSymbol* TagDeclarationSymbol::member(const Identifier* na
     auto it = std::find_if(membDecls_.begin(),
                            membDecls_.end(),
                            [name] (const MemberDeclarationSymbol* membDecl) {
-                                return membDecl->name() == name;
+                                // The tag may be declared in another SyntaxTree
+                                // (see Compilation's prelude).
+                                auto membName = membDecl->name();
+                                return membName == name
+                                        || (membName && name && *membName == *name);
                            });
     if (it != membDecls_.end())
         return *it;
@@ -55,6 +55,7 @@ public:
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     TypedefDeclarationSymbol(
             const Symbol* containingSym,
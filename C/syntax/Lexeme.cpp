@@ -21,6 +21,8 @@
 
 #include "Lexeme.h"
 
+#include "Lexeme_Constant.h"
+
 using namespace psy;
 using namespace C;
 
@@ -111,48 +113,64 @@ std::string Lexeme::valueText() const
 template <>
 int Lexeme::value<int>() const
 {
+    if (auto intLexeme = asIntegerConstant())
+        return static_cast<int>(intLexeme->integerValue());
     return std::stoi(valueText());
 }
 
 template <>
 long Lexeme::value<long>() const
 {
+    if (auto intLexeme = asIntegerConstant())
+        return static_cast<long>(intLexeme->integerValue());
     return std::stol(valueText());
 }
 
 template <>
 long long Lexeme::value<long long>() const
 {
+    if (auto intLexeme = asIntegerConstant())
+        return static_cast<long long>(intLexeme->integerValue());
     return std::stoll(valueText());
 }
 
 template <>
 unsigned long Lexeme::value<unsigned long>() const
 {
+    if (auto intLexeme = asIntegerConstant())
+        return static_cast<unsigned long>(intLexeme->integerValue());
     return std::stoul(valueText());
 }
 
 template <>
 unsigned long long Lexeme::value<unsigned long long>() const
 {
+    if (auto intLexeme = asIntegerConstant())
+        return static_cast<unsigned long long>(intLexeme->integerValue());
     return std::stoull(valueText());
 }
 
 template <>
 float Lexeme::value<float>() const
 {
+    if (auto floatLexeme = asFloatingConstant())
+        return static_cast<float>(floatLexeme->floatingValue());
     return std::stof(valueText());
 }
 
 template <>
 double Lexeme::value<double>() const
 {
+    if (auto floatLexeme = asFloatingConstant())
+        return static_cast<double>(floatLexeme->floatingValue());
     return std::stod(valueText());
 }
 
 template <>
 long double Lexeme::value<long double>() const
 {
+    if (auto floatLexeme = asFloatingConstant())
+        return static_cast<long double>(floatLexeme->floatingValue());
     return std::stold(valueText());
 }
 
@@ -113,6 +113,11 @@ public:
      *
      * \remark 6.2.5
      * \remark 6.4
+     *
+     * \note
+     * The value of an IntegerConstant or a FloatingConstant isn't parsed
+     * from its text on each call; see IntegerConstant::integerValue and
+     * FloatingConstant::floatingValue.
      */
     template <class ValueT> ValueT value() const;
 
@@ -135,6 +140,7 @@ protected:
         std::uint16_t U_      : 1;
         std::uint16_t llOrLL_ : 1;
         std::uint16_t fOrF_   : 1;
+        std::uint16_t ovfl_   : 1;
     };
     union
     {
@@ -21,15 +21,74 @@
 
 #include "Lexeme_Constant.h"
 
+#include <cstdlib>
+#include <limits>
+
 using namespace psy;
 using namespace C;
 
+namespace {
+
+int digitValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/*
+ * Decode the digits of an integer constant, in its base, up to its suffix;
+ * return whether the value overflows an unsigned long long.
+ */
+bool decodeInteger(const char* cur, const char* end, unsigned long long& value)
+{
+    unsigned base = 10;
+    if (end - cur > 1 && cur[0] == '0') {
+        switch (cur[1]) {
+            case 'x':
+            case 'X':
+                base = 16;
+                cur += 2;
+                break;
+
+            case 'b':
+            case 'B':
+                base = 2;
+                cur += 2;
+                break;
+
+            default:
+                base = 8;
+                ++cur;
+        }
+    }
+
+    constexpr auto kMax = std::numeric_limits<unsigned long long>::max();
+    value = 0;
+    for (; cur != end; ++cur) {
+        auto d = digitValue(*cur);
+        if (d < 0 || unsigned(d) >= base)
+            break;
+        if (value > (kMax - d) / base)
+            return true;
+        value = value * base + d;
+    }
+    return false;
+}
+
+} // anonymous
+
 
 IntegerConstant::IntegerConstant(const char* chars, unsigned int size)
     : Lexeme(chars,
              size,
              LexemeKind::IntegerConstant)
 {
+    F_.ovfl_ = decodeInteger(begin(), end(), value_);
 }
 
 IntegerConstant::RepresentationSuffix IntegerConstant::representationSuffix() const
@@ -58,6 +117,7 @@ FloatingConstant::FloatingConstant(const char* chars, unsigned int size)
     : Lexeme(chars,
              size,
              LexemeKind::FloatingConstant)
+    , value_(std::strtold(c_str(), nullptr))
 {}
 
 FloatingConstant::RepresentationSuffix FloatingConstant::representationSuffix() const
@@ -71,8 +71,28 @@ public:
      */
     bool isOctalOrHexadecimal() const;
 
+    /**
+     * The value of \c this IntegerConstant, decoded (in its base, without
+     * its suffix) once, when the lexeme is created.
+     *
+     * \remark 6.4.4.1-4
+     */
+    unsigned long long integerValue() const { return value_; }
+
+    /**
+     * Whether the value of \c this IntegerConstant can't be represented
+     * by an \c unsigned \c long \c long; in which case, the value is that
+     * of the digits up to the overflow.
+     *
+     * \remark 6.4.4.1-6
+     */
+    bool overflows() const { return F_.ovfl_; }
+
     // TODO: Make internal.
     IntegerConstant(const char* chars, unsigned int size);
+
+private:
+    unsigned long long value_;
 };
 
 /**
@@ -106,8 +126,19 @@ public:
      */
     RepresentationSuffix representationSuffix() const;
 
+    /**
+     * The value of \c this FloatingConstant, decoded (decimal or hexadecimal,
+     * without its suffix) once, when the lexeme is created.
+     *
+     * \remark 6.4.4.2
+     */
+    long double floatingValue() const { return value_; }
+
     // TODO: Make internal.
     FloatingConstant(const char* chars, unsigned int size);
+
+private:
+    long double value_;
 };
 
 /**
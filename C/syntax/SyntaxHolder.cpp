@@ -23,36 +23,6 @@
 using namespace psy;
 using namespace C;
 
-SyntaxHolder::SyntaxHolder(LexedTokens::IndexType tkIdx)
-    : syntax_(tkIdx)
-    , variant_(Variant::Token)
-{}
-
-SyntaxHolder::SyntaxHolder(const SyntaxNode* node)
-    : syntax_(node)
-    , variant_(Variant::Node)
-{}
-
-SyntaxHolder::SyntaxHolder(const SyntaxNodeList* nodeList)
-    : syntax_(nodeList)
-    , variant_(Variant::NodeList)
-{}
-
-LexedTokens::IndexType SyntaxHolder::tokenIndex() const
-{
-    return std::get<LexedTokens::IndexType>(syntax_);
-}
-
-const SyntaxNode* SyntaxHolder::node() const
-{
-    return std::get<const SyntaxNode*>(syntax_);
-}
-
-const SyntaxNodeList* SyntaxHolder::nodeList() const
-{
-    return std::get<const SyntaxNodeList*>(syntax_);
-}
-
 bool SyntaxHolder::isToken() const
 {
     return variant_ == Variant::Token;
@@ -52,13 +52,14 @@ public:
     bool isNode() const;
     bool isNodeList() const;
 
-    SyntaxHolder(LexedTokens::IndexType tkIdx);
-    SyntaxHolder(const SyntaxNode* node);
-    SyntaxHolder(const SyntaxNodeList* nodeList);
+    SyntaxHolder() : SyntaxHolder(LexedTokens::invalidIndex()) {}
+    SyntaxHolder(LexedTokens::IndexType tkIdx) : syntax_(tkIdx), variant_(Variant::Token) {}
+    SyntaxHolder(const SyntaxNode* node) : syntax_(node), variant_(Variant::Node) {}
+    SyntaxHolder(const SyntaxNodeList* nodeList) : syntax_(nodeList), variant_(Variant::NodeList) {}
 
-    LexedTokens::IndexType tokenIndex() const;
-    const SyntaxNode* node() const;
-    const SyntaxNodeList* nodeList() const;
+    LexedTokens::IndexType tokenIndex() const { return *std::get_if<LexedTokens::IndexType>(&syntax_); }
+    const SyntaxNode* node() const { return *std::get_if<const SyntaxNode*>(&syntax_); }
+    const SyntaxNodeList* nodeList() const { return *std::get_if<const SyntaxNodeList*>(&syntax_); }
 
 private:
     std::variant<LexedTokens::IndexType,
@@ -18,42 +18,40 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+
 #include "SyntaxNamePrinter.h"
 
 #include "SyntaxNode.h"
 
-#include <algorithm>
 #include <iostream>
-#include <unordered_map>
 
 using namespace psy;
 using namespace C;
 
 namespace {
 
-int CUR_LEVEL;
-
-std::string formatSnippet(std::string& snippet)
+/*
+ * Collect the (nonterminal) children of a node, without descending.
+ */
+class ChildrenCollector final : public SyntaxDumper
 {
-    std::replace_if(snippet.begin(), snippet.end(),
-                 [] (char c) { return c == '\n' || c == '\t'; },
-                 ' ');
-
-    while (true) {
-        auto pos = snippet.find("  ");
-        if (pos == std::string::npos)
-            break;
-        snippet = snippet.replace(pos, 2, " ");
+public:
+    ChildrenCollector(const SyntaxTree* tree, std::vector<const SyntaxNode*>& children)
+        : SyntaxDumper(tree)
+        , children_(children)
+    {}
+
+    void collect(const SyntaxNode* node) { visit(node); }
+
+private:
+    virtual void nonterminal(const SyntaxNode* node) override
+    {
+        if (node)
+            children_.push_back(node);
     }
 
-    static const auto MAX_LEN = 30;
-    if (snippet.length() > MAX_LEN) {
-        snippet = snippet.substr(0, MAX_LEN);
-        snippet += "...";
-    }
-
-    return snippet;
-}
+    std::vector<const SyntaxNode*>& children_;
+};
 
 } // anonymous
 
@@ -64,82 +62,111 @@ void SyntaxNamePrinter::print(const SyntaxNode* node, Style style)
 
 void SyntaxNamePrinter::print(const SyntaxNode* node, Style style, std::ostream& os)
 {
-    CUR_LEVEL = 0;
+    OutputSink sink(os);
+    print(node, style, sink);
+}
 
+void SyntaxNamePrinter::print(const SyntaxNode* node, Style style, OutputSink& sink)
+{
+    sink_ = &sink;
+    style_ = style;
+    source_ = &node->syntaxTree()->text().rawText();
+    children_.clear();
+    hasPendingSiblings_.clear();
+
+    *sink_ << '\n';
     nonterminal(node);
+}
 
-    auto source = node->syntaxTree()->text().rawText();
+void SyntaxNamePrinter::nonterminal(const SyntaxNode* node)
+{
+    if (!node)
+        return;
 
-    os << std::endl;
-    for (auto i = 0U; i < dump_.size(); ++i) {
-        auto node = std::get<0>(dump_[i]);
-        auto nodeLevel = std::get<1>(dump_[i]);
+    printLine(node);
 
-        if (style == Style::Plain) {
-            os << std::string(nodeLevel * 4, ' ');
-            os << to_string(node->kind()) << std::endl;
-            continue;
-        }
+    auto begin = children_.size();
+    ChildrenCollector collector(tree_, children_);
+    collector.collect(node);
+    auto end = children_.size();
 
-        auto levelCnt = 0;
-        while (nodeLevel > levelCnt) {
-            if (nodeLevel == levelCnt + 1) {
-                os << '|';
-                os << std::string(2, '-');
-            }
-            else {
-                int nextLevelBelow;
-                for (auto j = i + 1; j < dump_.size(); ++j) {
-                    nextLevelBelow = std::get<1>(dump_[j]);
-                    if (nextLevelBelow <= levelCnt + 1)
-                        break;
-                }
-                if (nextLevelBelow == levelCnt + 1)
-                    os << '|';
-                else
-                    os << ' ';
-                os << std::string(2, ' ');
-            }
-            ++levelCnt;
-        }
+    for (auto idx = begin; idx < end; ++idx) {
+        hasPendingSiblings_.push_back(idx + 1 < end);
+        nonterminal(children_[idx]);
+        hasPendingSiblings_.pop_back();
+    }
+    children_.resize(begin);
+}
+
+void SyntaxNamePrinter::printLine(const SyntaxNode* node)
+{
+    auto level = hasPendingSiblings_.size();
 
-        os << to_string(node->kind()) << " ";
+    if (style_ == Style::Plain) {
+        sink_->fill(' ', level * 4);
+        *sink_ << to_string(node->kind()) << '\n';
+        return;
+    }
 
-        if (node->kind() == SyntaxKind::TranslationUnit) {
-            os << std::endl;
-            continue;
+    for (std::size_t levelCnt = 0; levelCnt < level; ++levelCnt) {
+        if (level == levelCnt + 1) {
+            *sink_ << "|--";
+            break;
         }
+        *sink_ << (hasPendingSiblings_[levelCnt] ? '|' : ' ');
+        sink_->fill(' ', 2);
+    }
 
-        os << " <";
-        auto firstTk = node->firstToken();
-        auto lastTk = node->lastToken();
-        if (firstTk.isValid())
-            os << firstTk.location().lineSpan().span().start();
-        os << "..";
-        if (lastTk.isValid())
-            os << lastTk.location().lineSpan().span().end();
-        os << "> ";
-
-        if (firstTk.isValid() && lastTk.isValid()) {
-            auto firstTkStart = source.c_str() + firstTk.span().start();
-            auto lastTkEnd = source.c_str() + lastTk.span().end();
-            std::string snippet(firstTkStart, lastTkEnd - firstTkStart);
-            os << " `" << formatSnippet(snippet) << "`";
-        }
+    *sink_ << to_string(node->kind()) << ' ';
 
-        os << std::endl;
+    if (node->kind() == SyntaxKind::TranslationUnit) {
+        *sink_ << '\n';
+        return;
     }
-}
 
-void SyntaxNamePrinter::nonterminal(const SyntaxNode* node)
-{
-    if (!node)
-        return;
+    *sink_ << " <";
+    auto firstTk = node->firstToken();
+    auto lastTk = node->lastToken();
+    if (firstTk.isValid()) {
+        auto pos = firstTk.location().lineSpan().span().start();
+        *sink_ << pos.line() << ':' << pos.character();
+    }
+    *sink_ << "..";
+    if (lastTk.isValid()) {
+        auto pos = lastTk.location().lineSpan().span().end();
+        *sink_ << pos.line() << ':' << pos.character();
+    }
+    *sink_ << "> ";
 
-    dump_.push_back(std::make_tuple(node, CUR_LEVEL));
+    if (firstTk.isValid() && lastTk.isValid())
+        printSnippet(node);
 
-    ++CUR_LEVEL;
-    visit(node);
-    --CUR_LEVEL;
+    *sink_ << '\n';
 }
 
+void SyntaxNamePrinter::printSnippet(const SyntaxNode* node)
+{
+    // The text of the node, with whitespace collapsed, and abbreviated.
+    static const std::size_t MAX_LEN = 30;
+
+    auto span = node->span();
+    auto it = source_->c_str() + span.start();
+    auto end = source_->c_str() + span.end();
+
+    *sink_ << " `";
+    std::size_t len = 0;
+    char prev = '\0';
+    for (; it < end; ++it) {
+        char c = (*it == '\n' || *it == '\t') ? ' ' : *it;
+        if (c == ' ' && prev == ' ')
+            continue;
+        if (len == MAX_LEN) {
+            *sink_ << "...";
+            break;
+        }
+        *sink_ << c;
+        prev = c;
+        ++len;
+    }
+    *sink_ << '`';
+}
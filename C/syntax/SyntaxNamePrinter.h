@@ -25,8 +25,10 @@
 
 #include "SyntaxDumper.h"
 
+#include "../common/infra/OutputSink.h"
+
 #include <ostream>
-#include <tuple>
+#include <string>
 #include <vector>
 
 namespace psy {
@@ -45,11 +47,24 @@ public:
 
     void print(const SyntaxNode* node, Style style);
     void print(const SyntaxNode* node, Style style, std::ostream& os);
+    void print(const SyntaxNode* node, Style style, OutputSink& sink);
 
 private:
     virtual void nonterminal(const SyntaxNode* node) override;
 
-    std::vector<std::tuple<const SyntaxNode*, int>> dump_;
+    void printLine(const SyntaxNode* node);
+    void printSnippet(const SyntaxNode* node);
+
+    OutputSink* sink_ = nullptr;
+    Style style_ = Style::Plain;
+    const std::string* source_ = nullptr;
+
+    /*
+     * The children of the nodes being printed, in a stack-like layout,
+     * and whether the node (at each depth) has siblings yet to be printed.
+     */
+    std::vector<const SyntaxNode*> children_;
+    std::vector<bool> hasPendingSiblings_;
 };
 
 } // C
@@ -23,6 +23,8 @@
 #include "SyntaxNodes.h"
 #include "SyntaxVisitor.h"
 
+#include "infra/MemoryPool.h"
+
 #include "../common/infra/Assertions.h"
 
 #include <algorithm>
@@ -31,8 +33,15 @@
 using namespace psy;
 using namespace C;
 
-SyntaxNode::SyntaxNode(SyntaxTree* tree, SyntaxKind kind)
-    : tree_(tree)
+namespace {
+
+const LexedTokens::IndexType kUncachedTkIdx = ~LexedTokens::IndexType(0);
+
+} // anonymous
+
+SyntaxNode::SyntaxNode(SyntaxKind kind)
+    : firstTkIdx_(kUncachedTkIdx)
+    , lastTkIdx_(kUncachedTkIdx)
     , kind_(kind)
 {}
 
@@ -41,7 +50,12 @@ SyntaxNode::~SyntaxNode()
 
 const SyntaxTree* SyntaxNode::syntaxTree() const
 {
-    return tree_;
+    return tree();
+}
+
+SyntaxTree* SyntaxNode::tree() const
+{
+    return static_cast<SyntaxTree*>(MemoryPool::ownerOf(this));
 }
 
 SyntaxKind SyntaxNode::kind() const
@@ -51,55 +65,131 @@ SyntaxKind SyntaxNode::kind() const
 
 SyntaxToken SyntaxNode::firstToken() const
 {
-    return findValidToken(childNodesAndTokens());
+    return tokenAtIndex(firstTokenIndex());
 }
 
 SyntaxToken SyntaxNode::lastToken() const
 {
-    auto reversed = childNodesAndTokens();
-    std::reverse(reversed.begin(), reversed.end());
-    return findValidToken(reversed);
+    return tokenAtIndex(lastTokenIndex());
+}
+
+TextSpan SyntaxNode::span() const
+{
+    auto firstTkIdx = firstTokenIndex();
+    auto lastTkIdx = lastTokenIndex();
+    if (firstTkIdx == LexedTokens::invalidIndex()
+            || lastTkIdx == LexedTokens::invalidIndex()) {
+        return TextSpan(0, 0);
+    }
+    auto tree = this->tree();
+    return TextSpan(tree->tokenAt(firstTkIdx).span().start(),
+                    tree->tokenAt(lastTkIdx).span().end());
+}
+
+LexedTokens::IndexType SyntaxNode::firstTokenIndex() const
+{
+    if (firstTkIdx_ != kUncachedTkIdx)
+        return firstTkIdx_;
+
+    SyntaxHolder holders[MaxChildCount];
+    auto cnt = childNodesAndTokens(holders);
+    for (std::size_t i = 0; i < cnt; ++i) {
+        const auto& holder = holders[i];
+        auto tkIdx = LexedTokens::invalidIndex();
+        switch (holder.variant()) {
+            case SyntaxHolder::Variant::Token:
+                tkIdx = holder.tokenIndex();
+                break;
+
+            case SyntaxHolder::Variant::Node:
+                if (holder.node())
+                    tkIdx = holder.node()->firstTokenIndex();
+                break;
+
+            case SyntaxHolder::Variant::NodeList:
+                if (holder.nodeList())
+                    tkIdx = holder.nodeList()->firstTokenIndex();
+                break;
+        }
+        if (tkIdx != LexedTokens::invalidIndex())
+            return tkIdx;
+    }
+    return LexedTokens::invalidIndex();
 }
 
-SyntaxToken SyntaxNode::findValidToken(const std::vector<SyntaxHolder>& syntaxHolders) const
+LexedTokens::IndexType SyntaxNode::lastTokenIndex() const
 {
-    for (const auto& holder : syntaxHolders) {
+    if (lastTkIdx_ != kUncachedTkIdx)
+        return lastTkIdx_;
+
+    SyntaxHolder holders[MaxChildCount];
+    auto cnt = childNodesAndTokens(holders);
+    for (auto i = cnt; i > 0; --i) {
+        const auto& holder = holders[i - 1];
+        auto tkIdx = LexedTokens::invalidIndex();
         switch (holder.variant()) {
             case SyntaxHolder::Variant::Token:
-                if (holder.tokenIndex() != LexedTokens::invalidIndex())
-                    return tokenAtIndex(holder.tokenIndex());
+                tkIdx = holder.tokenIndex();
                 break;
 
             case SyntaxHolder::Variant::Node:
-                if (holder.node()) {
-                    auto tk = holder.node()->firstToken();
-                    if (tk != SyntaxToken::invalid())
-                        return tk;
-                }
+                if (holder.node())
+                    tkIdx = holder.node()->lastTokenIndex();
                 break;
 
             case SyntaxHolder::Variant::NodeList:
-                if (holder.nodeList()) {
-                    auto tk = holder.nodeList()->firstToken();
-                    if (tk != SyntaxToken::invalid())
-                        return tk;
-                }
+                if (holder.nodeList())
+                    tkIdx = holder.nodeList()->lastTokenIndex();
                 break;
         }
+        if (tkIdx != LexedTokens::invalidIndex())
+            return tkIdx;
     }
-    return 0;
+    return LexedTokens::invalidIndex();
+}
+
+/**
+ * Cache the first and last token indexes of \c this SyntaxNode and of every
+ * SyntaxNode beneath it; children are cached before their parent, so that
+ * each node only looks at its immediate children.
+ *
+ * \remark Disambiguation doesn't invalidate the cache: the alternatives of an
+ * ambiguous node (one of which replaces it) span the same tokens.
+ */
+void SyntaxNode::cacheTokenIndexes()
+{
+    class TokenIndexesCacher final : public SyntaxVisitor
+    {
+    public:
+        using SyntaxVisitor::SyntaxVisitor;
+
+        virtual void postVisit(const SyntaxNode* node) override
+        {
+            auto n = const_cast<SyntaxNode*>(node);
+            n->firstTkIdx_ = kUncachedTkIdx;
+            n->lastTkIdx_ = kUncachedTkIdx;
+            n->firstTkIdx_ = n->firstTokenIndex();
+            n->lastTkIdx_ = n->lastTokenIndex();
+        }
+    };
+
+    TokenIndexesCacher cacher(tree());
+    acceptVisitor(&cacher);
 }
 
 SyntaxToken SyntaxNode::tokenAtIndex(LexedTokens::IndexType tkIdx) const
 {
     if (tkIdx == 0)
         return SyntaxToken::invalid();
-    return tree_->tokenAt(tkIdx);
+    return tree()->tokenAt(tkIdx);
 }
 
 SyntaxVisitor::Action SyntaxNode::acceptVisitorInChildNodes(SyntaxVisitor* visitor) const
 {
-    for (auto holder : childNodesAndTokens()) {
+    SyntaxHolder holders[MaxChildCount];
+    auto cnt = childNodesAndTokens(holders);
+    for (std::size_t i = 0; i < cnt; ++i) {
+        const auto& holder = holders[i];
         SyntaxVisitor::Action action;
         switch (holder.variant()) {
             case SyntaxHolder::Variant::Node: {
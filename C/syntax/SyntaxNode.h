@@ -34,6 +34,8 @@
 #include "infra/Managed.h"
 #include "parser/LexedTokens.h"
 
+#include "../common/infra/AccessSpecifiers.h"
+
 #include <iostream>
 #include <memory>
 #include <variant>
@@ -70,6 +72,12 @@ public:
      */
     SyntaxToken lastToken() const;
 
+    /**
+     * The TextSpan of \c this SyntaxNode: from the start of its first token
+     * to the end of its last token.
+     */
+    TextSpan span() const;
+
     //!@{
     /**
      * Accept \c this SyntaxNode for traversal by the given \p visitor.
@@ -371,18 +379,47 @@ public:
     virtual AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement() { return nullptr; }
     virtual const AmbiguousExpressionOrDeclarationStatementSyntax* asAmbiguousExpressionOrDeclarationStatement() const { return nullptr; }
 
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(SyntaxTree);
+    PSY_GRANT_INTERNAL_ACCESS(SyntaxNodeList);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
+    template <class, class> friend class CoreSyntaxNodeList;
+
+    LexedTokens::IndexType firstTokenIndex() const;
+    LexedTokens::IndexType lastTokenIndex() const;
+    void cacheTokenIndexes();
+
 protected:
-    SyntaxNode(SyntaxTree* tree, SyntaxKind kind = SyntaxKind::Error);
+    SyntaxNode(SyntaxKind kind = SyntaxKind::Error);
     SyntaxNode(const SyntaxNode& other) = delete;
     SyntaxNode& operator=(const SyntaxNode& other) = delete;
 
+    SyntaxTree* tree() const;
     SyntaxToken tokenAtIndex(LexedTokens::IndexType tkIdx) const;
-    SyntaxToken findValidToken(const std::vector<SyntaxHolder>& syntaxHolders) const;
 
     virtual SyntaxVisitor::Action dispatchVisit(SyntaxVisitor* visitor) const = 0;
-    virtual std::vector<SyntaxHolder> childNodesAndTokens() const { return {}; }
 
-    SyntaxTree* tree_;
+    /*
+     * The child nodes and tokens of a node are gathered into a buffer (on
+     * the stack) of \c MaxChildCount holders; every node class checks its
+     * own \c ChildCount against it.
+     */
+    static constexpr std::size_t ChildCount = 0;
+    static constexpr std::size_t MaxChildCount = 16;
+    virtual std::size_t childNodesAndTokens(SyntaxHolder* holders) const { return 0; }
+
+private:
+    /*
+     * Watch for data layout (size) before changing members or their order:
+     * there's no SyntaxTree pointer, the tree is that of the MemoryPool in
+     * which the node is allocated (see \c tree()).
+     */
+
+    // Cached once the SyntaxTree is built (see cacheTokenIndexes).
+    LexedTokens::IndexType firstTkIdx_;
+    LexedTokens::IndexType lastTkIdx_;
+
+protected:
     SyntaxKind kind_;
 };
 
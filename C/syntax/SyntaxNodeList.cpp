@@ -25,6 +25,8 @@
 #include "SyntaxNodes.h"
 #include "syntax/SyntaxTree.h"
 
+#include "infra/MemoryPool.h"
+
 using namespace psy;
 using namespace C;
 
@@ -37,7 +39,8 @@ template <class SyntaxNodeT>
 SyntaxToken
 SyntaxNodeSeparatedList<SyntaxNodeT>::delimiterToken() const
 {
-    return SyntaxNodeList::token(delimTkIdx_, Base::tree_);
+    auto tree = static_cast<SyntaxTree*>(MemoryPool::ownerOf(this));
+    return SyntaxNodeList::token(delimTkIdx_, tree);
 }
 
 namespace psy {
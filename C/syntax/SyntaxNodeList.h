@@ -30,6 +30,8 @@
 #include "infra/List.h"
 #include "parser/LexedTokens.h"
 
+#include "../common/infra/AccessSpecifiers.h"
+
 #include <iostream>
 
 namespace psy {
@@ -57,6 +59,12 @@ public:
     static SyntaxToken token(LexedTokens::IndexType tkIdx, SyntaxTree* tree);
 
     virtual SyntaxVisitor::Action acceptVisitor(SyntaxVisitor* visitor) = 0;
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(SyntaxNode);
+
+    virtual LexedTokens::IndexType firstTokenIndex() const = 0;
+    virtual LexedTokens::IndexType lastTokenIndex() const = 0;
 };
 
 
@@ -72,14 +80,12 @@ class PSY_C_API CoreSyntaxNodeList
         , public SyntaxNodeList
 {
 public:
-    CoreSyntaxNodeList(SyntaxTree* tree)
+    CoreSyntaxNodeList()
         : List<SyntaxNodeT, DerivedListT>()
-        , tree_(tree)
     {}
 
-    CoreSyntaxNodeList(SyntaxTree* tree, const SyntaxNodeT& node)
+    CoreSyntaxNodeList(const SyntaxNodeT& node)
         : List<SyntaxNodeT, DerivedListT>(node)
-        , tree_(tree)
     {}
 
     CoreSyntaxNodeList(const CoreSyntaxNodeList&) = delete;
@@ -100,6 +106,21 @@ public:
         return SyntaxToken::invalid();
     }
 
+    virtual LexedTokens::IndexType firstTokenIndex() const override
+    {
+        if (this->value)
+            return this->value->firstTokenIndex();
+        return LexedTokens::invalidIndex();
+    }
+
+    virtual LexedTokens::IndexType lastTokenIndex() const override
+    {
+        SyntaxNodeT node = this->lastValue();
+        if (node)
+            return node->lastTokenIndex();
+        return LexedTokens::invalidIndex();
+    }
+
     virtual SyntaxVisitor::Action acceptVisitor(SyntaxVisitor* visitor) override
     {
         for (auto it = this; it; it = it->next) {
@@ -112,8 +133,6 @@ public:
         }
         return SyntaxVisitor::Action::Visit;
     }
-
-    SyntaxTree* tree_;
 };
 
 
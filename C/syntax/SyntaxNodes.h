@@ -68,11 +68,11 @@
     using SyntaxNode::SyntaxNode;
 #define AST_G_NODE_1K(NODE) \
     AST_G_NODE__COMMON__(NODE) \
-    NODE##Syntax(SyntaxTree* tree) : SyntaxNode(tree, SyntaxKind::NODE) {} \
+    NODE##Syntax() : SyntaxNode(SyntaxKind::NODE) {} \
     DISPATCH_VISIT(NODE)
 #define AST_G_NODE_NK(NODE) \
     AST_G_NODE__COMMON__(NODE) \
-    NODE##Syntax(SyntaxTree* tree, SyntaxKind kind) : SyntaxNode(tree, kind) {} \
+    NODE##Syntax(SyntaxKind kind) : SyntaxNode(kind) {} \
     DISPATCH_VISIT(NODE)
 
 #define AST_NODE(NODE, BASE_NODE) \
@@ -80,44 +80,44 @@
     using BASE_NODE##Syntax::BASE_NODE##Syntax;
 #define AST_NODE_1K(NODE, BASE_NODE) \
     AST_NODE__COMMON__(NODE, BASE_NODE) \
-    NODE##Syntax(SyntaxTree* tree) : BASE_NODE##Syntax(tree, SyntaxKind::NODE) {} \
+    NODE##Syntax() : BASE_NODE##Syntax(SyntaxKind::NODE) {} \
     DISPATCH_VISIT(NODE)
 #define AST_NODE_NK(NODE, BASE_NODE) \
     AST_NODE__COMMON__(NODE, BASE_NODE) \
-    NODE##Syntax(SyntaxTree* tree, SyntaxKind kind) : BASE_NODE##Syntax(tree, kind) {} \
+    NODE##Syntax(SyntaxKind kind) : BASE_NODE##Syntax(kind) {} \
     DISPATCH_VISIT(NODE)
 
 /*
  * The children, either nodes or tokens, of an AST node.
  */
 #define AST_CHILD_LST1(NAME1) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_1(NAME1))
+    CHILD_NODES_AND_TOKENS(1, CHILD_NAME_1(NAME1))
 #define AST_CHILD_LST2(NAME1, NAME2) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_2(NAME1, NAME2))
+    CHILD_NODES_AND_TOKENS(2, CHILD_NAME_2(NAME1, NAME2))
 #define AST_CHILD_LST3(NAME1, NAME2, NAME3) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_3(NAME1, NAME2, NAME3))
+    CHILD_NODES_AND_TOKENS(3, CHILD_NAME_3(NAME1, NAME2, NAME3))
 #define AST_CHILD_LST4(NAME1, NAME2, NAME3, NAME4) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_4(NAME1, NAME2, NAME3, NAME4))
+    CHILD_NODES_AND_TOKENS(4, CHILD_NAME_4(NAME1, NAME2, NAME3, NAME4))
 #define AST_CHILD_LST5(NAME1, NAME2, NAME3, NAME4, NAME5) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_5(NAME1, NAME2, NAME3, NAME4, NAME5))
+    CHILD_NODES_AND_TOKENS(5, CHILD_NAME_5(NAME1, NAME2, NAME3, NAME4, NAME5))
 #define AST_CHILD_LST6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6))
+    CHILD_NODES_AND_TOKENS(6, CHILD_NAME_6(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6))
 #define AST_CHILD_LST7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7))
+    CHILD_NODES_AND_TOKENS(7, CHILD_NAME_7(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7))
 #define AST_CHILD_LST8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8))
+    CHILD_NODES_AND_TOKENS(8, CHILD_NAME_8(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8))
 #define AST_CHILD_LST9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9))
+    CHILD_NODES_AND_TOKENS(9, CHILD_NAME_9(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9))
 #define AST_CHILD_LST10(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_10(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10))
+    CHILD_NODES_AND_TOKENS(10, CHILD_NAME_10(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10))
 #define AST_CHILD_LST11(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_11(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11))
+    CHILD_NODES_AND_TOKENS(11, CHILD_NAME_11(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11))
 #define AST_CHILD_LST12(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_12(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12))
+    CHILD_NODES_AND_TOKENS(12, CHILD_NAME_12(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12))
 #define AST_CHILD_LST13(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_13(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13))
+    CHILD_NODES_AND_TOKENS(13, CHILD_NAME_13(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13))
 #define AST_CHILD_LST14(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13, NAME14) \
-    CHILD_NODES_AND_TOKENS(CHILD_NAME_14(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13, NAME14))
+    CHILD_NODES_AND_TOKENS(14, CHILD_NAME_14(NAME1, NAME2, NAME3, NAME4, NAME5, NAME6, NAME7, NAME8, NAME9, NAME10, NAME11, NAME12, NAME13, NAME14))
 
 #define CHILD_NAME_1(NAME1) \
     SyntaxHolder(NAME1)
@@ -173,24 +173,23 @@
 
 /*
  * The default implementation of the function that gather the child
- * nodes and tokens of the `this' node.
+ * nodes and tokens of the `this' node: those of the base node first,
+ * then its own, into a buffer provided by the caller (no allocation).
  */
-#define CHILD_NODES_AND_TOKENS(CHILDREN_SYNTAX) \
+#define CHILD_NODES_AND_TOKENS(COUNT, CHILDREN_SYNTAX) \
     public: \
-        virtual std::vector<SyntaxHolder> childNodesAndTokens() const override \
-            { auto self = { CHILDREN_SYNTAX }; \
-              return merge(BaseSyntax::childNodesAndTokens(), self); }
+        static constexpr std::size_t ChildCount = BaseSyntax::ChildCount + COUNT; \
+        static_assert(ChildCount <= SyntaxNode::MaxChildCount, "increase MaxChildCount"); \
+    protected: \
+        virtual std::size_t childNodesAndTokens(SyntaxHolder* holders) const override \
+            { auto cnt = BaseSyntax::childNodesAndTokens(holders); \
+              for (const auto& holder : { CHILDREN_SYNTAX }) \
+                  holders[cnt++] = holder; \
+              return cnt; }
 
 using namespace psy;
 using namespace C;
 
-inline std::vector<SyntaxHolder> merge(std::vector<SyntaxHolder>&& a,
-                                       std::vector<SyntaxHolder>&& b)
-{
-    a.insert(a.end(), b.begin(), b.end());
-    return std::move(a);
-}
-
 namespace psy {
 namespace C {
 
@@ -213,7 +213,7 @@ PSY_INTERNAL:
     std::uint32_t byteOffset_;
     std::uint32_t charOffset_;  // UTF-16
 
-    std::size_t matchingBracket_;
+    std::uint32_t matchingBracket_;
 
     struct BitFields
     {
@@ -31,6 +31,7 @@
 #include "syntax/SyntaxNodes.h"
 
 #include "../common/infra/Assertions.h"
+#include "../common/infra/Instrumentation.h"
 #include "../common/text/TextElementTable.h"
 
 #include <algorithm>
@@ -50,12 +51,13 @@ using namespace C;
 
 struct SyntaxTree::SyntaxTreeImpl
 {
-    SyntaxTreeImpl(SourceText text,
+    SyntaxTreeImpl(SyntaxTree* tree,
+                   SourceText text,
                    TextPreprocessingState textPPState,
                    TextCompleteness textCompleteness,
                    ParseOptions parseOptions,
                    const std::string& filePath)
-        : pool_(new MemoryPool())
+        : pool_(new MemoryPool(tree))
         , text_(std::move(text))
         , textCompleteness_(textCompleteness)
         , textPPState_(textPPState)
@@ -94,6 +96,7 @@ struct SyntaxTree::SyntaxTreeImpl
     std::vector<LineDirective> lineDirectives_;
     std::vector<unsigned int> startOfLineOffsets_;
     SyntaxTree::ExpansionsTable expansions_;
+    std::vector<SyntaxTrivia> trivia_;
 
     bool parseExitedEarly_;
 
@@ -107,7 +110,8 @@ SyntaxTree::SyntaxTree(SourceText text,
                        TextCompleteness textCompleteness,
                        ParseOptions parseOptions,
                        const std::string& filePath)
-    : P(new SyntaxTreeImpl(text,
+    : P(new SyntaxTreeImpl(this,
+                           text,
                            textPPState,
                            textCompleteness,
                            parseOptions,
@@ -172,6 +176,11 @@ std::vector<Diagnostic> SyntaxTree::diagnostics() const
     return P->diagnostics_;
 }
 
+std::size_t SyntaxTree::diagnosticCount() const
+{
+    return P->diagnostics_.size();
+}
+
 TextCompleteness SyntaxTree::completeness() const
 {
     return P->textCompleteness_;
@@ -191,8 +200,12 @@ bool SyntaxTree::parseExitedEarly() const
 
 void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
 {
-    Lexer lexer(this);
-    lexer.lex();
+    {
+        PSY_INSTR_TIME(P->filePath_, "lex");
+        Lexer lexer(this);
+        lexer.lex();
+    }
+    PSY_INSTR_COUNT(P->filePath_, "lex", "tokens", P->tokens_.count());
 
 #ifdef DBG_LEXED_TOKENS
     std::cout << "\n\n" << P->text_.rawText() << std::endl;
@@ -227,32 +240,63 @@ void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
 #endif
 
     Parser parser(this);
-    switch (syntaxCategory) {
-        case SyntaxCategory::Declarations: {
-            DeclarationSyntax* decl = nullptr;
-            parser.parseExternalDeclaration(decl);
-            P->rootNode_ = decl;
-            break;
-        }
+    {
+        PSY_INSTR_TIME(P->filePath_, "parse");
+        switch (syntaxCategory) {
+            case SyntaxCategory::Declarations: {
+                DeclarationSyntax* decl = nullptr;
+                parser.parseExternalDeclaration(decl);
+                P->rootNode_ = decl;
+                break;
+            }
 
-        case SyntaxCategory::Expressions: {
-            ExpressionSyntax* expr = nullptr;
-            parser.parseExpression(expr);
-            P->rootNode_ = expr;
-            break;
-        }
+            case SyntaxCategory::Expressions: {
+                ExpressionSyntax* expr = nullptr;
+                parser.parseExpression(expr);
+                P->rootNode_ = expr;
+                break;
+            }
 
-        case SyntaxCategory::Statements: {
-            StatementSyntax* stmt = nullptr;
-            parser.parseStatement(stmt, Parser::StatementContext::None);
-            P->rootNode_ = stmt;
-            break;
-         }
+            case SyntaxCategory::Statements: {
+                StatementSyntax* stmt = nullptr;
+                parser.parseStatement(stmt, Parser::StatementContext::None);
+                P->rootNode_ = stmt;
+                break;
+             }
 
-        default:
-            P->rootNode_ = parser.parse();
+            default:
+                P->rootNode_ = parser.parse();
+        }
+    }
+    if (P->rootNode_) {
+        PSY_INSTR_TIME(P->filePath_, "index");
+        P->rootNode_->cacheTokenIndexes();
     }
     P->parseExitedEarly_ = parser.peek().kind() != SyntaxKind::EndOfFile;
+    PSY_INSTR_COUNT(P->filePath_, "parse", "nodes", parser.nodeCount());
+    PSY_INSTR_COUNT(P->filePath_, "parse", "backtracks", parser.backtrackCount());
+    PSY_INSTR_COUNT(P->filePath_, "parse", "pool_bytes", P->pool_->usedBytes());
+    PSY_INSTR_COUNT(P->filePath_, "parse", "diagnostics", P->diagnostics_.size());
+
+#ifdef PSY_INSTRUMENTATION
+    /*
+     * The count, and the bytes, of the nodes of each SyntaxKind, as counters
+     * (named after the kind) of phases "node_counts" and "node_bytes".
+     */
+    if (Instrumentation::isEnabled()) {
+        auto record = [this] (const std::string& name, const Parser::NodeTally& tally) {
+            PSY_INSTR_COUNT(P->filePath_, "node_counts", name.c_str(), tally.count_);
+            PSY_INSTR_COUNT(P->filePath_, "node_bytes", name.c_str(), tally.bytes_);
+        };
+        const auto& tallies = parser.nodeTallies();
+        for (auto k = 0U; k < tallies.size(); ++k) {
+            if (tallies[k].count_)
+                record(to_string(static_cast<SyntaxKind>(k)), tallies[k]);
+        }
+        if (parser.listTally().count_)
+            record("SyntaxNodeList", parser.listTally());
+    }
+#endif
 
     if (!P->diagnostics_.empty() || !parser.detectedAnyAmbiguity())
         return;
@@ -264,6 +308,8 @@ void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
         return;
     }
 
+    PSY_INSTR_TIME(P->filePath_, "reparse");
+    PSY_INSTR_DO(auto diagCnt = P->diagnostics_.size());
     Reparser reparser;
     switch (P->parseOptions_.ambiguityMode()) {
         case ParseOptions::AmbiguityMode::DisambiguateAlgorithmicallyAndHeuristically:
@@ -295,6 +341,7 @@ void SyntaxTree::buildFor(SyntaxCategory syntaxCategory)
                 newDiagnostic(std::get<0>(diag), std::get<1>(diag));
         }
     }
+    PSY_INSTR_COUNT(P->filePath_, "reparse", "diagnostics", P->diagnostics_.size() - diagCnt);
 }
 
 const ParseOptions& SyntaxTree::parseOptions() const
@@ -348,9 +395,10 @@ void SyntaxTree::relayLineStart(unsigned int offset)
     P->startOfLineOffsets_.push_back(offset);
 }
 
-void SyntaxTree::relayExpansion(unsigned int offset, std::pair<unsigned int, unsigned int> p)
+void SyntaxTree::relayExpansion(LexedTokens::IndexType tkIdx, LineColum lineCol)
 {
-    P->expansions_.insert(std::make_pair(offset, p));
+    PSY_ASSERT_1(P->expansions_.empty() || P->expansions_.back().tkIdx_ < tkIdx);
+    P->expansions_.push_back({ tkIdx, lineCol });
 }
 
 void SyntaxTree::relayLineDirective(unsigned int offset,
@@ -360,15 +408,98 @@ void SyntaxTree::relayLineDirective(unsigned int offset,
     P->lineDirectives_.emplace_back(lineno, filePath, offset);
 }
 
+void SyntaxTree::relayTrivia(SyntaxKind syntaxK,
+                             unsigned int byteStart,
+                             unsigned int byteEnd,
+                             unsigned int charStart,
+                             unsigned int charEnd)
+{
+    P->trivia_.push_back(SyntaxTrivia(syntaxK,
+                                      byteStart,
+                                      byteEnd - byteStart,
+                                      charStart,
+                                      charEnd - charStart,
+                                      P->tokens_.count()));
+}
+
+const std::vector<SyntaxTrivia>& SyntaxTree::trivia() const
+{
+    return P->trivia_;
+}
+
+std::string SyntaxTree::triviaText(const SyntaxTrivia& trivia) const
+{
+    return P->text_.rawText().substr(trivia.byteStart(),
+                                     trivia.byteEnd() - trivia.byteStart());
+}
+
+std::vector<SyntaxTrivia> SyntaxTree::leadingTrivia(const SyntaxToken& tk) const
+{
+    return searchForTrivia(searchForTokenIndex(tk.charStart()), true);
+}
+
+std::vector<SyntaxTrivia> SyntaxTree::trailingTrivia(const SyntaxToken& tk) const
+{
+    return searchForTrivia(searchForTokenIndex(tk.charStart()), false);
+}
+
+std::vector<SyntaxTrivia> SyntaxTree::leadingTrivia(const SyntaxNode* node) const
+{
+    return leadingTrivia(node->firstToken());
+}
+
+std::vector<SyntaxTrivia> SyntaxTree::trailingTrivia(const SyntaxNode* node) const
+{
+    return trailingTrivia(node->lastToken());
+}
+
+/**
+ * Search for the SyntaxTrivia that leads or trails the token at \p tkIdx.
+ *
+ * The trivia between two tokens is split at the first line break: what
+ * precedes it trails the former token, and what follows it, the latter.
+ */
+std::vector<SyntaxTrivia> SyntaxTree::searchForTrivia(LexedTokens::IndexType tkIdx,
+                                                      bool leading) const
+{
+    if (P->trivia_.empty() || tkIdx == LexedTokens::invalidIndex())
+        return {};
+
+    // Trivia is keyed by the index of the token that follows it.
+    auto followIdx = leading ? tkIdx : tkIdx + 1;
+    auto byFollowIdx = [] (const SyntaxTrivia& trivia, LexedTokens::IndexType value) {
+        return trivia.tkIdx_ < value;
+    };
+    auto begin = std::lower_bound(P->trivia_.begin(), P->trivia_.end(), followIdx, byFollowIdx);
+    auto end = std::lower_bound(begin, P->trivia_.end(), followIdx + 1, byFollowIdx);
+
+    auto mid = begin;
+    if (followIdx > 1) {
+        const auto& text = P->text_.rawText();
+        auto prevEnd = P->tokens_.tokenAt(followIdx - 1).byteEnd();
+        for (; mid != end; ++mid) {
+            if (std::find(text.begin() + prevEnd, text.begin() + mid->byteStart(), '\n')
+                    != text.begin() + mid->byteStart()) {
+                break;
+            }
+            prevEnd = mid->byteEnd();
+        }
+    }
+
+    if (leading)
+        return std::vector<SyntaxTrivia>(mid, end);
+    return std::vector<SyntaxTrivia>(begin, mid);
+}
+
 LinePosition SyntaxTree::computePosition(unsigned int offset) const
 {
     unsigned int lineno = 0;
     unsigned int column = 0;
 
-    auto it = P->expansions_.find(offset);
-    if (it != P->expansions_.end()) {
-        lineno = it->second.first;
-        column = it->second.second + 1;
+    auto expansion = searchForExpansion(offset);
+    if (expansion) {
+        lineno = expansion->lineCol_.first;
+        column = expansion->lineCol_.second + 1;
     }
     else {
         lineno = searchForLineno(offset);
@@ -383,6 +514,44 @@ LinePosition SyntaxTree::computePosition(unsigned int offset) const
     return LinePosition(lineno, column);
 }
 
+const SyntaxTree::Expansion* SyntaxTree::searchForExpansion(unsigned int offset) const
+{
+    if (P->expansions_.empty())
+        return nullptr;
+
+    auto tkIdx = searchForTokenIndex(offset);
+    if (tkIdx == LexedTokens::invalidIndex())
+        return nullptr;
+
+    auto it = std::lower_bound(P->expansions_.begin(),
+                               P->expansions_.end(),
+                               tkIdx,
+                               [] (const Expansion& expansion, LexedTokens::IndexType value) {
+                                   return expansion.tkIdx_ < value;
+                               });
+    if (it == P->expansions_.end() || it->tkIdx_ != tkIdx)
+        return nullptr;
+    return &*it;
+}
+
+LexedTokens::IndexType SyntaxTree::searchForTokenIndex(unsigned int offset) const
+{
+    // Tokens are lexed in offset order; skip the marker (invalid) token.
+    const auto& tks = P->tokens_.tks_;
+    if (tks.empty())
+        return LexedTokens::invalidIndex();
+
+    auto tkIt = std::lower_bound(tks.begin() + 1,
+                                 tks.end(),
+                                 offset,
+                                 [] (const SyntaxToken& tk, unsigned int value) {
+                                     return tk.charStart() < value;
+                                 });
+    if (tkIt == tks.end() || tkIt->charStart() != offset)
+        return LexedTokens::invalidIndex();
+    return tkIt - tks.begin();
+}
+
 unsigned int SyntaxTree::searchForLineno(unsigned int offset) const
 {
     auto it = std::lower_bound(P->startOfLineOffsets_.begin(),
@@ -31,6 +31,7 @@
 #include "parser/TextCompleteness.h"
 #include "parser/TextPreprocessingState.h"
 #include "syntax/SyntaxToken.h"
+#include "syntax/SyntaxTrivia.h"
 
 #include "../common/diagnostics/Diagnostic.h"
 #include "../common/infra/AccessSpecifiers.h"
@@ -115,6 +116,40 @@ public:
 
     TextCompleteness completeness() const;
 
+    /**
+     * The comments of \c this SyntaxTree, in text order.
+     *
+     * \remark Comments are kept as per the ParseOptions::CommentMode.
+     */
+    const std::vector<SyntaxTrivia>& trivia() const;
+
+    /**
+     * The text of the SyntaxTrivia \p trivia.
+     */
+    std::string triviaText(const SyntaxTrivia& trivia) const;
+
+    /**
+     * The SyntaxTrivia that leads the SyntaxToken \p tk: the comments before
+     * it, except those in the same line of the previous token.
+     */
+    std::vector<SyntaxTrivia> leadingTrivia(const SyntaxToken& tk) const;
+
+    /**
+     * The SyntaxTrivia that trails the SyntaxToken \p tk: the comments after
+     * it, up to the end of its line.
+     */
+    std::vector<SyntaxTrivia> trailingTrivia(const SyntaxToken& tk) const;
+
+    /**
+     * The SyntaxTrivia that leads the first SyntaxToken of \p node.
+     */
+    std::vector<SyntaxTrivia> leadingTrivia(const SyntaxNode* node) const;
+
+    /**
+     * The SyntaxTrivia that trails the last SyntaxToken of \p node.
+     */
+    std::vector<SyntaxTrivia> trailingTrivia(const SyntaxNode* node) const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(SyntaxNode);
     PSY_GRANT_INTERNAL_ACCESS(SyntaxNodeList);
@@ -123,16 +158,31 @@ PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(LinkageResolver);
+    PSY_GRANT_INTERNAL_ACCESS(UnusedDeclarationChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModel);
     PSY_GRANT_INTERNAL_ACCESS(Symbol);
     PSY_GRANT_INTERNAL_ACCESS(Compilation);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
     PSY_GRANT_INTERNAL_ACCESS(InternalsTestSuite);
+    PSY_GRANT_INTERNAL_ACCESS(Fuzzer);
     PSY_GRANT_INTERNAL_ACCESS(SyntaxWriterDOTFormat); // TODO: Remove this grant.
 
     MemoryPool* unitPool() const;
 
     using TokenSequenceType = std::vector<SyntaxToken>;
     using LineColum = std::pair<unsigned int, unsigned int>;
-    using ExpansionsTable = std::unordered_map<unsigned int, LineColum>;
+
+    /**
+     * The real line and column of an expanded (but not generated) token.
+     * Entries are relayed in lexing order, so the table is sorted by token index.
+     */
+    struct Expansion
+    {
+        LexedTokens::IndexType tkIdx_;
+        LineColum lineCol_;
+    };
+    using ExpansionsTable = std::vector<Expansion>;
 
     /* Lexed-tokens access and manipulation */
     void addToken(SyntaxToken tk);
@@ -154,8 +204,13 @@ PSY_INTERNAL:
     const StringLiteral* findOrInsertStringLiteral(const char* s, unsigned size);
 
     void relayLineStart(unsigned int offset);
-    void relayExpansion(unsigned int offset, std::pair<unsigned, unsigned> p);
+    void relayExpansion(LexedTokens::IndexType tkIdx, LineColum lineCol);
     void relayLineDirective(unsigned int offset, unsigned int lineno, const std::string& filePath);
+    void relayTrivia(SyntaxKind syntaxK,
+                     unsigned int byteStart,
+                     unsigned int byteEnd,
+                     unsigned int charStart,
+                     unsigned int charEnd);
 
     const ParseOptions& parseOptions() const;
 
@@ -164,6 +219,7 @@ PSY_INTERNAL:
 
     void newDiagnostic(DiagnosticDescriptor descriptor, LexedTokens::IndexType tkIdx) const;
     void newDiagnostic(DiagnosticDescriptor descriptor, SyntaxToken tk) const;
+    std::size_t diagnosticCount() const;
 
     void attachCompilation(const Compilation*) const;
     void detachCompilation(const Compilation*) const;
@@ -185,13 +241,16 @@ private:
     void buildFor(SyntaxCategory syntaxCategory);
 
     LinePosition computePosition(unsigned int offset) const;
+    const Expansion* searchForExpansion(unsigned int offset) const;
+    LexedTokens::IndexType searchForTokenIndex(unsigned int offset) const;
+
+    std::vector<SyntaxTrivia> searchForTrivia(LexedTokens::IndexType tkIdx, bool leading) const;
     unsigned int searchForLineno(unsigned int offset) const;
     unsigned int searchForColumn(unsigned int offset, unsigned int lineno) const;
     LineDirective searchForLineDirective(unsigned int offset) const;
 
     // TODO: Move to implementaiton.
     LanguageDialect dialect_;
-    std::vector<SyntaxToken> comments_;
 };
 
 bool PSY_C_API isDiagnosticDescriptorIdOfSyntaxAmbiguity(const std::string& id);
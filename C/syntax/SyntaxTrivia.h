@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_SYNTAX_TRIVIA_H__
+#define PSYCHE_C_SYNTAX_TRIVIA_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "SyntaxKind.h"
+
+#include "../common/infra/AccessSpecifiers.h"
+#include "../common/text/TextSpan.h"
+
+#include <cstdint>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The SyntaxTrivia class.
+ *
+ * A comment, kept out of band from the SyntaxToken sequence of a SyntaxTree:
+ * only the SyntaxKind and the range of the comment are recorded; its text
+ * is neither copied nor interned (see SyntaxTree::triviaText).
+ *
+ * \note Resembles:
+ * \c Microsoft.CodeAnalysis.SyntaxTrivia from Roslyn.
+ */
+class PSY_C_API SyntaxTrivia
+{
+public:
+    /**
+     * The SyntaxKind of \c this SyntaxTrivia.
+     */
+    SyntaxKind kind() const { return syntaxK_; }
+
+    /**
+     * Whether \c this SyntaxTrivia is a documentation comment.
+     */
+    bool isDocumentation() const;
+
+    /**
+     * The TextSpan (in UTF-16 code units) of \c this SyntaxTrivia.
+     */
+    TextSpan span() const { return TextSpan(charOffset_, charOffset_ + charSize_); }
+
+PSY_INTERNAL:
+    PSY_GRANT_INTERNAL_ACCESS(SyntaxTree);
+
+    SyntaxTrivia(SyntaxKind syntaxK,
+                 std::uint32_t byteOffset,
+                 std::uint32_t byteSize,
+                 std::uint32_t charOffset,
+                 std::uint32_t charSize,
+                 std::uint32_t tkIdx);
+
+    unsigned int byteStart() const { return byteOffset_; }
+    unsigned int byteEnd() const { return byteOffset_ + byteSize_; }
+
+private:
+    SyntaxKind syntaxK_;
+    std::uint32_t byteOffset_;
+    std::uint32_t byteSize_;
+    std::uint32_t charOffset_;  // UTF-16
+    std::uint32_t charSize_;
+
+    // The index of the SyntaxToken that follows.
+    std::uint32_t tkIdx_;
+};
+
+} // C
+} // psy
+
+#endif
@@ -47,8 +47,11 @@ const DeclaratorSyntax* SyntaxUtilities::innerDeclaratorOf(const DeclaratorSynta
         case SyntaxKind::ArrayDeclarator:
         case SyntaxKind::FunctionDeclarator:
             return decltor->asArrayOrFunctionDeclarator()->innerDeclarator();
-        case SyntaxKind::BitfieldDeclarator:
-            return decltor->asBitfieldDeclarator()->innerDeclarator();
+        case SyntaxKind::BitfieldDeclarator: {
+            // An unnamed bit-field has no inner declarator.
+            auto innerDecltor = decltor->asBitfieldDeclarator()->innerDeclarator();
+            return innerDecltor ? innerDecltor : decltor;
+        }
         case SyntaxKind::ParenthesizedDeclarator:
             return decltor->asParenthesizedDeclarator()->innerDeclarator();
         default:
@@ -46,6 +46,8 @@
 #include "SyntaxVisitor.h"
 #include "syntax/SyntaxTree.h"
 
+#include <cstdlib>
+
 #ifdef __GNUC__
 #  include <cxxabi.h>
 #endif
@@ -64,103 +66,105 @@ void SyntaxWriterDOTFormat::write(const SyntaxNode* node,
 }
 
 void SyntaxWriterDOTFormat::write(const SyntaxNode* node,
-                                  const std::string& fileSuffix,
+                                  const std::string&,
                                   std::ostream &os)
 {
-    os_ = &os;
-    count_ = 1;
-
-    *os_ << "digraph Syntax { ordering=out;" << std::endl;
-    // std::cout << "rankdir = \"LR\";" << std::endl;
+    OutputSink sink(os);
+    write(node, sink);
+}
 
-    generateTokens();
-    visit(node);
+void SyntaxWriterDOTFormat::write(const SyntaxNode* node, OutputSink& sink)
+{
+    sink_ = &sink;
+    count_ = 0;
+    nodes_.clear();
 
-    for (const auto& conn : connections_)
-        *os_ << conn.first << " -> " << conn.second << std::endl;
+    *sink_ << "digraph Syntax { ordering=out;\n";
+    // *sink_ << "rankdir = \"LR\";\n";
 
+    visit(node);
     alignTerminals();
 
-    *os_ << "}" << std::endl;
+    *sink_ << "}\n";
 }
 
 void SyntaxWriterDOTFormat::alignTerminals()
 {
-    *os_ <<"{ rank=same;" << std::endl;
-    for (const auto& terminalShape : terminalShapes_)
-        *os_ << "  " << terminalShape << ";" << std::endl;
-    *os_ <<"}"<<std::endl;
+    *sink_ << "{ rank=same;\n";
+    for (unsigned token = 1; token < tree_->tokenCount(); ++token) {
+        const auto& tk = tree_->tokenAt(token);
+        if (tk.kind() == SyntaxKind::EndOfFile)
+            break;
+
+        *sink_ << "  ";
+        terminalId(tk);
+        *sink_ << " [shape=rect label = \"";
+        for (auto c = tk.valueText_c_str(); *c; ++c) {
+            if (*c == '"' || *c == '\\')
+                *sink_ << '\\';
+            *sink_ << *c;
+        }
+        *sink_ << "\"]";
+
+        if (token > 1) {
+            *sink_ << "; ";
+            terminalId(tree_->tokenAt(token - 1));
+            *sink_ << " -> ";
+            terminalId(tk);
+            *sink_ << " [arrowhead=\"vee\" color=\"transparent\"]";
+        }
+        *sink_ << ";\n";
+    }
+    *sink_ << "}\n";
 }
 
 std::string SyntaxWriterDOTFormat::name(const SyntaxNode* node) {
 #ifdef __GNUC__
-    std::string name = abi::__cxa_demangle(typeid(*node).name(), 0, 0, 0) + 8;
+    auto demangled = abi::__cxa_demangle(typeid(*node).name(), 0, 0, 0);
+    std::string name = demangled + 8;
+    std::free(demangled);
 #else
     std::string name = typeid(*node).name();
 #endif
     return name;
 }
 
-std::string SyntaxWriterDOTFormat::terminalId(unsigned token)
+void SyntaxWriterDOTFormat::terminalId(const SyntaxToken& tk)
 {
-    return 't' + std::to_string(token);
+    // A token is identified by its offset in the text.
+    *sink_ << 't' << tk.span().start();
 }
 
-std::string SyntaxWriterDOTFormat::terminalId(const SyntaxToken& tk)
+void SyntaxWriterDOTFormat::terminal(const SyntaxToken& tk, const SyntaxNode*)
 {
-    return 't' + tk.valueText();
-}
+    if (!tk.isValid() || nodes_.empty())
+        return;
 
-void SyntaxWriterDOTFormat::terminal(const SyntaxToken& tk, const SyntaxNode *node)
-{
-    connections_.push_back(std::make_pair(id_[node], terminalId(tk)));
+    *sink_ << 'n' << nodes_.back() << " -> ";
+    terminalId(tk);
+    *sink_ << '\n';
 }
 
-void SyntaxWriterDOTFormat::generateTokens() {
-    for (unsigned token = 1; token < tree_->tokenCount(); ++token) {
-        if (tree_->tokenAt(token).kind() == SyntaxKind::EndOfFile)
-            break;
-
-        std::string t;
-        t.append(terminalId(token));
-        t.append(" [shape=rect label = \"");
-        t.append(tree_->tokenAt(token).valueText());
-        t.append("\"]");
-
-        if (token > 1) {
-            t.append("; ");
-            t.append(terminalId(token - 1));
-            t.append(" -> ");
-            t.append(terminalId(token));
-            t.append(" [arrowhead=\"vee\" color=\"transparent\"]");
-        }
-
-        terminalShapes_.push_back(t);
-    }
-}
-
-void SyntaxWriterDOTFormat::nodeLabel(const SyntaxNode* node)
+void SyntaxWriterDOTFormat::nodeLabel(const SyntaxNode* node, unsigned id)
 {
-    *os_ << id_[node] << " [label=\"" << name(node) << "\"];" << std::endl;
+    *sink_ << 'n' << id << " [label=\"" << name(node) << "\"];\n";
 }
 
 bool SyntaxWriterDOTFormat::preVisit(const SyntaxNode* node)
 {
-    const std::string id = 'n' + std::to_string(count_++);
-    id_[node] = id;
+    auto id = ++count_;
 
     if (!nodes_.empty())
-        connections_.push_back(std::make_pair(id_[nodes_.top()], id));
+        *sink_ << 'n' << nodes_.back() << " -> n" << id << '\n';
 
-    nodes_.push(node);
+    nodes_.push_back(id);
 
-    nodeLabel(node);
+    nodeLabel(node, id);
 
     return true;
 }
 
 void SyntaxWriterDOTFormat::postVisit(const SyntaxNode *)
 {
-    nodes_.pop();
+    nodes_.pop_back();
 }
-
@@ -47,11 +47,10 @@
 
 #include "SyntaxDumper.h"
 
+#include "../common/infra/OutputSink.h"
+
 #include <fstream>
-#include <stack>
 #include <string>
-#include <unordered_map>
-#include <utility>
 #include <vector>
 
 namespace psy {
@@ -64,27 +63,23 @@ public:
 
     void write(const SyntaxNode* node, const std::string& fileSuffix);
     void write(const SyntaxNode* node, const std::string& fileSuffix, std::ostream& os);
+    void write(const SyntaxNode* node, OutputSink& sink);
 
 private:
     static std::string name(const SyntaxNode* node);
 
     void terminal(const SyntaxToken& tk, const SyntaxNode* node) override;
-    std::string terminalId(unsigned token);
-    std::string terminalId(const SyntaxToken& tk);
+    void terminalId(const SyntaxToken& tk);
 
-    void generateTokens();
     void alignTerminals();
-    void nodeLabel(const SyntaxNode* node);
+    void nodeLabel(const SyntaxNode* node, unsigned id);
 
     bool preVisit(const SyntaxNode* node) override;
     void postVisit(const SyntaxNode*) override;
 
-    std::unordered_map<const SyntaxNode*, std::string> id_;
-    std::vector<std::pair<std::string, std::string>> connections_;
-    std::stack<const SyntaxNode*> nodes_;
-    std::vector<std::string> terminalShapes_;
-    std::ostream* os_;
-    int count_;
+    std::vector<unsigned> nodes_;
+    OutputSink* sink_ = nullptr;
+    unsigned count_ = 0;
 };
 
 } // C
@@ -0,0 +1,437 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SyntaxWriterJSONLines.h"
+
+#include "SyntaxTree.h"
+
+#include "sema/Scope.h"
+#include "sema/SemanticModel.h"
+#include "sema/TypeInfo.h"
+#include "symbols/Symbol_ALL.h"
+#include "syntax/SyntaxUtilities.h"
+#include "types/Type_ALL.h"
+
+#include "../common/infra/Assertions.h"
+
+using namespace psy;
+using namespace C;
+
+namespace {
+
+const char* nameOf(SymbolKind symK)
+{
+    switch (symK) {
+        case SymbolKind::Program:
+            return "Program";
+        case SymbolKind::TranslationUnit:
+            return "TranslationUnit";
+        case SymbolKind::FunctionDeclaration:
+            return "FunctionDeclaration";
+        case SymbolKind::EnumeratorDeclaration:
+            return "EnumeratorDeclaration";
+        case SymbolKind::FieldDeclaration:
+            return "FieldDeclaration";
+        case SymbolKind::VariableDeclaration:
+            return "VariableDeclaration";
+        case SymbolKind::ParameterDeclaration:
+            return "ParameterDeclaration";
+        case SymbolKind::TypedefDeclaration:
+            return "TypedefDeclaration";
+        case SymbolKind::StructDeclaration:
+            return "StructDeclaration";
+        case SymbolKind::UnionDeclaration:
+            return "UnionDeclaration";
+        case SymbolKind::EnumDeclaration:
+            return "EnumDeclaration";
+    }
+    PSY_ASSERT_1(false);
+    return "";
+}
+
+const char* nameOf(DeclarationCategory declK)
+{
+    switch (declK) {
+        case DeclarationCategory::Function:
+            return "Function";
+        case DeclarationCategory::Object:
+            return "Object";
+        case DeclarationCategory::Member:
+            return "Member";
+        case DeclarationCategory::Type:
+            return "Type";
+    }
+    PSY_ASSERT_1(false);
+    return "";
+}
+
+const char* nameOf(ScopeKind scopeK)
+{
+    switch (scopeK) {
+        case ScopeKind::File:
+            return "File";
+        case ScopeKind::Function:
+            return "Function";
+        case ScopeKind::FunctionPrototype:
+            return "FunctionPrototype";
+        case ScopeKind::Block:
+            return "Block";
+    }
+    PSY_ASSERT_1(false);
+    return "";
+}
+
+const char* nameOf(BasicTypeKind basicTyK)
+{
+    switch (basicTyK) {
+        case BasicTypeKind::Char:
+            return "char";
+        case BasicTypeKind::Char_S:
+            return "signed char";
+        case BasicTypeKind::Char_U:
+            return "unsigned char";
+        case BasicTypeKind::Short_S:
+            return "signed short";
+        case BasicTypeKind::Short_U:
+            return "unsigned short";
+        case BasicTypeKind::Int_S:
+            return "signed int";
+        case BasicTypeKind::Int_U:
+            return "unsigned int";
+        case BasicTypeKind::Long_S:
+            return "signed long";
+        case BasicTypeKind::Long_U:
+            return "unsigned long";
+        case BasicTypeKind::LongLong_S:
+            return "signed long long";
+        case BasicTypeKind::LongLong_U:
+            return "unsigned long long";
+        case BasicTypeKind::Bool:
+            return "_Bool";
+        case BasicTypeKind::Float:
+            return "float";
+        case BasicTypeKind::Double:
+            return "double";
+        case BasicTypeKind::LongDouble:
+            return "long double";
+        case BasicTypeKind::FloatComplex:
+            return "float _Complex";
+        case BasicTypeKind::DoubleComplex:
+            return "double _Complex";
+        case BasicTypeKind::LongDoubleComplex:
+            return "long double _Complex";
+    }
+    PSY_ASSERT_1(false);
+    return "";
+}
+
+const char* nameOf(TagTypeKind tagTyK)
+{
+    switch (tagTyK) {
+        case TagTypeKind::Struct:
+            return "struct";
+        case TagTypeKind::Union:
+            return "union";
+        case TagTypeKind::Enum:
+            return "enum";
+    }
+    PSY_ASSERT_1(false);
+    return "";
+}
+
+} // anonymous
+
+void SyntaxWriterJSONLines::write(const SyntaxNode* node,
+                                  std::ostream& os,
+                                  const SemanticModel* semaModel)
+{
+    OutputSink sink(os);
+    write(node, sink, semaModel);
+}
+
+void SyntaxWriterJSONLines::write(const SyntaxNode* node,
+                                  OutputSink& sink,
+                                  const SemanticModel* semaModel)
+{
+    sink_ = &sink;
+    semaModel_ = semaModel;
+    nodeCnt_ = 0;
+    nodes_.clear();
+    declIds_.clear();
+    writtenDecls_.clear();
+    pendingDecls_.clear();
+
+    *sink_ << "{\"rec\":\"tree\",\"path\":";
+    writeString(tree_->filePath().c_str());
+    *sink_ << "}\n";
+
+    visit(node);
+
+    // Referenced declarations whose declaring node wasn't visited.
+    for (auto decl : pendingDecls_)
+        writeDeclaration(decl, 0);
+}
+
+bool SyntaxWriterJSONLines::preVisit(const SyntaxNode* node)
+{
+    auto id = ++nodeCnt_;
+
+    *sink_ << "{\"rec\":\"node\",\"id\":" << id << ",\"parent\":";
+    if (nodes_.empty())
+        *sink_ << "null";
+    else
+        *sink_ << nodes_.back();
+    *sink_ << ",\"kind\":\"" << to_string(node->kind()) << '"';
+
+    if (node->firstToken().isValid() && node->lastToken().isValid()) {
+        auto span = node->span();
+        *sink_ << ",\"span\":[" << span.start() << ',' << span.end() << ']';
+    }
+
+    if (semaModel_)
+        writeSemantics(node, id);
+    else
+        *sink_ << "}\n";
+
+    nodes_.push_back(id);
+
+    return true;
+}
+
+void SyntaxWriterJSONLines::postVisit(const SyntaxNode*)
+{
+    nodes_.pop_back();
+}
+
+void SyntaxWriterJSONLines::terminal(const SyntaxToken& tk, const SyntaxNode*)
+{
+    if (!tk.isValid() || nodes_.empty())
+        return;
+
+    *sink_ << "{\"rec\":\"token\",\"parent\":" << nodes_.back()
+           << ",\"kind\":\"" << to_string(tk.kind()) << "\",\"text\":";
+    writeString(tk.valueText_c_str());
+    *sink_ << ",\"span\":[" << tk.span().start() << ',' << tk.span().end() << "]}\n";
+}
+
+void SyntaxWriterJSONLines::writeSemantics(const SyntaxNode* node, std::uint32_t id)
+{
+    // The node record is still open.
+    if (auto expr = node->asExpression()) {
+        auto tyInfo = semaModel_->typeInfoOf(expr);
+        if (tyInfo.typeOrigin() != TypeInfo::TypeOrigin::Error) {
+            *sink_ << ",\"type\":";
+            writeType(tyInfo.type());
+        }
+    }
+
+    if (node->kind() == SyntaxKind::IdentifierName) {
+        auto identNode = node->asIdentifierName();
+        auto scope = semaModel_->scopeOf(identNode);
+        if (scope) {
+            *sink_ << ",\"scope\":\"" << nameOf(scope->kind()) << "\",\"decl\":";
+            auto decl = scope->searchForDeclaration(identifierFrom(identNode),
+                                                    NameSpace::OrdinaryIdentifiers);
+            if (!decl)
+                *sink_ << "null";
+            else {
+                *sink_ << declIdOf(decl);
+                if (!writtenDecls_.count(decl))
+                    pendingDecls_.push_back(decl);
+            }
+        }
+    }
+    *sink_ << "}\n";
+
+    const DeclarationSymbol* decl = nullptr;
+    if (auto decltor = node->asDeclarator())
+        decl = semaModel_->declarationBy(decltor);
+    else if (auto parmDecl = node->asParameterDeclaration())
+        decl = semaModel_->parameterFor(parmDecl);
+    else if (auto tyDecl = node->asTypeDeclaration())
+        decl = semaModel_->typeDeclarationFor(tyDecl);
+    else if (auto enumeratorDecl = node->asEnumeratorDeclaration())
+        decl = semaModel_->enumeratorFor(enumeratorDecl);
+    else if (node->kind() == SyntaxKind::FunctionDefinition)
+        decl = semaModel_->functionFor(node->asFunctionDefinition());
+
+    if (decl)
+        writeDeclaration(decl, id);
+}
+
+std::uint32_t SyntaxWriterJSONLines::declIdOf(const DeclarationSymbol* decl)
+{
+    auto declId = static_cast<std::uint32_t>(declIds_.size() + 1);
+    return declIds_.emplace(decl, declId).first->second;
+}
+
+void SyntaxWriterJSONLines::writeDeclaration(const DeclarationSymbol* decl, std::uint32_t nodeId)
+{
+    if (!writtenDecls_.insert(decl).second)
+        return;
+
+    *sink_ << "{\"rec\":\"decl\",\"id\":" << declIdOf(decl) << ",\"node\":";
+    if (nodeId)
+        *sink_ << nodeId;
+    else
+        *sink_ << "null";
+    *sink_ << ",\"kind\":\"" << nameOf(decl->kind())
+           << "\",\"category\":\"" << nameOf(decl->category()) << '"';
+
+    if (auto nameableDecl = MIXIN_NameableDeclarationSymbol::from(const_cast<DeclarationSymbol*>(decl))) {
+        if (auto name = nameableDecl->name()) {
+            *sink_ << ",\"name\":";
+            writeString(name->c_str());
+        }
+    }
+    else if (auto tyDecl = decl->asTypeDeclaration()) {
+        auto ty = tyDecl->introducedType();
+        if (ty && ty->kind() == TypeKind::TypedefName) {
+            *sink_ << ",\"name\":";
+            writeString(ty->asTypedefNameType()->typedefName()->c_str());
+        }
+        else if (ty && ty->kind() == TypeKind::Tag && !ty->asTagType()->isUntagged()) {
+            *sink_ << ",\"name\":";
+            writeString(ty->asTagType()->tag()->c_str());
+        }
+    }
+
+    if (auto scope = decl->enclosingScope())
+        *sink_ << ",\"scope\":\"" << nameOf(scope->kind()) << '"';
+
+    if (auto typeableDecl = MIXIN_TypeableDeclarationSymbol::from(decl)) {
+        *sink_ << ",\"type\":";
+        writeType(typeableDecl->type());
+    }
+    *sink_ << "}\n";
+}
+
+void SyntaxWriterJSONLines::writeType(const Type* ty)
+{
+    if (!ty) {
+        *sink_ << "null";
+        return;
+    }
+
+    switch (ty->kind()) {
+        case TypeKind::Array:
+            *sink_ << "{\"kind\":\"Array\",\"of\":";
+            writeType(ty->asArrayType()->elementType());
+            break;
+
+        case TypeKind::Basic:
+            *sink_ << "{\"kind\":\"Basic\",\"basic\":\""
+                   << nameOf(ty->asBasicType()->kind()) << '"';
+            break;
+
+        case TypeKind::Function: {
+            auto funcTy = ty->asFunctionType();
+            *sink_ << "{\"kind\":\"Function\",\"ret\":";
+            writeType(funcTy->returnType());
+            *sink_ << ",\"params\":[";
+            auto sep = "";
+            for (auto parmTy : funcTy->parameterTypes()) {
+                *sink_ << sep;
+                writeType(parmTy);
+                sep = ",";
+            }
+            *sink_ << "],\"variadic\":" << (funcTy->isVariadic() ? "true" : "false");
+            break;
+        }
+
+        case TypeKind::Pointer:
+            *sink_ << "{\"kind\":\"Pointer\",\"to\":";
+            writeType(ty->asPointerType()->referencedType());
+            break;
+
+        case TypeKind::TypedefName:
+            *sink_ << "{\"kind\":\"TypedefName\",\"name\":";
+            writeString(ty->asTypedefNameType()->typedefName()->c_str());
+            break;
+
+        case TypeKind::Tag: {
+            auto tagTy = ty->asTagType();
+            *sink_ << "{\"kind\":\"Tag\",\"tag\":\"" << nameOf(tagTy->kind()) << '"';
+            if (!tagTy->isUntagged()) {
+                *sink_ << ",\"name\":";
+                writeString(tagTy->tag()->c_str());
+            }
+            break;
+        }
+
+        case TypeKind::Void:
+            *sink_ << "{\"kind\":\"Void\"";
+            break;
+
+        case TypeKind::Qualified: {
+            auto qualTy = ty->asQualifiedType();
+            auto quals = qualTy->qualifiers();
+            *sink_ << "{\"kind\":\"Qualified\"";
+            if (quals.hasConst())
+                *sink_ << ",\"const\":true";
+            if (quals.hasVolatile())
+                *sink_ << ",\"volatile\":true";
+            if (quals.hasRestrict())
+                *sink_ << ",\"restrict\":true";
+            if (quals.hasAtomic())
+                *sink_ << ",\"atomic\":true";
+            *sink_ << ",\"of\":";
+            writeType(qualTy->unqualifiedType());
+            break;
+        }
+
+        case TypeKind::Error:
+            *sink_ << "{\"kind\":\"Error\"";
+            break;
+    }
+    *sink_ << '}';
+}
+
+void SyntaxWriterJSONLines::writeString(const char* s)
+{
+    static const char kHex[] = "0123456789abcdef";
+
+    *sink_ << '"';
+    for (; *s; ++s) {
+        auto c = static_cast<unsigned char>(*s);
+        switch (c) {
+            case '"':
+                *sink_ << "\\\"";
+                break;
+            case '\\':
+                *sink_ << "\\\\";
+                break;
+            case '\n':
+                *sink_ << "\\n";
+                break;
+            case '\t':
+                *sink_ << "\\t";
+                break;
+            default:
+                if (c < 0x20) {
+                    *sink_ << "\\u00" << kHex[c >> 4] << kHex[c & 0xF];
+                    break;
+                }
+                *sink_ << static_cast<char>(c);
+                break;
+        }
+    }
+    *sink_ << '"';
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_C_SYNTAX_WRITER_JSON_LINES_H__
+#define PSYCHE_C_SYNTAX_WRITER_JSON_LINES_H__
+
+#include "API.h"
+#include "Fwds.h"
+
+#include "SyntaxDumper.h"
+
+#include "../common/infra/OutputSink.h"
+
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace psy {
+namespace C {
+
+/**
+ * \brief The SyntaxWriterJSONLines class.
+ *
+ * Export a SyntaxTree, and optionally its SemanticModel, as JSON Lines:
+ * one JSON object per line, each one a record of kind \c tree, \c node,
+ * \c token, or \c decl. Records are written as the tree is visited;
+ * nodes are identified by (stable) integer ids, in the order in which
+ * they're written, and declarations by ids in the order in which they're
+ * first mentioned. A reference to a declaration that appears later in the
+ * tree thus precedes its \c decl record; and a declaration that isn't
+ * part of the tree (e.g., from a prelude) gets a \c decl record, with a
+ * \c null node, at the end.
+ *
+ * \code
+ * {"rec":"node","id":4,"parent":3,"kind":"IdentifierName","span":[17,18],"type":{"kind":"Basic","basic":"int"},"scope":"Block","decl":2}
+ * {"rec":"token","parent":4,"kind":"IdentifierToken","text":"x","span":[17,18]}
+ * {"rec":"decl","id":2,"node":9,"kind":"VariableDeclaration","category":"Object","name":"x","scope":"File","type":{"kind":"Basic","basic":"int"}}
+ * \endcode
+ */
+class PSY_C_API SyntaxWriterJSONLines final : public SyntaxDumper
+{
+public:
+    using SyntaxDumper::SyntaxDumper;
+
+    void write(const SyntaxNode* node,
+               std::ostream& os,
+               const SemanticModel* semaModel = nullptr);
+    void write(const SyntaxNode* node,
+               OutputSink& sink,
+               const SemanticModel* semaModel = nullptr);
+
+private:
+    bool preVisit(const SyntaxNode* node) override;
+    void postVisit(const SyntaxNode*) override;
+    void terminal(const SyntaxToken& tk, const SyntaxNode* node) override;
+
+    void writeSemantics(const SyntaxNode* node, std::uint32_t id);
+    void writeDeclaration(const DeclarationSymbol* decl, std::uint32_t nodeId);
+    std::uint32_t declIdOf(const DeclarationSymbol* decl);
+    void writeType(const Type* ty);
+    void writeString(const char* s);
+
+    OutputSink* sink_ = nullptr;
+    const SemanticModel* semaModel_ = nullptr;
+    std::uint32_t nodeCnt_ = 0;
+    std::vector<std::uint32_t> nodes_;
+    std::unordered_map<const DeclarationSymbol*, std::uint32_t> declIds_;
+    std::unordered_set<const DeclarationSymbol*> writtenDecls_;
+    std::vector<const DeclarationSymbol*> pendingDecls_;
+};
+
+} // C
+} // psy
+
+#endif
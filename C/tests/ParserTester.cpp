@@ -54,6 +54,11 @@ void ParserTester::parse(
     (static_cast<InternalsTestSuite*>(suite_)->parse(text, X, synCat, parseOpts));
 }
 
+const SyntaxTree* ParserTester::syntaxTree() const
+{
+    return static_cast<InternalsTestSuite*>(suite_)->tree_.get();
+}
+
 void ParserTester::setUp()
 {}
 
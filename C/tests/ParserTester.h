@@ -52,6 +52,8 @@ public:
                SyntaxTree::SyntaxCategory synCat = SyntaxTree::SyntaxCategory::Any,
                ParseOptions parseOpts = ParseOptions());
 
+    const SyntaxTree* syntaxTree() const;
+
     using TestFunction = std::pair<std::function<void(ParserTester*)>, const char*>;
 
     /*
@@ -116,8 +118,9 @@ public:
             + 3000-3009 -> `va_arg'
             + 3010-3019 -> `offsetof'
             + 3020-3029 -> `__func__'
-            + 3030-3039 ->
-            + 3040-3099 ->
+            + 3030-3039 -> line markers and expansion marks
+            + 3040-3049 -> comments (trivia)
+            + 3050-3099 ->
             + 3100-3199 ->
             + 3200-3299 ->
             + 3300-3399 ->
@@ -650,8 +650,61 @@ void ParserTester::case1096()
                         Parser::DiagnosticsReporter::ID_of_ExpectedFIRSTofExpression));
 }
 
-void ParserTester::case1097() {}
-void ParserTester::case1098() {}
+void ParserTester::case1097()
+{
+    auto intLexeme = [this] (const std::string& text) {
+        parseExpression(text,
+                        Expectation().AST( { SyntaxKind::IntegerConstantExpression }));
+        auto expr = syntaxTree()->root()->asConstantExpression();
+        PSY_EXPECT_TRUE(expr);
+        return expr->constantToken().lexeme()->asIntegerConstant();
+    };
+
+    auto lexeme = intLexeme("42");
+    PSY_EXPECT_EQ_INT(lexeme->integerValue(), 42);
+    PSY_EXPECT_FALSE(lexeme->overflows());
+
+    lexeme = intLexeme("0x1Fu");
+    PSY_EXPECT_EQ_INT(lexeme->integerValue(), 31);
+    PSY_EXPECT_TRUE(lexeme->isOctalOrHexadecimal());
+    PSY_EXPECT_EQ_INT(lexeme->value<int>(), 31);
+
+    lexeme = intLexeme("017L");
+    PSY_EXPECT_EQ_INT(lexeme->integerValue(), 15);
+    PSY_EXPECT_TRUE(lexeme->representationSuffix() == IntegerConstant::RepresentationSuffix::lOrL);
+
+    lexeme = intLexeme("0b101");
+    PSY_EXPECT_EQ_INT(lexeme->integerValue(), 5);
+
+    lexeme = intLexeme("18446744073709551615ull");
+    PSY_EXPECT_TRUE(lexeme->integerValue() == 18446744073709551615ull);
+    PSY_EXPECT_FALSE(lexeme->overflows());
+
+    lexeme = intLexeme("18446744073709551616");
+    PSY_EXPECT_TRUE(lexeme->overflows());
+}
+
+void ParserTester::case1098()
+{
+    auto floatLexeme = [this] (const std::string& text) {
+        parseExpression(text,
+                        Expectation().AST( { SyntaxKind::FloatingConstantExpression }));
+        auto expr = syntaxTree()->root()->asConstantExpression();
+        PSY_EXPECT_TRUE(expr);
+        return expr->constantToken().lexeme()->asFloatingConstant();
+    };
+
+    auto lexeme = floatLexeme("1.5f");
+    PSY_EXPECT_TRUE(lexeme->floatingValue() == 1.5L);
+    PSY_EXPECT_TRUE(lexeme->value<float>() == 1.5f);
+
+    lexeme = floatLexeme("0x1.8p1");
+    PSY_EXPECT_TRUE(lexeme->floatingValue() == 3.0L);
+
+    lexeme = floatLexeme("25e-1L");
+    PSY_EXPECT_TRUE(lexeme->floatingValue() == 2.5L);
+}
+
 void ParserTester::case1099() {}
 
 void ParserTester::case1100()
@@ -230,92 +230,294 @@ void ParserTester::case3029()
 
 void ParserTester::case3030()
 {
-
+    parse("# 1 \"foo.c\"\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3031()
 {
-
+    parse("# 1 \"foo.c\"\n"
+          "# 1 \"<built-in>\" 1 3\n"
+          "#line 10 \"bar\\\\baz.c\"\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3032()
 {
-
+    parse("#pragma pack(1)\n"
+          "int x ;\n"
+          "#\n"
+          "# 5\n",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3033()
 {
-
+    parse("#pragma weak \\\n"
+          "  x\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3034()
 {
-
+    parse("# expansion begin 12,3 7:4 ~2 7:9\n"
+          "int x = 1 ;\n"
+          "# expansion end\n"
+          "int y ;",
+          Expectation().unparsedText("int x = 1 ; int y ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator,
+                              SyntaxKind::ExpressionInitializer,
+                              SyntaxKind::IntegerConstantExpression,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3035()
 {
-
+    parse("# expansion begin 0,1 ~1\n"
+          "int\n"
+          "# expansion end\n"
+          "x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3036()
 {
-
+    parse("#define X /* a\n"
+          "  b */\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3037()
 {
-
+    parse("#pragma foo // a \\\n"
+          "  b\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3038()
 {
-
+    parse("#pragma message ( \"/* a\" )\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3039()
 {
-
+    parse("# /* a\n"
+          " */ 1 \"foo.c\" /* b */\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;").AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator }));
 }
 
 void ParserTester::case3040()
 {
+    parse("// a\n"
+          "int x ; // b\n"
+          "/* c */ int y ;",
+          Expectation().unparsedText("int x ; int y ;"),
+          SyntaxTree::SyntaxCategory::Any,
+          ParseOptions().setCommentMode(ParseOptions::CommentMode::KeepAll));
 
+    auto tree = syntaxTree();
+    PSY_EXPECT_EQ_INT(tree->trivia().size(), 3);
+    PSY_EXPECT_EQ_STR(tree->triviaText(tree->trivia()[0]), "// a");
+    PSY_EXPECT_EQ_STR(tree->triviaText(tree->trivia()[1]), "// b");
+    PSY_EXPECT_EQ_STR(tree->triviaText(tree->trivia()[2]), "/* c */");
+    PSY_EXPECT_EQ_ENU(tree->trivia()[0].kind(), SyntaxKind::SingleLineCommentTrivia, SyntaxKind);
+    PSY_EXPECT_EQ_ENU(tree->trivia()[2].kind(), SyntaxKind::MultiLineCommentTrivia, SyntaxKind);
+
+    auto decls = tree->translationUnitRoot()->declarations();
+    auto leading = tree->leadingTrivia(decls->value);
+    PSY_EXPECT_EQ_INT(leading.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(leading[0]), "// a");
+
+    auto trailing = tree->trailingTrivia(decls->value);
+    PSY_EXPECT_EQ_INT(trailing.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(trailing[0]), "// b");
+
+    leading = tree->leadingTrivia(decls->next->value);
+    PSY_EXPECT_EQ_INT(leading.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(leading[0]), "/* c */");
+    PSY_EXPECT_EQ_INT(tree->trailingTrivia(decls->next->value).size(), 0);
 }
 
 void ParserTester::case3041()
 {
+    parse("int x ; /* b */ /* c */\n"
+          "/* d */\n"
+          "int y ;",
+          Expectation().unparsedText("int x ; int y ;"),
+          SyntaxTree::SyntaxCategory::Any,
+          ParseOptions().setCommentMode(ParseOptions::CommentMode::KeepAll));
+
+    auto tree = syntaxTree();
+    auto decls = tree->translationUnitRoot()->declarations();
+    PSY_EXPECT_EQ_INT(tree->leadingTrivia(decls->value).size(), 0);
+
+    auto trailing = tree->trailingTrivia(decls->value);
+    PSY_EXPECT_EQ_INT(trailing.size(), 2);
+    PSY_EXPECT_EQ_STR(tree->triviaText(trailing[0]), "/* b */");
+    PSY_EXPECT_EQ_STR(tree->triviaText(trailing[1]), "/* c */");
 
+    auto leading = tree->leadingTrivia(decls->next->value);
+    PSY_EXPECT_EQ_INT(leading.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(leading[0]), "/* d */");
 }
 
 void ParserTester::case3042()
 {
+    parse("int x /* a */ = /* b */ 1 ; /* c\n"
+          "   d */ int y ;",
+          Expectation().unparsedText("int x = 1 ; int y ;"),
+          SyntaxTree::SyntaxCategory::Any,
+          ParseOptions().setCommentMode(ParseOptions::CommentMode::KeepAll));
 
+    auto tree = syntaxTree();
+    PSY_EXPECT_EQ_INT(tree->trivia().size(), 3);
+
+    auto decls = tree->translationUnitRoot()->declarations();
+    auto trailing = tree->trailingTrivia(decls->value);
+    PSY_EXPECT_EQ_INT(trailing.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(trailing[0]), "/* c\n   d */");
+    PSY_EXPECT_EQ_INT(tree->leadingTrivia(decls->next->value).size(), 0);
+
+    const auto& span = tree->trivia()[1].span();
+    PSY_EXPECT_EQ_INT(span.start(), 16);
+    PSY_EXPECT_EQ_INT(span.end(), 23);
 }
 
 void ParserTester::case3043()
 {
+    parse("/// a\n"
+          "// b\n"
+          "/** c */\n"
+          "/* d */\n"
+          "int x ;",
+          Expectation().unparsedText("int x ;"),
+          SyntaxTree::SyntaxCategory::Any,
+          ParseOptions().setCommentMode(ParseOptions::CommentMode::KeepOnlyDocumentation));
 
+    auto tree = syntaxTree();
+    PSY_EXPECT_EQ_INT(tree->trivia().size(), 2);
+    PSY_EXPECT_TRUE(tree->trivia()[0].isDocumentation());
+    PSY_EXPECT_EQ_STR(tree->triviaText(tree->trivia()[0]), "/// a");
+    PSY_EXPECT_TRUE(tree->trivia()[1].isDocumentation());
+    PSY_EXPECT_EQ_STR(tree->triviaText(tree->trivia()[1]), "/** c */");
 }
 
 void ParserTester::case3044()
 {
+    parse("// a\n"
+          "int x ; /* b */",
+          Expectation().unparsedText("int x ;"));
 
+    PSY_EXPECT_EQ_INT(syntaxTree()->trivia().size(), 0);
 }
 
 void ParserTester::case3045()
 {
+    parse("void f ( ) { x ; } // a\n"
+          "int y ;",
+          Expectation().unparsedText("void f ( ) { x ; } int y ;"),
+          SyntaxTree::SyntaxCategory::Any,
+          ParseOptions().setCommentMode(ParseOptions::CommentMode::KeepAll));
+
+    auto tree = syntaxTree();
+    auto funcDef = tree->translationUnitRoot()->declarations()->value;
+    PSY_EXPECT_EQ_ENU(funcDef->lastToken().kind(), SyntaxKind::CloseBraceToken, SyntaxKind);
 
+    auto trailing = tree->trailingTrivia(funcDef);
+    PSY_EXPECT_EQ_INT(trailing.size(), 1);
+    PSY_EXPECT_EQ_STR(tree->triviaText(trailing[0]), "// a");
 }
 
 void ParserTester::case3046()
 {
-
+    parse("int x = 1 + 2 , y ;",
+          Expectation().AST({ SyntaxKind::TranslationUnit,
+                              SyntaxKind::VariableAndOrFunctionDeclaration,
+                              SyntaxKind::BasicTypeSpecifier,
+                              SyntaxKind::IdentifierDeclarator,
+                              SyntaxKind::ExpressionInitializer,
+                              SyntaxKind::AddExpression,
+                              SyntaxKind::IntegerConstantExpression,
+                              SyntaxKind::IntegerConstantExpression,
+                              SyntaxKind::IdentifierDeclarator }));
+
+    auto tree = syntaxTree();
+    auto decl = tree->translationUnitRoot()->declarations()->value->asVariableAndOrFunctionDeclaration();
+    PSY_EXPECT_TRUE(decl);
+    PSY_EXPECT_EQ_INT(decl->span().start(), 0);
+    PSY_EXPECT_EQ_INT(decl->span().end(), 19);
+    PSY_EXPECT_EQ_ENU(decl->lastToken().kind(), SyntaxKind::SemicolonToken, SyntaxKind);
+
+    auto decltor = decl->declarators()->value;
+    PSY_EXPECT_EQ_STR(decltor->firstToken().valueText(), "x");
+    PSY_EXPECT_EQ_STR(decltor->lastToken().valueText(), "2");
+    PSY_EXPECT_EQ_INT(decltor->span().start(), 4);
+    PSY_EXPECT_EQ_INT(decltor->span().end(), 13);
+
+    decltor = decl->declarators()->next->value;
+    PSY_EXPECT_EQ_INT(decltor->span().start(), 16);
+    PSY_EXPECT_EQ_INT(decltor->span().end(), 17);
 }
 
 void ParserTester::case3047()
 {
-
+    // Enough declarations for the nodes to span many blocks of the pool.
+    std::string s;
+    for (auto i = 0; i < 2000; ++i)
+        s += "int x" + std::to_string(i) + " , y ;\n";
+
+    parse(s);
+
+    auto tree = syntaxTree();
+    auto cnt = 0;
+    for (auto decls = tree->translationUnitRoot()->declarations(); decls; decls = decls->next) {
+        auto decl = decls->value->asVariableAndOrFunctionDeclaration();
+        PSY_EXPECT_TRUE(decl);
+        PSY_EXPECT_TRUE(decl->syntaxTree() == tree);
+        PSY_EXPECT_TRUE(decl->declarators()->value->syntaxTree() == tree);
+        PSY_EXPECT_EQ_ENU(decl->declarators()->delimiterToken().kind(), SyntaxKind::CommaToken, SyntaxKind);
+        ++cnt;
+    }
+    PSY_EXPECT_EQ_INT(cnt, 2000);
 }
 
 void ParserTester::case3048()
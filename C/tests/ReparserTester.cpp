@@ -1361,8 +1361,64 @@ int _ ( )
                           SyntaxKind::IntegerConstantExpression })));
 }
 
-void ReparserTester::case0203(){}
-void ReparserTester::case0204(){}
+void ReparserTester::case0203()
+{
+    auto s = R"(
+int _ ( )
+{
+    typedef int x ;
+    f ( ( x ) - 1 ) ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST(
+                    preamble_clean(
+                        { SyntaxKind::DeclarationStatement,
+                          SyntaxKind::TypedefDeclaration,
+                          SyntaxKind::TypedefStorageClass,
+                          SyntaxKind::BasicTypeSpecifier,
+                          SyntaxKind::IdentifierDeclarator,
+                          SyntaxKind::ExpressionStatement,
+                          SyntaxKind::CallExpression,
+                          SyntaxKind::IdentifierName,
+                          SyntaxKind::CastExpression,
+                          SyntaxKind::TypeName,
+                          SyntaxKind::TypedefName,
+                          SyntaxKind::AbstractDeclarator,
+                          SyntaxKind::UnaryMinusExpression,
+                          SyntaxKind::IntegerConstantExpression })));
+}
+
+void ReparserTester::case0204()
+{
+    auto s = R"(
+int _ ( )
+{
+    int x ;
+    f ( 0 , ( x ) - 1 ) ;
+}
+)";
+
+    reparse_withSyntaxCorrelation(
+                s,
+                Expectation().AST(
+                    preamble_clean(
+                        { SyntaxKind::DeclarationStatement,
+                          SyntaxKind::VariableAndOrFunctionDeclaration,
+                          SyntaxKind::BasicTypeSpecifier,
+                          SyntaxKind::IdentifierDeclarator,
+                          SyntaxKind::ExpressionStatement,
+                          SyntaxKind::CallExpression,
+                          SyntaxKind::IdentifierName,
+                          SyntaxKind::IntegerConstantExpression,
+                          SyntaxKind::SubstractExpression,
+                          SyntaxKind::ParenthesizedExpression,
+                          SyntaxKind::IdentifierName,
+                          SyntaxKind::IntegerConstantExpression })));
+}
+
 void ReparserTester::case0205(){}
 void ReparserTester::case0206(){}
 void ReparserTester::case0207(){}
@@ -23,9 +23,13 @@
 #include "TestSuite_API.h"
 
 #include "C/parser/Unparser.h"
+#include "C/sema/LinkageResolver.h"
+#include "C/sema/SemanticModelSnapshot.h"
+#include "C/sema/UnusedDeclarationChecker.h"
 #include "C/symbols/Symbol_ALL.h"
 #include "C/syntax/Lexeme_ALL.h"
 #include "C/syntax/SyntaxVisitor__MACROS__.inc"
+#include "C/syntax/SyntaxWriterJSONLines.h"
 #include "C/types/Type_ALL.h"
 
 #include <algorithm>
@@ -51,6 +55,9 @@ void SemanticModelTester::tearDown()
 {
     compilation_.reset(nullptr);
     tree_.reset(nullptr);
+    preludedTrees_.clear();
+    restoredCompilation_.reset(nullptr);
+    restoredTree_.reset(nullptr);
 }
 
 class ExpressionCollector : public SyntaxVisitor
@@ -144,7 +151,8 @@ SemanticModelTester::compileTestSymbols(
 
 std::tuple<std::unordered_map<std::string, const ExpressionSyntax*>,
            const SemanticModel*>
-SemanticModelTester::compileTestTypes(const std::string& srcText)
+SemanticModelTester::compileTestTypes(const std::string& srcText,
+                                      PlatformOptions platformOpts)
 {
     tree_ = SyntaxTree::parseText(SourceText(srcText),
                                   TextPreprocessingState::Preprocessed,
@@ -155,7 +163,7 @@ SemanticModelTester::compileTestTypes(const std::string& srcText)
     ExpressionCollector v(tree_.get());
     v.visit(tree_->translationUnitRoot());
 
-    compilation_ = Compilation::create(tree_->filePath());
+    compilation_ = Compilation::create(tree_->filePath(), platformOpts);
     compilation_->addSyntaxTrees({ tree_.get() });
     auto semaModel = compilation_->computeSemanticModel(tree_.get());
     PSY_EXPECT_TRUE(semaModel);
@@ -163,6 +171,87 @@ SemanticModelTester::compileTestTypes(const std::string& srcText)
     return std::make_tuple(v.m, semaModel);
 }
 
+std::tuple<const SyntaxTree*, Compilation*>
+SemanticModelTester::restoreTestSnapshot(const std::string& srcText, const std::string& snapshot)
+{
+    restoredCompilation_.reset();
+    restoredTree_ = SyntaxTree::parseText(SourceText(srcText),
+                                          TextPreprocessingState::Preprocessed,
+                                          TextCompleteness::Fragment,
+                                          ParseOptions(),
+                                          "<test>");
+    restoredCompilation_ = Compilation::create(restoredTree_->filePath());
+    restoredCompilation_->addSyntaxTrees({ restoredTree_.get() });
+    auto restored = restoredCompilation_->restoreSemanticModel(restoredTree_.get(), snapshot);
+    PSY_EXPECT_TRUE(restored);
+
+    return std::make_tuple(restoredTree_.get(), restoredCompilation_.get());
+}
+
+std::tuple<const SyntaxTree*, const SemanticModel*>
+SemanticModelTester::compileTestPreluded(const std::string& srcText,
+                                         const std::string& preludeSrcText)
+{
+    if (!compilation_) {
+        tree_ = SyntaxTree::parseText(SourceText(preludeSrcText),
+                                      TextPreprocessingState::Preprocessed,
+                                      TextCompleteness::Fragment,
+                                      ParseOptions(),
+                                      "<prelude>");
+        compilation_ = Compilation::create(tree_->filePath());
+        compilation_->addSyntaxTree(tree_.get());
+        compilation_->setPreludeSyntaxTree(tree_.get());
+    }
+
+    preludedTrees_.push_back(SyntaxTree::parseText(SourceText(srcText),
+                                                   TextPreprocessingState::Preprocessed,
+                                                   TextCompleteness::Fragment,
+                                                   ParseOptions(),
+                                                   "<test>"));
+    auto tree = preludedTrees_.back().get();
+    compilation_->addSyntaxTree(tree);
+    auto semaModel = compilation_->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    return std::make_tuple(tree, semaModel);
+}
+
+std::string SemanticModelTester::compileTestInferred(const std::string& srcText)
+{
+    tree_ = SyntaxTree::parseText(SourceText(srcText),
+                                  TextPreprocessingState::Preprocessed,
+                                  TextCompleteness::Fragment,
+                                  ParseOptions(),
+                                  "<test>");
+    compilation_ = Compilation::create(
+                tree_->filePath(),
+                PlatformOptions(),
+                InferenceOptions().enable_DeclarationAndTypeInference(true));
+    compilation_->addSyntaxTree(tree_.get());
+    auto semaModel = compilation_->computeSemanticModel(tree_.get());
+    PSY_EXPECT_TRUE(semaModel);
+
+    return semaModel->synthesizedDeclarations();
+}
+
+std::string SemanticModelTester::compileTestExported(const std::string& srcText)
+{
+    tree_ = SyntaxTree::parseText(SourceText(srcText),
+                                  TextPreprocessingState::Preprocessed,
+                                  TextCompleteness::Fragment,
+                                  ParseOptions(),
+                                  "<test>");
+    compilation_ = Compilation::create(tree_->filePath());
+    compilation_->addSyntaxTree(tree_.get());
+    auto semaModel = compilation_->computeSemanticModel(tree_.get());
+    PSY_EXPECT_TRUE(semaModel);
+
+    std::ostringstream oss;
+    SyntaxWriterJSONLines writer(tree_.get());
+    writer.write(tree_->root(), oss, semaModel);
+    return oss.str();
+}
+
 void SemanticModelTester::testSemanticModel()
 {
     return run<SemanticModelTester>(tests_);
@@ -1295,5 +1384,1025 @@ void SemanticModelTester::case0507()
     PSY_EXPECT_EQ_ENU(ty->asBasicType()->kind(), BasicTypeKind::Double, BasicTypeKind);
 }
 
-void SemanticModelTester::case0508(){}
-void SemanticModelTester::case0509(){}
+void SemanticModelTester::case0508()
+{
+    auto [enumDeclNode, semaModel] =
+            compileTestSymbols<EnumDeclarationSyntax>(
+                "enum e { a , b = 5 , c , d = a + c * 2 , f = '\\n' , g = - 1 , h } ;");
+
+    auto enumDecl = semaModel->enumFor(enumDeclNode);
+    PSY_EXPECT_TRUE(enumDecl);
+    auto enumerators = enumDecl->members();
+    PSY_EXPECT_EQ_INT(enumerators.size(), 7);
+
+    long long expected[] = { 0, 5, 6, 12, 10, -1, 0 };
+    for (std::size_t i = 0; i < enumerators.size(); ++i) {
+        auto val = enumerators[i]->asEnumeratorDeclaration()->value();
+        PSY_EXPECT_TRUE(val.isKnown());
+        PSY_EXPECT_EQ_ENU(val.basicTypeKind(), BasicTypeKind::Int_S, BasicTypeKind);
+        PSY_EXPECT_EQ_INT(val.asSigned(), expected[i]);
+    }
+}
+
+void SemanticModelTester::case0509()
+{
+    auto [exprNodeByText, semaModel] =
+            compileTestTypes("enum { n = 4 } ;"
+                             "int a [ n * 2 + 1 ] ;"
+                             "int b [ ( 1 << 3 ) | 1 ] ;"
+                             "int c [ 1 ? 2 : 3 ] ;"
+                             "int d [ sizeof ( int ) ] ;"
+                             "int x [ ( unsigned char ) 300 ] ;"
+                             "int y [ - 1u > 0 ] ;");
+
+    auto val = semaModel->constantValueOf(exprNodeByText["n * 2 + 1"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 9);
+    val = semaModel->constantValueOf(exprNodeByText["- 1u"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_ENU(val.basicTypeKind(), BasicTypeKind::Int_U, BasicTypeKind);
+    PSY_EXPECT_TRUE(val.asUnsigned() == 4294967295ULL);
+
+    auto sizeOf = [semaModel = semaModel] (const char* name) {
+        auto decl = semaModel->searchForDeclaration(
+            [name] (const DeclarationSymbol* decl) {
+                return decl->kind() == SymbolKind::VariableDeclaration
+                    && decl->asVariableDeclaration()->name()->valueText() == name;
+            });
+        PSY_EXPECT_TRUE(decl);
+        auto ty = decl->asVariableDeclaration()->type();
+        PSY_EXPECT_EQ_ENU(ty->kind(), TypeKind::Array, TypeKind);
+        return ty->asArrayType();
+    };
+    PSY_EXPECT_TRUE(sizeOf("a")->hasKnownSize());
+    PSY_EXPECT_EQ_INT(sizeOf("a")->size(), 9);
+    PSY_EXPECT_EQ_INT(sizeOf("b")->size(), 9);
+    PSY_EXPECT_EQ_INT(sizeOf("c")->size(), 2);
+    PSY_EXPECT_EQ_INT(sizeOf("d")->size(), 4);
+    PSY_EXPECT_EQ_INT(sizeOf("x")->size(), 44);
+    PSY_EXPECT_EQ_INT(sizeOf("y")->size(), 1);
+}
+
+void SemanticModelTester::case0510()
+{
+    PlatformOptions platformOpts;
+    platformOpts.setDataModel(PlatformOptions::DataModel::LP64);
+    auto [exprNodeByText, semaModel] =
+            compileTestTypes("struct s { char c ; int i ; double d ; } ;"
+                             "struct t { char c ; struct s s ; short h [ 3 ] ; } ;"
+                             "union u { char c [ 5 ] ; int i ; } ;"
+                             "struct f { int n ; double d [ ] ; } ;"
+                             "int x1 [ sizeof ( struct s ) ] ;"
+                             "int x2 [ _Alignof ( struct s ) ] ;"
+                             "int x3 [ sizeof ( struct t ) ] ;"
+                             "int x4 [ __builtin_offsetof ( struct t , h [ 1 ] ) ] ;"
+                             "int x5 [ __builtin_offsetof ( struct t , s . d ) ] ;"
+                             "int x6 [ sizeof ( union u ) ] ;"
+                             "int x7 [ sizeof ( struct f ) ] ;"
+                             "int x8 [ sizeof ( long double ) + sizeof ( void * ) ] ;",
+                             platformOpts);
+
+    auto expectValue = [&exprNodeByText = exprNodeByText, semaModel = semaModel]
+            (const char* exprText, long long v) {
+        auto val = semaModel->constantValueOf(exprNodeByText[exprText]);
+        PSY_EXPECT_TRUE(val.isKnown());
+        PSY_EXPECT_EQ_INT(val.asSigned(), v);
+    };
+    expectValue("sizeof ( struct s )", 16);
+    expectValue("_Alignof ( struct s )", 8);
+    expectValue("sizeof ( struct t )", 32);
+    expectValue("__builtin_offsetof ( struct t , h [ 1 ] )", 26);
+    expectValue("__builtin_offsetof ( struct t , s . d )", 16);
+    expectValue("sizeof ( union u )", 8);
+    expectValue("sizeof ( struct f )", 8);
+    expectValue("sizeof ( long double ) + sizeof ( void * )", 24);
+}
+
+void SemanticModelTester::case0511()
+{
+    PlatformOptions platformOpts;
+    platformOpts.setDataModel(PlatformOptions::DataModel::ILP32);
+    auto [exprNodeByText, semaModel] =
+            compileTestTypes("struct s { char c ; long long l ; double d ; long double x ; void * p ; long n ; } ;"
+                             "int x1 [ sizeof ( struct s ) ] ;"
+                             "int x2 [ __builtin_offsetof ( struct s , x ) ] ;"
+                             "int x3 [ sizeof ( long ) ] ;",
+                             platformOpts);
+
+    auto val = semaModel->constantValueOf(exprNodeByText["sizeof ( struct s )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 40);
+    val = semaModel->constantValueOf(exprNodeByText["__builtin_offsetof ( struct s , x )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 20);
+    val = semaModel->constantValueOf(exprNodeByText["sizeof ( long )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 4);
+}
+
+void SemanticModelTester::case0512()
+{
+    PlatformOptions platformOpts;
+    platformOpts.setDataModel(PlatformOptions::DataModel::LP64);
+    auto [exprNodeByText, semaModel] =
+            compileTestTypes("enum { w = 30 } ;"
+                             "struct b { unsigned a : 3 ; unsigned b : w ; unsigned : 0 ; char c ; } ;"
+                             "struct a { char c ; struct { short h ; int i ; } ; } ;"
+                             "int x1 [ sizeof ( struct b ) ] ;"
+                             "int x2 [ __builtin_offsetof ( struct a , i ) ] ;",
+                             platformOpts);
+
+    auto val = semaModel->constantValueOf(exprNodeByText["sizeof ( struct b )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 12);
+    val = semaModel->constantValueOf(exprNodeByText["__builtin_offsetof ( struct a , i )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 8);
+
+    auto fieldNamed = [semaModel = semaModel] (const char* name) {
+        auto decl = semaModel->searchForDeclaration(
+            [name] (const DeclarationSymbol* decl) {
+                return decl->kind() == SymbolKind::FieldDeclaration
+                    && decl->asFieldDeclaration()->name()->valueText() == name;
+            });
+        PSY_EXPECT_TRUE(decl);
+        return decl->asFieldDeclaration();
+    };
+    auto fld = fieldNamed("b");
+    PSY_EXPECT_TRUE(fld->isBitField());
+    PSY_EXPECT_EQ_INT(fld->bitWidth().asSigned(), 30);
+    auto fldLayout = compilation_->layoutOf(fld);
+    PSY_EXPECT_TRUE(fldLayout.isKnown());
+    PSY_EXPECT_EQ_INT(fldLayout.offsetInBits(), 32);
+    fldLayout = compilation_->layoutOf(fieldNamed("c"));
+    PSY_EXPECT_EQ_INT(fldLayout.offset(), 8);
+    PSY_EXPECT_FALSE(fieldNamed("h")->isBitField());
+}
+
+void SemanticModelTester::case0513()
+{
+    compileTestTypes("int count_items ;"
+                     "struct counter { int x ; } ;"
+                     "typedef int counter ;"
+                     "void cnt ( ) ;");
+    const auto& symIdx = compilation_->symbolIndex();
+
+    auto decls = symIdx.declarationsNamed("counter");
+    PSY_EXPECT_EQ_INT(decls.size(), 2);
+    decls = symIdx.declarationsNamed("counter", NameSpace::Tags);
+    PSY_EXPECT_EQ_INT(decls.size(), 1);
+    PSY_EXPECT_EQ_ENU(decls[0]->kind(), SymbolKind::StructDeclaration, SymbolKind);
+    decls = symIdx.declarationsNamed("counter", SymbolKind::TypedefDeclaration);
+    PSY_EXPECT_EQ_INT(decls.size(), 1);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsNamed("count").size(), 0);
+
+    decls = symIdx.declarationsWithNamePrefix("coun");
+    PSY_EXPECT_EQ_INT(decls.size(), 3);
+    PSY_EXPECT_EQ_ENU(decls[0]->kind(), SymbolKind::VariableDeclaration, SymbolKind);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsWithNamePrefix("coun", 1).size(), 1);
+
+    decls = symIdx.declarationsMatching("CNT");
+    PSY_EXPECT_EQ_INT(decls.size(), 4);
+    PSY_EXPECT_EQ_ENU(decls[0]->kind(), SymbolKind::FunctionDeclaration, SymbolKind);
+    PSY_EXPECT_EQ_ENU(decls[3]->kind(), SymbolKind::VariableDeclaration, SymbolKind);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsMatching("cnx").size(), 0);
+}
+
+void SemanticModelTester::case0514()
+{
+    PlatformOptions platformOpts;
+    platformOpts.setDataModel(PlatformOptions::DataModel::LP64);
+    auto [exprNodeByText, semaModel] =
+            compileTestTypes("int n ;"
+                             "typedef double d_t [ ] ;"
+                             "struct f { int k ; const d_t d ; } ;"
+                             "struct g { int k ; int a [ n ] ; } ;"
+                             "int x1 [ sizeof ( struct f ) ] ;"
+                             "int x2 [ sizeof ( struct g ) ] ;",
+                             platformOpts);
+
+    auto val = semaModel->constantValueOf(exprNodeByText["sizeof ( struct f )"]);
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 8);
+
+    // The trailing array has a size, though not a known one.
+    val = semaModel->constantValueOf(exprNodeByText["sizeof ( struct g )"]);
+    PSY_EXPECT_FALSE(val.isKnown());
+}
+
+void SemanticModelTester::case0900()
+{
+    auto s = "int x ; double * y ;";
+    compileTestSymbols<VariableAndOrFunctionDeclarationSyntax>(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto semaModel = compilation->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto TU = tree->translationUnitRoot();
+    auto varAndOrFunDeclNode = TU->declarations()->value->asVariableAndOrFunctionDeclaration();
+    PSY_EXPECT_TRUE(varAndOrFunDeclNode);
+    auto syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    auto varDecl = syms[0]->asVariableDeclaration();
+    PSY_EXPECT_TRUE(varDecl);
+    PSY_EXPECT_EQ_STR(varDecl->name()->valueText(), "x");
+    PSY_EXPECT_EQ_ENU(varDecl->type()->kind(), TypeKind::Basic, TypeKind);
+    PSY_EXPECT_EQ_ENU(varDecl->type()->asBasicType()->kind(), BasicTypeKind::Int_S, BasicTypeKind);
+    PSY_EXPECT_EQ_ENU(varDecl->enclosingScope()->kind(), ScopeKind::File, ScopeKind);
+
+    varAndOrFunDeclNode = TU->declarations()->next->value->asVariableAndOrFunctionDeclaration();
+    PSY_EXPECT_TRUE(varAndOrFunDeclNode);
+    syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    varDecl = syms[0]->asVariableDeclaration();
+    PSY_EXPECT_TRUE(varDecl);
+    PSY_EXPECT_EQ_STR(varDecl->name()->valueText(), "y");
+    PSY_EXPECT_EQ_ENU(varDecl->type()->kind(), TypeKind::Pointer, TypeKind);
+    auto refedTy = varDecl->type()->asPointerType()->referencedType();
+    PSY_EXPECT_EQ_ENU(refedTy->kind(), TypeKind::Basic, TypeKind);
+    PSY_EXPECT_EQ_ENU(refedTy->asBasicType()->kind(), BasicTypeKind::Double, BasicTypeKind);
+}
+
+void SemanticModelTester::case0901()
+{
+    auto s = "struct x { int y ; struct { double z ; } ; } ; typedef struct x w ;";
+    compileTestSymbols<StructOrUnionDeclarationSyntax>(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto semaModel = compilation->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto TU = tree->translationUnitRoot();
+    auto strukt = semaModel->structFor(
+                TU->declarations()->value->asTypeDeclaration()->asStructOrUnionDeclaration());
+    PSY_EXPECT_TRUE(strukt);
+    PSY_EXPECT_EQ_STR(strukt->introducedNewType()->tag()->valueText(), "x");
+    PSY_EXPECT_TRUE(strukt->introducedNewType()->declaration() == strukt);
+    PSY_EXPECT_EQ_INT(strukt->fields().size(), 2);
+    PSY_EXPECT_EQ_STR(strukt->fields()[0]->name()->valueText(), "y");
+    PSY_EXPECT_TRUE(strukt->fields()[1]->isAnonymousStructureOrUnion());
+
+    auto anonTagTyDecl = strukt->fields()[1]->type()->asTagType()->declaration();
+    PSY_EXPECT_TRUE(anonTagTyDecl);
+    auto innerFlds = anonTagTyDecl->asStructOrUnionDeclaration()->fields();
+    PSY_EXPECT_EQ_INT(innerFlds.size(), 1);
+    PSY_EXPECT_TRUE(strukt->member(innerFlds[0]->name()) == innerFlds[0]);
+
+    auto tydef = semaModel->searchForDeclaration(
+                [] (const DeclarationSymbol* decl) {
+                    return decl->kind() == SymbolKind::TypedefDeclaration;
+                });
+    PSY_EXPECT_TRUE(tydef);
+    PSY_EXPECT_EQ_ENU(tydef->kind(), SymbolKind::TypedefDeclaration, SymbolKind);
+    PSY_EXPECT_TRUE(tydef->asTypeDeclaration()->asTypedefDeclaration()->synonymizedType()
+                        == strukt->introducedNewType());
+    auto name = tydef->asTypeDeclaration()->asTypedefDeclaration()
+                    ->introducedSynonymType()->typedefName();
+    PSY_EXPECT_TRUE(strukt->enclosingScope()->searchForDeclaration(
+                        name, NameSpace::OrdinaryIdentifiers) == tydef);
+}
+
+void SemanticModelTester::case0902()
+{
+    auto s = "void f() { double x; x = 1 + 1.0; }";
+    compileTestTypes(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto semaModel = compilation->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    ExpressionCollector v(tree);
+    v.visit(tree->translationUnitRoot());
+
+    auto exprNode = v.m["x = 1 + 1.0"];
+    PSY_EXPECT_TRUE(exprNode);
+    auto ty = semaModel->typeInfoOf(exprNode).type();
+    PSY_EXPECT_TRUE(ty);
+    PSY_EXPECT_EQ_ENU(ty->kind(), TypeKind::Basic, TypeKind);
+    PSY_EXPECT_EQ_ENU(ty->asBasicType()->kind(), BasicTypeKind::Double, BasicTypeKind);
+    PSY_EXPECT_TRUE(ty == compilation->canonicalBasicType(BasicTypeKind::Double));
+
+    exprNode = v.m["x"];
+    PSY_EXPECT_TRUE(exprNode);
+    auto scope = semaModel->scopeOf(exprNode->asIdentifierName());
+    PSY_EXPECT_TRUE(scope);
+    PSY_EXPECT_EQ_ENU(scope->kind(), ScopeKind::Block, ScopeKind);
+}
+
+void SemanticModelTester::case0903()
+{
+    compileTestSymbols<VariableAndOrFunctionDeclarationSyntax>("int x ;");
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    restoredTree_ = SyntaxTree::parseText(SourceText("int y ;"),
+                                          TextPreprocessingState::Preprocessed,
+                                          TextCompleteness::Fragment,
+                                          ParseOptions(),
+                                          "<test>");
+    restoredCompilation_ = Compilation::create(restoredTree_->filePath());
+    restoredCompilation_->addSyntaxTrees({ restoredTree_.get() });
+    PSY_EXPECT_FALSE(restoredCompilation_->restoreSemanticModel(restoredTree_.get(), snapshot));
+    PSY_EXPECT_FALSE(restoredCompilation_->restoreSemanticModel(restoredTree_.get(), "garbage"));
+}
+
+void SemanticModelTester::case0904()
+{
+    auto s = "int x ;";
+    compileTestSymbols<VariableAndOrFunctionDeclarationSyntax>(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+    PSY_EXPECT_FALSE(compilation_->restoreSemanticModel(tree_.get(), snapshot));
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    PSY_EXPECT_EQ_INT(compilation->snapshotSemanticModel(tree).size(), snapshot.size());
+}
+
+void SemanticModelTester::case0905()
+{
+    auto s = "enum e { a = 3 , b } ; int x [ b * 2 ] ;";
+    compileTestTypes(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto semaModel = compilation->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto TU = tree->translationUnitRoot();
+    auto enumDecl = semaModel->enumFor(
+                TU->declarations()->value->asTypeDeclaration()->asEnumDeclaration());
+    PSY_EXPECT_TRUE(enumDecl);
+    PSY_EXPECT_EQ_INT(enumDecl->members().size(), 2);
+    PSY_EXPECT_EQ_INT(enumDecl->members()[1]->asEnumeratorDeclaration()->value().asSigned(), 4);
+
+    auto varAndOrFunDeclNode = TU->declarations()->next->value->asVariableAndOrFunctionDeclaration();
+    auto syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    auto arrTy = syms[0]->asVariableDeclaration()->type()->asArrayType();
+    PSY_EXPECT_TRUE(arrTy);
+    PSY_EXPECT_TRUE(arrTy->hasKnownSize());
+    PSY_EXPECT_EQ_INT(arrTy->size(), 8);
+
+    auto decltor = varAndOrFunDeclNode->declarators()->value->asArrayOrFunctionDeclarator();
+    PSY_EXPECT_TRUE(decltor);
+    auto val = semaModel->constantValueOf(decltor->suffix()->asSubscriptSuffix()->expression());
+    PSY_EXPECT_TRUE(val.isKnown());
+    PSY_EXPECT_EQ_INT(val.asSigned(), 8);
+}
+
+void SemanticModelTester::case0906()
+{
+    auto s = "struct b { int a : 5 ; int : 0 ; int c : 4 ; } ;";
+    compileTestTypes(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto semaModel = compilation->computeSemanticModel(tree);
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto TU = tree->translationUnitRoot();
+    auto strukt = semaModel->structFor(
+                TU->declarations()->value->asTypeDeclaration()->asStructOrUnionDeclaration());
+    PSY_EXPECT_TRUE(strukt);
+    auto flds = strukt->fields();
+    PSY_EXPECT_EQ_INT(flds.size(), 3);
+    PSY_EXPECT_TRUE(flds[1]->isBitField());
+    PSY_EXPECT_TRUE(flds[1]->bitWidth().isZero());
+    auto tyLayout = compilation->layoutOf(strukt->introducedNewType());
+    PSY_EXPECT_TRUE(tyLayout.hasKnownSize());
+    PSY_EXPECT_EQ_INT(tyLayout.size(), 8);
+    PSY_EXPECT_EQ_INT(compilation->layoutOf(flds[2]).offsetInBits(), 32);
+}
+
+void SemanticModelTester::case0907()
+{
+    auto s = "enum e { a = 3 , b } ;"
+             "struct t { int f ; } ;"
+             "int x [ b * 2 ] ;"
+             "int g ( int p ) { struct t v ; return p + v . f ; }";
+    compileTestTypes(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    // Past the header (which is checked when the snapshot is opened),
+    // a malformed snapshot is discarded and the SemanticModel computed.
+    const std::string::size_type kHeaderSize = 24;
+    std::vector<std::string> malformed;
+    malformed.push_back(snapshot.substr(0, snapshot.size() - 1));
+    for (auto i = kHeaderSize; i < snapshot.size(); ++i) {
+        auto bad = snapshot;
+        bad[i] = static_cast<char>(0xff);
+        malformed.push_back(std::move(bad));
+    }
+    for (const auto& bad : malformed) {
+        auto [tree, compilation] = restoreTestSnapshot(s, bad);
+        auto semaModel = compilation->computeSemanticModel(tree);
+        PSY_EXPECT_TRUE(semaModel);
+    }
+
+    auto [tree, compilation] = restoreTestSnapshot(s, malformed.front());
+    auto semaModel = compilation->computeSemanticModel(tree);
+    auto TU = tree->translationUnitRoot();
+    auto varAndOrFunDeclNode =
+            TU->declarations()->next->next->value->asVariableAndOrFunctionDeclaration();
+    auto syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    auto arrTy = syms[0]->asVariableDeclaration()->type()->asArrayType();
+    PSY_EXPECT_TRUE(arrTy);
+    PSY_EXPECT_EQ_INT(arrTy->size(), 8);
+}
+
+void SemanticModelTester::case0908()
+{
+    // The typedef name `t' is undeclared: the type it names is null.
+    auto s = "t x ; int y ;";
+    compileTestTypes(s);
+    auto snapshot = compilation_->snapshotSemanticModel(tree_.get());
+
+    // The snapshot is restored directly: a malformed one would otherwise
+    // go unnoticed, with the SemanticModel computed instead.
+    auto [tree, compilation] = restoreTestSnapshot(s, snapshot);
+    auto openSnapshot = SemanticModelSnapshot::open(tree, snapshot);
+    PSY_EXPECT_TRUE(openSnapshot);
+    SemanticModel semaModel(tree, compilation);
+    PSY_EXPECT_TRUE(openSnapshot->restoreDeclarations(&semaModel));
+    openSnapshot->restoreSideTables(&semaModel);
+
+    auto TU = tree->translationUnitRoot();
+    auto varAndOrFunDeclNode = TU->declarations()->value->asVariableAndOrFunctionDeclaration();
+    auto syms = semaModel.variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    PSY_EXPECT_EQ_STR(syms[0]->asVariableDeclaration()->name()->valueText(), "x");
+
+    varAndOrFunDeclNode = TU->declarations()->next->value->asVariableAndOrFunctionDeclaration();
+    syms = semaModel.variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    auto varDecl = syms[0]->asVariableDeclaration();
+    PSY_EXPECT_EQ_STR(varDecl->name()->valueText(), "y");
+    PSY_EXPECT_EQ_ENU(varDecl->type()->kind(), TypeKind::Basic, TypeKind);
+    PSY_EXPECT_EQ_ENU(varDecl->type()->asBasicType()->kind(), BasicTypeKind::Int_S, BasicTypeKind);
+}
+
+void SemanticModelTester::case0950()
+{
+    auto prelude = "typedef int x ; struct y { double z ; } ;";
+    auto [tree, semaModel] = compileTestPreluded("x w ; struct y v ;", prelude);
+
+    auto TU = tree->translationUnitRoot();
+    auto varAndOrFunDeclNode = TU->declarations()->value->asVariableAndOrFunctionDeclaration();
+    PSY_EXPECT_TRUE(varAndOrFunDeclNode);
+    auto syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    auto varDecl = syms[0]->asVariableDeclaration();
+    PSY_EXPECT_TRUE(varDecl);
+    PSY_EXPECT_EQ_STR(varDecl->name()->valueText(), "w");
+    PSY_EXPECT_EQ_ENU(varDecl->type()->kind(), TypeKind::TypedefName, TypeKind);
+    auto tydef = varDecl->type()->asTypedefNameType()->declaration();
+    PSY_EXPECT_TRUE(tydef);
+    PSY_EXPECT_EQ_ENU(tydef->synonymizedType()->kind(), TypeKind::Basic, TypeKind);
+
+    auto preludeSemaModel = compilation_->computeSemanticModel(tree_.get());
+    PSY_EXPECT_TRUE(tydef == preludeSemaModel->searchForDeclaration(
+                        [] (const DeclarationSymbol* decl) {
+                            return decl->kind() == SymbolKind::TypedefDeclaration;
+                        }));
+
+    varAndOrFunDeclNode = TU->declarations()->next->value->asVariableAndOrFunctionDeclaration();
+    PSY_EXPECT_TRUE(varAndOrFunDeclNode);
+    syms = semaModel->variablesAndOrFunctionsFor(varAndOrFunDeclNode);
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    varDecl = syms[0]->asVariableDeclaration();
+    PSY_EXPECT_TRUE(varDecl);
+    PSY_EXPECT_EQ_ENU(varDecl->type()->kind(), TypeKind::Tag, TypeKind);
+    auto tagTyDecl = varDecl->type()->asTagType()->declaration();
+    PSY_EXPECT_TRUE(tagTyDecl);
+    PSY_EXPECT_TRUE(tagTyDecl->enclosingScope()->outerScope() == nullptr);
+    PSY_EXPECT_TRUE(varDecl->enclosingScope()->outerScope() == tagTyDecl->enclosingScope());
+}
+
+void SemanticModelTester::case0951()
+{
+    auto prelude = "struct x { double y ; } ; int z ;";
+    auto [tree, semaModel] =
+            compileTestPreluded("void f ( ) { struct x w ; w . y ; z ; }", prelude);
+
+    ExpressionCollector v(tree);
+    v.visit(tree->translationUnitRoot());
+
+    auto exprNode = v.m["w . y"];
+    PSY_EXPECT_TRUE(exprNode);
+    auto ty = semaModel->typeInfoOf(exprNode).type();
+    PSY_EXPECT_TRUE(ty);
+    PSY_EXPECT_TRUE(ty == compilation_->canonicalBasicType(BasicTypeKind::Double));
+
+    exprNode = v.m["z"];
+    PSY_EXPECT_TRUE(exprNode);
+    ty = semaModel->typeInfoOf(exprNode).type();
+    PSY_EXPECT_TRUE(ty);
+    PSY_EXPECT_TRUE(ty == compilation_->canonicalBasicType(BasicTypeKind::Int_S));
+}
+
+void SemanticModelTester::case0952()
+{
+    auto prelude = "typedef unsigned long size_t ;";
+    auto [tree, semaModel] = compileTestPreluded("int x ;", prelude);
+
+    PSY_EXPECT_TRUE(semaModel->size_t_typedef());
+    PSY_EXPECT_TRUE(semaModel->size_t_typedef()
+                        == compilation_->computeSemanticModel(tree_.get())->size_t_typedef());
+}
+
+void SemanticModelTester::case0953()
+{
+    auto prelude = "typedef int x ;";
+    auto [tree1, semaModel1] = compileTestPreluded("x y ;", prelude);
+    auto [tree2, semaModel2] = compileTestPreluded("double x ;", prelude);
+
+    auto TU = tree1->translationUnitRoot();
+    auto syms = semaModel1->variablesAndOrFunctionsFor(
+                TU->declarations()->value->asVariableAndOrFunctionDeclaration());
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    PSY_EXPECT_TRUE(syms[0]->asVariableDeclaration()->type()->asTypedefNameType()->declaration());
+
+    // A declaration of a SyntaxTree hides that of the prelude.
+    TU = tree2->translationUnitRoot();
+    syms = semaModel2->variablesAndOrFunctionsFor(
+                TU->declarations()->value->asVariableAndOrFunctionDeclaration());
+    PSY_EXPECT_EQ_INT(syms.size(), 1);
+    PSY_EXPECT_EQ_ENU(syms[0]->asVariableDeclaration()->type()->kind(), TypeKind::Basic, TypeKind);
+
+    compilation_->removeSyntaxTree(tree1);
+    PSY_EXPECT_EQ_INT(compilation_->syntaxTrees().size(), 2);
+}
+
+void SemanticModelTester::case0954()
+{
+    auto prelude = "typedef int x ;";
+    auto [tree1, semaModel1] = compileTestPreluded("x y ;", prelude);
+    auto [tree2, semaModel2] = compileTestPreluded("double y ;", prelude);
+    PSY_EXPECT_TRUE(semaModel1 && semaModel2);
+
+    const auto& symIdx = compilation_->symbolIndex();
+    PSY_EXPECT_EQ_INT(symIdx.declarationsNamed("x").size(), 1);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsNamed("y").size(), 2);
+
+    compilation_->removeSyntaxTree(tree1);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsNamed("x").size(), 1);
+    PSY_EXPECT_EQ_INT(symIdx.declarationsNamed("y").size(), 1);
+}
+
+void SemanticModelTester::case0955()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree1, semaModel1] = compileTestPreluded(
+                "static int a ;"
+                "int b ;"
+                "extern int c ;"
+                "int f ( void ) ;"
+                "static void g ( ) { extern int a ; int l ; }",
+                prelude);
+    auto [tree2, semaModel2] = compileTestPreluded(
+                "int b = 1 ;"
+                "int c = 2 ;"
+                "int f ( void ) { return 0 ; }"
+                "static int a ;",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel1 && semaModel2);
+    auto diags = tree2->diagnostics();
+    PSY_EXPECT_EQ_INT(diags.size(), 1);
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(),
+                      UnusedDeclarationChecker::DiagnosticsReporter::ID_of_UnusedStaticDeclaration);
+
+    auto prog = static_cast<const Compilation*>(compilation_.get())->program();
+    PSY_EXPECT_EQ_INT(prog->externalDeclarationsNamed("a").size(), 0);
+    PSY_EXPECT_EQ_INT(prog->externalDeclarationsNamed("g").size(), 0);
+    PSY_EXPECT_EQ_INT(prog->externalDeclarationsNamed("l").size(), 0);
+    for (const char* name : { "b", "c", "f" }) {
+        auto decls = prog->externalDeclarationsNamed(name);
+        PSY_EXPECT_EQ_INT(decls.size(), 2);
+        PSY_EXPECT_TRUE(prog->externalDefinitionNamed(name) == decls[1]);
+        PSY_EXPECT_EQ_ENU(decls[0]->linkage(), Linkage::External, Linkage);
+    }
+
+    const auto& symIdx = compilation_->symbolIndex();
+    auto decls = symIdx.declarationsNamed("a");
+    PSY_EXPECT_EQ_INT(decls.size(), 3);
+    for (auto decl : decls)
+        PSY_EXPECT_EQ_ENU(decl->linkage(), Linkage::Internal, Linkage);
+    decls = symIdx.declarationsNamed("l");
+    PSY_EXPECT_EQ_INT(decls.size(), 1);
+    PSY_EXPECT_EQ_ENU(decls[0]->linkage(), Linkage::None, Linkage);
+    decls = symIdx.declarationsNamed("t");
+    PSY_EXPECT_EQ_INT(decls.size(), 1);
+    PSY_EXPECT_EQ_ENU(decls[0]->linkage(), Linkage::None, Linkage);
+
+    // Once a SyntaxTree is removed, so are its external declarations.
+    compilation_->removeSyntaxTree(tree2);
+    PSY_EXPECT_EQ_INT(prog->externalDeclarationsNamed("b").size(), 1);
+    PSY_EXPECT_TRUE(prog->externalDefinitionNamed("b") == prog->externalDeclarationsNamed("b")[0]);
+    PSY_EXPECT_FALSE(prog->externalDefinitionNamed("c"));
+}
+
+void SemanticModelTester::case0956()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree1, semaModel1] = compileTestPreluded(
+                "int x = 1 ; double y ; int f ( int ) ; int g ( ) ;",
+                prelude);
+    auto [tree2, semaModel2] = compileTestPreluded(
+                "int x = 2 ; int y ; int f ( double ) ; int g ( int a ) { return a ; }",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel1 && semaModel2);
+    PSY_EXPECT_EQ_INT(tree1->diagnostics().size(), 0);
+
+    auto diags = tree2->diagnostics();
+    PSY_EXPECT_EQ_INT(diags.size(), 3);
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(),
+                      LinkageResolver::DiagnosticsReporter::ID_of_MultipleExternalDefinitions);
+    PSY_EXPECT_EQ_STR(diags[1].descriptor().id(),
+                      LinkageResolver::DiagnosticsReporter::ID_of_IncompatibleExternalDeclaration);
+    PSY_EXPECT_EQ_STR(diags[2].descriptor().id(),
+                      LinkageResolver::DiagnosticsReporter::ID_of_IncompatibleExternalDeclaration);
+}
+
+void SemanticModelTester::case0957()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree1, semaModel1] = compileTestPreluded(
+                "struct s { int a ; struct s * n ; } ; union u { int i ; } ; extern struct s v ;",
+                prelude);
+    auto [tree2, semaModel2] = compileTestPreluded(
+                "struct s { int a ; struct s * n ; } ; union u { double d ; } ; struct s v ;",
+                prelude);
+    auto [tree3, semaModel3] = compileTestPreluded(
+                "struct s { int b ; } ; struct s v ;",
+                prelude);
+
+    auto tagDeclOf = [] (const SyntaxTree* tree, const SemanticModel* semaModel, int idx) {
+        auto declIt = tree->translationUnitRoot()->declarations();
+        while (idx--)
+            declIt = declIt->next;
+        return semaModel->structOrUnionFor(
+                    declIt->value->asTypeDeclaration()->asStructOrUnionDeclaration());
+    };
+
+    auto prog = static_cast<const Compilation*>(compilation_.get())->program();
+    auto tagDecls = prog->compatibleTagDeclarations(tagDeclOf(tree1, semaModel1, 0));
+    PSY_EXPECT_EQ_INT(tagDecls.size(), 2);
+    PSY_EXPECT_TRUE(tagDecls[1] == tagDeclOf(tree2, semaModel2, 0));
+    PSY_EXPECT_EQ_INT(prog->compatibleTagDeclarations(tagDeclOf(tree3, semaModel3, 0)).size(), 1);
+    PSY_EXPECT_EQ_INT(prog->compatibleTagDeclarations(tagDeclOf(tree1, semaModel1, 1)).size(), 1);
+    PSY_EXPECT_EQ_INT(prog->compatibleTagDeclarations(tagDeclOf(tree2, semaModel2, 1)).size(), 1);
+
+    PSY_EXPECT_EQ_INT(tree2->diagnostics().size(), 0);
+    auto diags = tree3->diagnostics();
+    PSY_EXPECT_EQ_INT(diags.size(), 1);
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(),
+                      LinkageResolver::DiagnosticsReporter::ID_of_IncompatibleExternalDeclaration);
+}
+
+void SemanticModelTester::case0958()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree1, semaModel1] = compileTestPreluded(
+                "int h ( int ) ;"
+                "static int s ( void ) ;"
+                "int f ( void ) { return h ( 1 ) + s ( ) ; }"
+                "static int s ( void ) { return ( * f ) ( ) ; }",
+                prelude);
+    auto [tree2, semaModel2] = compileTestPreluded(
+                "int f ( void ) ;"
+                "int h ( int x ) { int ( * p ) ( void ) = f ; return p ( ) + h ( x - 1 ) ; }"
+                "int g ( void ) { return h ( 0 ) ; }",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel1 && semaModel2);
+
+    const auto& callGraph = compilation_->callGraph();
+    auto funcNamed = [&callGraph] (const char* name) -> const FunctionDeclarationSymbol* {
+        for (auto func : callGraph.functions()) {
+            if (func->name()->valueText() == name)
+                return func;
+        }
+        return nullptr;
+    };
+    PSY_EXPECT_EQ_INT(callGraph.functions().size(), 4);
+    auto f = funcNamed("f");
+    auto g = funcNamed("g");
+    auto h = funcNamed("h");
+    auto s = funcNamed("s");
+    PSY_EXPECT_TRUE(f && g && h && s);
+
+    auto funcs = callGraph.calleesOf(f);
+    PSY_EXPECT_EQ_INT(funcs.size(), 2);
+    PSY_EXPECT_TRUE(std::find(funcs.begin(), funcs.end(), h) != funcs.end());
+    PSY_EXPECT_TRUE(std::find(funcs.begin(), funcs.end(), s) != funcs.end());
+    funcs = callGraph.callersOf(h);
+    PSY_EXPECT_EQ_INT(funcs.size(), 3);
+    PSY_EXPECT_EQ_INT(callGraph.indirectCallCountOf(h), 1);
+    PSY_EXPECT_EQ_INT(callGraph.indirectCallCountOf(f), 0);
+    PSY_EXPECT_EQ_INT(callGraph.transitiveCallersOf(f).size(), 2);
+    PSY_EXPECT_EQ_INT(callGraph.transitiveCallersOf(g).size(), 0);
+
+    // Any declaration of a function with external linkage denotes the same node.
+    auto decls = compilation_->symbolIndex().declarationsNamed("f", SymbolKind::FunctionDeclaration);
+    PSY_EXPECT_EQ_INT(decls.size(), 2);
+    for (auto decl : decls)
+        PSY_EXPECT_EQ_INT(callGraph.calleesOf(decl->asFunctionDeclaration()).size(), 2);
+
+    compilation_->removeSyntaxTree(tree2);
+    PSY_EXPECT_EQ_INT(callGraph.functions().size(), 3);
+    PSY_EXPECT_FALSE(funcNamed("g"));
+    h = funcNamed("h");
+    PSY_EXPECT_TRUE(h);
+    PSY_EXPECT_EQ_INT(callGraph.callersOf(h).size(), 1);
+    PSY_EXPECT_EQ_INT(callGraph.indirectCallCountOf(h), 0);
+}
+
+void SemanticModelTester::case0959()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree, semaModel] = compileTestPreluded(
+                "struct s { int m ; } ;"
+                "static int a ;"
+                "int f ( int p ) { struct s v ; v . m = a + p ; return a + v . m ; }",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel);
+
+    const auto& symIdx = compilation_->symbolIndex();
+    auto refsTo = [&symIdx, semaModel = semaModel] (const char* name) {
+        auto decls = symIdx.declarationsNamed(name);
+        return decls.size() == 1
+                ? semaModel->referencesTo(decls[0])
+                : std::vector<SyntaxToken>();
+    };
+    for (auto [name, refCnt] : { std::make_pair("a", 2u),
+                                 std::make_pair("p", 1u),
+                                 std::make_pair("v", 2u),
+                                 std::make_pair("m", 2u) }) {
+        auto refs = refsTo(name);
+        PSY_EXPECT_EQ_INT(refs.size(), refCnt);
+        for (const auto& tk : refs)
+            PSY_EXPECT_EQ_STR(tk.valueText(), name);
+    }
+    PSY_EXPECT_EQ_INT(refsTo("f").size(), 0);
+    PSY_EXPECT_EQ_INT(refsTo("t").size(), 0);
+}
+
+void SemanticModelTester::case0960()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree, semaModel] = compileTestPreluded(
+                "static int a ;"
+                "static int b ;"
+                "static int c = 1 ;"
+                "static int g ( void ) ;"
+                "static int h ( void ) ;"
+                "static int h ( void ) { return h ( ) ; }"
+                "static int i ( void ) { return 0 ; }"
+                "int f ( int p ) { int x , y = b ; extern int c ; static int z ; return y + g ( ) ; }",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel);
+
+    auto diags = tree->diagnostics();
+    // Unused are the locals x and z, and the statics a, c, and i.
+    PSY_EXPECT_EQ_INT(diags.size(), 5);
+    const auto& localID = UnusedDeclarationChecker::DiagnosticsReporter::ID_of_UnusedLocalVariable;
+    const auto& staticID = UnusedDeclarationChecker::DiagnosticsReporter::ID_of_UnusedStaticDeclaration;
+    PSY_EXPECT_EQ_STR(diags[0].descriptor().id(), localID);
+    PSY_EXPECT_EQ_STR(diags[1].descriptor().id(), localID);
+    PSY_EXPECT_EQ_STR(diags[2].descriptor().id(), staticID);
+    PSY_EXPECT_EQ_STR(diags[3].descriptor().id(), staticID);
+    PSY_EXPECT_EQ_STR(diags[4].descriptor().id(), staticID);
+    for (const auto& diag : diags)
+        PSY_EXPECT_EQ_ENU(diag.severity(), DiagnosticSeverity::Warning, DiagnosticSeverity);
+}
+
+void SemanticModelTester::case0961()
+{
+    auto prelude = "typedef int t ;";
+    auto [tree, semaModel] = compileTestPreluded(
+                "int f ( int * p , int q ) {"
+                "    int a = 1 , z = 2 ;"
+                "    int s = sizeof ( int [ q ] ) ;"
+                "    int * r = ( int [ ] ) { z } ;"
+                "    void * v = ( int ( * ) [ q ] ) p ;"
+                "    return ( int ) a + s + * r + ( v != 0 ) ;"
+                "}",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel);
+    PSY_EXPECT_EQ_INT(tree->diagnostics().size(), 0);
+
+    const auto& symIdx = compilation_->symbolIndex();
+    for (auto [name, refCnt] : { std::make_pair("a", 1u),
+                                 std::make_pair("z", 1u),
+                                 std::make_pair("q", 2u),
+                                 std::make_pair("p", 1u) }) {
+        auto decls = symIdx.declarationsNamed(name);
+        PSY_EXPECT_EQ_INT(decls.size(), 1);
+        PSY_EXPECT_EQ_INT(semaModel->referencesTo(decls[0]).size(), refCnt);
+    }
+}
+
+void SemanticModelTester::case0962()
+{
+    auto prelude = "typedef long unsigned int size_t ;";
+    auto [tree, semaModel] = compileTestPreluded(
+                "void g ( unsigned long n ) ;"
+                "void f ( int y ) {"
+                "    size_t z = 1 ;"
+                "    g ( z ) ;"
+                "    g ( ( size_t ) - y ) ;"
+                "}",
+                prelude);
+    PSY_EXPECT_TRUE(semaModel);
+    PSY_EXPECT_EQ_INT(tree->diagnostics().size(), 0);
+}
+
+void SemanticModelTester::case0963()
+{
+    // Without a declaration of `x', `( x ) - y' stays ambiguous; only
+    // the ambiguity is diagnosed, not an argument type mismatch.
+    ParseOptions parseOpts;
+    parseOpts.setAmbiguityMode(ParseOptions::AmbiguityMode::DisambiguateAlgorithmically);
+    tree_ = SyntaxTree::parseText(SourceText("void g ( int n ) ;"
+                                             "void f ( int y ) { g ( ( x ) - y ) ; }"),
+                                  TextPreprocessingState::Preprocessed,
+                                  TextCompleteness::Fragment,
+                                  parseOpts,
+                                  "<test>");
+    compilation_ = Compilation::create(tree_->filePath());
+    compilation_->addSyntaxTrees({ tree_.get() });
+    auto semaModel = compilation_->computeSemanticModel(tree_.get());
+    PSY_EXPECT_TRUE(semaModel);
+    PSY_EXPECT_EQ_INT(tree_->diagnostics().size(), 1);
+    PSY_EXPECT_TRUE(isDiagnosticDescriptorIdOfSyntaxAmbiguity(
+                        tree_->diagnostics()[0].descriptor().id()));
+}
+
+void SemanticModelTester::case0964()
+{
+    // Calls to names that aren't declared are unresolved calls, not indirect ones.
+    auto [tree, semaModel] = compileTestPreluded(
+                "int f ( int ( * p ) ( void ) ) { return v ( ) + u ( 1 ) + u ( 2 ) + ( * w ) ( ) + g ( ) + p ( ) ; }"
+                "int g ( void ) { return 0 ; }",
+                "int g ( void ) ;");
+    PSY_EXPECT_TRUE(semaModel);
+
+    const auto& callGraph = compilation_->callGraph();
+    auto funcs = callGraph.functions();
+    PSY_EXPECT_EQ_INT(funcs.size(), 2);
+    auto f = funcs[0]->name()->valueText() == "f" ? funcs[0] : funcs[1];
+    PSY_EXPECT_EQ_STR(f->name()->valueText(), "f");
+
+    PSY_EXPECT_EQ_INT(callGraph.calleesOf(f).size(), 1);
+    PSY_EXPECT_EQ_INT(callGraph.indirectCallCountOf(f), 1);
+    auto names = callGraph.unresolvedCalleesOf(f);
+    PSY_EXPECT_EQ_INT(names.size(), 3);
+    PSY_EXPECT_EQ_STR(names[0], "u");
+    PSY_EXPECT_EQ_STR(names[1], "v");
+    PSY_EXPECT_EQ_STR(names[2], "w");
+
+    compilation_->removeSyntaxTree(tree);
+    PSY_EXPECT_TRUE(callGraph.functions().empty());
+}
+
+void SemanticModelTester::case1000()
+{
+    auto decls = compileTestInferred("void f ( ) { int x ; x = y ; }");
+
+    PSY_EXPECT_EQ_STR(decls, "int y;\n");
+}
+
+void SemanticModelTester::case1001()
+{
+    auto decls = compileTestInferred("void f ( ) { double x ; x = g ( 1 ) ; }");
+
+    PSY_EXPECT_EQ_STR(decls, "double g(int);\n");
+}
+
+void SemanticModelTester::case1002()
+{
+    auto decls = compileTestInferred("void f ( T * p ) { p -> x = 1 ; }");
+
+    PSY_EXPECT_EQ_STR(decls,
+                      "struct T;\n"
+                      "typedef struct T T;\n"
+                      "struct T\n"
+                      "{\n"
+                      "    int x;\n"
+                      "};\n");
+}
+
+void SemanticModelTester::case1003()
+{
+    auto decls = compileTestInferred("void f ( ) { char * s ; s = p ; * p = 'a' ; }");
+
+    PSY_EXPECT_EQ_STR(decls, "char *p;\n");
+}
+
+void SemanticModelTester::case1004()
+{
+    auto decls = compileTestInferred("int f ( T x ) { return x + 1 ; }");
+
+    PSY_EXPECT_EQ_STR(decls, "typedef int T;\n");
+}
+
+void SemanticModelTester::case1005()
+{
+    // A pointer shape prevails over an arithmetic use.
+    auto decls = compileTestInferred("void f ( ) { if ( p == 0 ) return ; p -> n = p -> n + 1 ; }");
+
+    PSY_EXPECT_EQ_STR(decls,
+                      "struct psy_record_1;\n"
+                      "struct psy_record_1\n"
+                      "{\n"
+                      "    int n;\n"
+                      "};\n"
+                      "struct psy_record_1 *p;\n");
+}
+
+void SemanticModelTester::case1006()
+{
+    auto decls = compileTestInferred("int x ; void f ( ) { x = 1 ; }");
+
+    PSY_EXPECT_TRUE(decls.empty());
+}
+
+void SemanticModelTester::case1007()
+{
+    // A variable isn't bound to a term in which it occurs.
+    auto decls = compileTestInferred("void f ( ) { p = * p ; q = g ( q ) ; q -> n = p ; }");
+
+    PSY_EXPECT_EQ_STR(decls,
+                      "struct psy_record_1;\n"
+                      "struct psy_record_1\n"
+                      "{\n"
+                      "    int *n;\n"
+                      "};\n"
+                      "int *p;\n"
+                      "struct psy_record_1 *q;\n"
+                      "struct psy_record_1 *g(struct psy_record_1 *);\n");
+}
+
+void SemanticModelTester::case1050()
+{
+    auto lines = compileTestExported("int x ;");
+
+    PSY_EXPECT_TRUE(lines.find(
+        "{\"rec\":\"tree\",\"path\":\"<test>\"}\n"
+        "{\"rec\":\"node\",\"id\":1,\"parent\":null,\"kind\":\"TranslationUnit\"") == 0);
+    PSY_EXPECT_TRUE(lines.find(
+        "{\"rec\":\"decl\",\"id\":1,\"node\":4,\"kind\":\"VariableDeclaration\","
+        "\"category\":\"Object\",\"name\":\"x\",\"scope\":\"File\","
+        "\"type\":{\"kind\":\"Basic\",\"basic\":\"signed int\"}}\n") != std::string::npos);
+    PSY_EXPECT_TRUE(lines.find(
+        "{\"rec\":\"token\",\"parent\":4,\"kind\":\"<identifier>\",\"text\":\"x\",\"span\":[4,5]}\n")
+                    != std::string::npos);
+}
+
+void SemanticModelTester::case1051()
+{
+    auto lines = compileTestExported("void f ( ) { int * p ; p ; }");
+
+    PSY_EXPECT_TRUE(lines.find(
+        "\"kind\":\"IdentifierName\",\"span\":[23,24],"
+        "\"type\":{\"kind\":\"Pointer\",\"to\":{\"kind\":\"Basic\",\"basic\":\"signed int\"}},"
+        "\"scope\":\"Block\",\"decl\":2}\n") != std::string::npos);
+}
+
+void SemanticModelTester::case1052()
+{
+    auto lines = compileTestExported("struct s { const char * c ; } ;");
+
+    PSY_EXPECT_TRUE(lines.find(
+        "\"kind\":\"StructDeclaration\",\"category\":\"Type\",\"name\":\"s\",\"scope\":\"File\"}\n")
+                    != std::string::npos);
+    PSY_EXPECT_TRUE(lines.find(
+        "\"kind\":\"FieldDeclaration\",\"category\":\"Member\",\"name\":\"c\",\"scope\":\"File\","
+        "\"type\":{\"kind\":\"Pointer\",\"to\":{\"kind\":\"Qualified\",\"const\":true,"
+        "\"of\":{\"kind\":\"Basic\",\"basic\":\"char\"}}}}\n") != std::string::npos);
+}
+
+void SemanticModelTester::case1053()
+{
+    auto lines = compileTestExported("char * s = \"a\\\"b\\\\\" ;");
+
+    PSY_EXPECT_TRUE(lines.find(
+        "\"kind\":\"<string literal>\",\"text\":\"\\\"a\\\\\\\"b\\\\\\\\\\\"\"")
+                    != std::string::npos);
+}
+
+void SemanticModelTester::case1054()
+{
+    auto lines = compileTestExported("int f ( ) { return x ; } int x ;");
+
+    PSY_EXPECT_TRUE(lines.find(
+        "\"kind\":\"IdentifierName\",\"span\":[19,20],"
+        "\"type\":{\"kind\":\"Basic\",\"basic\":\"signed int\"},"
+        "\"scope\":\"Block\",\"decl\":2}\n") != std::string::npos);
+    PSY_EXPECT_TRUE(lines.find(
+        "{\"rec\":\"decl\",\"id\":2,\"node\":12,\"kind\":\"VariableDeclaration\","
+        "\"category\":\"Object\",\"name\":\"x\"") != std::string::npos);
+    PSY_EXPECT_TRUE(lines.find("\"node\":null") == std::string::npos);
+}
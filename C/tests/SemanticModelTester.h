@@ -50,6 +50,9 @@ public:
 
     std::unique_ptr<SyntaxTree> tree_;
     std::unique_ptr<Compilation> compilation_;
+    std::unique_ptr<SyntaxTree> restoredTree_;
+    std::unique_ptr<Compilation> restoredCompilation_;
+    std::vector<std::unique_ptr<SyntaxTree>> preludedTrees_;
 
     template <class DeclNodeT>
     std::tuple<const DeclNodeT*, const SemanticModel*>
@@ -59,7 +62,17 @@ public:
     std::tuple<
         std::unordered_map<std::string, const ExpressionSyntax*>,
         const SemanticModel*>
-    compileTestTypes(const std::string& srcText);
+    compileTestTypes(const std::string& srcText,
+                     PlatformOptions platformOpts = PlatformOptions());
+
+    std::tuple<const SyntaxTree*, Compilation*>
+    restoreTestSnapshot(const std::string& srcText, const std::string& snapshot);
+
+    std::tuple<const SyntaxTree*, const SemanticModel*>
+    compileTestPreluded(const std::string& srcText, const std::string& preludeSrcText);
+
+    std::string compileTestInferred(const std::string& srcText);
+    std::string compileTestExported(const std::string& srcText);
 
     void testSemanticModel();
 
@@ -75,7 +88,11 @@ public:
         + 0350-0399 -> field
         + 0400-0449 -> enum
         + 0450-0499 -> enumerator
-        + 0500-     -> expressions
+        + 0500-0899 -> expressions
+        + 0900-0949 -> snapshots
+        + 0950-0999 -> preludes
+        + 1000-1049 -> inference
+        + 1050-1099 -> export
      */
 
     void case0001();
@@ -355,6 +372,52 @@ public:
     void case0507();
     void case0508();
     void case0509();
+    void case0510();
+    void case0511();
+    void case0512();
+    void case0513();
+    void case0514();
+
+    void case0900();
+    void case0901();
+    void case0902();
+    void case0903();
+    void case0904();
+    void case0905();
+    void case0906();
+    void case0907();
+    void case0908();
+
+    void case0950();
+    void case0951();
+    void case0952();
+    void case0953();
+    void case0954();
+    void case0955();
+    void case0956();
+    void case0957();
+    void case0958();
+    void case0959();
+    void case0960();
+    void case0961();
+    void case0962();
+    void case0963();
+    void case0964();
+
+    void case1000();
+    void case1001();
+    void case1002();
+    void case1003();
+    void case1004();
+    void case1005();
+    void case1006();
+    void case1007();
+
+    void case1050();
+    void case1051();
+    void case1052();
+    void case1053();
+    void case1054();
 
     std::vector<TestFunction> tests_
     {
@@ -635,6 +698,52 @@ public:
         TEST_SEMANTIC_MODEL(case0507),
         TEST_SEMANTIC_MODEL(case0508),
         TEST_SEMANTIC_MODEL(case0509),
+        TEST_SEMANTIC_MODEL(case0510),
+        TEST_SEMANTIC_MODEL(case0511),
+        TEST_SEMANTIC_MODEL(case0512),
+        TEST_SEMANTIC_MODEL(case0513),
+        TEST_SEMANTIC_MODEL(case0514),
+
+        TEST_SEMANTIC_MODEL(case0900),
+        TEST_SEMANTIC_MODEL(case0901),
+        TEST_SEMANTIC_MODEL(case0902),
+        TEST_SEMANTIC_MODEL(case0903),
+        TEST_SEMANTIC_MODEL(case0904),
+        TEST_SEMANTIC_MODEL(case0905),
+        TEST_SEMANTIC_MODEL(case0906),
+        TEST_SEMANTIC_MODEL(case0907),
+        TEST_SEMANTIC_MODEL(case0908),
+
+        TEST_SEMANTIC_MODEL(case0950),
+        TEST_SEMANTIC_MODEL(case0951),
+        TEST_SEMANTIC_MODEL(case0952),
+        TEST_SEMANTIC_MODEL(case0953),
+        TEST_SEMANTIC_MODEL(case0954),
+        TEST_SEMANTIC_MODEL(case0955),
+        TEST_SEMANTIC_MODEL(case0956),
+        TEST_SEMANTIC_MODEL(case0957),
+        TEST_SEMANTIC_MODEL(case0958),
+        TEST_SEMANTIC_MODEL(case0959),
+        TEST_SEMANTIC_MODEL(case0960),
+        TEST_SEMANTIC_MODEL(case0961),
+        TEST_SEMANTIC_MODEL(case0962),
+        TEST_SEMANTIC_MODEL(case0963),
+        TEST_SEMANTIC_MODEL(case0964),
+
+        TEST_SEMANTIC_MODEL(case1000),
+        TEST_SEMANTIC_MODEL(case1001),
+        TEST_SEMANTIC_MODEL(case1002),
+        TEST_SEMANTIC_MODEL(case1003),
+        TEST_SEMANTIC_MODEL(case1004),
+        TEST_SEMANTIC_MODEL(case1005),
+        TEST_SEMANTIC_MODEL(case1006),
+        TEST_SEMANTIC_MODEL(case1007),
+
+        TEST_SEMANTIC_MODEL(case1050),
+        TEST_SEMANTIC_MODEL(case1051),
+        TEST_SEMANTIC_MODEL(case1052),
+        TEST_SEMANTIC_MODEL(case1053),
+        TEST_SEMANTIC_MODEL(case1054),
     };
 };
 
@@ -125,7 +125,9 @@ Decl& Decl::Member(std::string name, SymbolKind symK)
     declK_ = DeclarationCategory::Member;
     symK_ = symK;
     scopeK_ = ScopeKind::File;
-    ns_ = NameSpace::Members;
+    ns_ = symK == SymbolKind::EnumeratorDeclaration
+            ? NameSpace::OrdinaryIdentifiers
+            : NameSpace::Members;
     return *this;
 }
 
@@ -207,6 +209,12 @@ Expectation& Expectation::ambiguity(std::string s)
     return *this;
 }
 
+Expectation& Expectation::unparsedText(std::string s)
+{
+    unparsedText_ = std::move(s);
+    return *this;
+}
+
 Expectation& Expectation::declaration(Decl d)
 {
     declarations_.push_back(d);
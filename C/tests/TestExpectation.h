@@ -142,6 +142,9 @@ struct Expectation
     bool unfinishedParse_;
     Expectation& unfinishedParse();
 
+    std::string unparsedText_;
+    Expectation& unparsedText(std::string s);
+
     std::vector<SyntaxKind> syntaxKinds_;
     Expectation& AST(std::vector<SyntaxKind>&& v);
 
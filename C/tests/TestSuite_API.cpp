@@ -45,12 +45,3 @@ std::string APITestSuite::description() const
 {
     return "C API test suite";
 }
-
-void APITestSuite::printSummary() const
-{
-    for (auto const& tester : testers_) {
-        std::cout << "    " << tester->name() << std::endl
-                  << "        passed: " << tester->totalPassed() << std::endl
-                  << "        failed: " << tester->totalFailed() << std::endl;
-    }
-}
@@ -47,7 +47,6 @@ public:
 
     virtual std::tuple<int, int> testAll() override;
     virtual std::string description() const override;
-    virtual void printSummary() const override;
 
 private:
     std::vector<std::unique_ptr<Tester>> testers_;
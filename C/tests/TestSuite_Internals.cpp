@@ -99,15 +99,6 @@ std::string InternalsTestSuite::description() const
     return "C internals test suite";
 }
 
-void InternalsTestSuite::printSummary() const
-{
-    for (auto const& tester : testers_) {
-        std::cout << "    " << tester->name() << std::endl
-                  << "        passed: " << tester->totalPassed() << std::endl
-                  << "        failed: " << tester->totalFailed() << std::endl;
-    }
-}
-
 bool InternalsTestSuite::checkErrorAndWarn(Expectation X)
 {
     int E_cnt = 0;
@@ -133,25 +124,25 @@ bool InternalsTestSuite::checkErrorAndWarn(Expectation X)
     if (!tree_->diagnostics().empty()) {
         for (auto& diagnostic : tree_->diagnostics()) {
             diagnostic.outputIndent_ = 2;
-            std::cout << std::endl << diagnostic << std::endl;
+            TestShard::out() << std::endl << diagnostic << std::endl;
         }
-        std::cout << "\t";
+        TestShard::out() << "\t";
     }
 #endif
 
     if (X.numW_ != W_cnt || X.numE_ != E_cnt) {
 #ifdef DBG_DIAGNOSTICS
-        std::cout << "\n\t" << std::string(25, '%') << "\n\t";
+        TestShard::out() << "\n\t" << std::string(25, '%') << "\n\t";
 #endif
-        std::cout << "mismatch in ";
+        TestShard::out() << "mismatch in ";
         if (X.numW_ != W_cnt)
-            std::cout << "WARNING";
+            TestShard::out() << "WARNING";
         else
-            std::cout << "ERROR";
-        std::cout << " count";
+            TestShard::out() << "ERROR";
+        TestShard::out() << " count";
 
 #ifdef DBG_DIAGNOSTICS
-        std::cout << "\n\t" << std::string(25, '%');
+        TestShard::out() << "\n\t" << std::string(25, '%');
 #endif
     }
 
@@ -206,11 +197,11 @@ void InternalsTestSuite::parse(std::string source,
 
 #ifdef DBG_DIAGNOSTICS
     if (X.numW_ > 0 || X.numE_ > 0) {
-        std::cout << std::endl;
+        TestShard::out() << std::endl;
         if (X.numW_ > 0)
-            std::cout << "\t\t[expect (parser) WARNING]\n";
+            TestShard::out() << "\t\t[expect (parser) WARNING]\n";
         if (X.numE_ > 0)
-            std::cout << "\t\t[expect (parser) ERROR]\n";
+            TestShard::out() << "\t\t[expect (parser) ERROR]\n";
     }
 #endif
 
@@ -239,7 +230,7 @@ void InternalsTestSuite::parse(std::string source,
                   ossTree);
 
 #ifdef DUMP_AST
-    std::cout << "\n\n"
+    TestShard::out() << "\n\n"
               << "========================== AST ==================================\n"
               << source << "\n"
               << "-----------------------------------------------------------------"
@@ -253,6 +244,8 @@ void InternalsTestSuite::parse(std::string source,
 
     std::string textP = ossText.str();
     textP.erase(std::remove_if(textP.begin(), textP.end(), ::isspace), textP.end());
+    if (!X.unparsedText_.empty())
+        text = X.unparsedText_;
     text.erase(std::remove_if(text.begin(), text.end(), ::isspace), text.end());
 
     if (X.containsAmbiguity_) {
@@ -328,7 +321,7 @@ void InternalsTestSuite::reparse(std::string source,
                   ossTree);
 
 #ifdef DUMP_AST
-    std::cout << "\n\n"
+    TestShard::out() << "\n\n"
               << "========================== AST ==================================\n"
               << source << "\n"
               << "-----------------------------------------------------------------"
@@ -390,7 +383,7 @@ namespace {
 bool REJECT_CANDIDATE(const Symbol* sym, std::string msg)
 {
 #ifdef DBG_BINDING_SEARCH
-    std::cout << "\n\t\tREJECT " << sym << " DUE TO " << msg;
+    TestShard::out() << "\n\t\tREJECT " << sym << " DUE TO " << msg;
 #endif
     return false;
 }
@@ -398,7 +391,7 @@ bool REJECT_CANDIDATE(const Symbol* sym, std::string msg)
 void DETAIL_MISMATCH(std::string msg)
 {
 #ifdef DBG_BINDING_SEARCH
-    std::cout << "\n\t\t\tmismatch detail: " << msg;
+    TestShard::out() << "\n\t\t\tmismatch detail: " << msg;
 #endif
 }
 
@@ -847,7 +840,7 @@ void InternalsTestSuite::matchDeclarations(
 {
     for (const auto& Decl : decls) {
 #ifdef DBG_BINDING_SEARCH
-        std::cout << "\n\t\t...";
+        TestShard::out() << "\n\t\t...";
 #endif
         using namespace std::placeholders;
         auto pred = std::bind(symbolMatchesBinding_, _1, Decl, semaModel.get());
@@ -860,7 +853,7 @@ void InternalsTestSuite::matchDeclarations(
             PSY__internals__FAIL(oss.str());
         }
 #ifdef DBG_BINDING_SEARCH
-        std::cout << "\n\t\tmatch! ";
+        TestShard::out() << "\n\t\tmatch! ";
 #endif
     }
 
@@ -878,7 +871,7 @@ void InternalsTestSuite::checkSemanticModel(
 
     for (const auto& Decl : X.declarations_) {
 #ifdef DBG_BINDING_SEARCH
-        std::cout << "\n\t\t...";
+        TestShard::out() << "\n\t\t...";
 #endif
         using namespace std::placeholders;
         auto pred = std::bind(symbolMatchesBinding_, _1, Decl, semaModel);
@@ -891,7 +884,7 @@ void InternalsTestSuite::checkSemanticModel(
             PSY__internals__FAIL(oss.str());
         }
 #ifdef DBG_BINDING_SEARCH
-        std::cout << "\n\t\tmatch! ";
+        TestShard::out() << "\n\t\tmatch! ";
 #endif
 
 //        if (X.checkScope_) {
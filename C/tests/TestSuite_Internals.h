@@ -52,7 +52,6 @@ public:
 
     virtual std::tuple<int, int> testAll() override;
     virtual std::string description() const override;
-    virtual void printSummary() const override;
 
 private:
     bool checkErrorAndWarn(Expectation X);
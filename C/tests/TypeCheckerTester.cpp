@@ -933,8 +933,34 @@ void _ ()
     checkTypes(s, Expectation());
 }
 
-void TypeCheckerTester::case0049(){}
-void TypeCheckerTester::case0050(){}
+void TypeCheckerTester::case0049()
+{
+    auto s = R"(
+typedef int t ;
+void _ ( )
+{
+    int x ;
+    x = ( t ) x ;
+}
+)";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0050()
+{
+    auto s = R"(
+typedef int t ;
+void _ ( )
+{
+    int x ;
+    x = ( t ) - x ;
+}
+)";
+
+    checkTypes(s, Expectation());
+}
+
 void TypeCheckerTester::case0051(){}
 void TypeCheckerTester::case0052(){}
 void TypeCheckerTester::case0053(){}
@@ -2647,11 +2673,83 @@ void _ ()
     checkTypes(s, Expectation());
 }
 
-void TypeCheckerTester::case0342(){}
-void TypeCheckerTester::case0343(){}
-void TypeCheckerTester::case0344(){}
-void TypeCheckerTester::case0345(){}
-void TypeCheckerTester::case0346(){}
+void TypeCheckerTester::case0342()
+{
+    auto s = R"(
+typedef unsigned long t ;
+void f ( unsigned long x ) { }
+void _ ()
+{
+    t x ;
+    f ( x );
+}
+    )";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0343()
+{
+    auto s = R"(
+typedef unsigned long t ;
+void f ( t x ) ;
+void _ ()
+{
+    unsigned long x ;
+    f ( x );
+}
+    )";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0344()
+{
+    auto s = R"(
+void f ( const int x ) { }
+void _ ()
+{
+    int x ;
+    f ( x );
+}
+    )";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0345()
+{
+    auto s = R"(
+void f ( int x ) { }
+void _ ()
+{
+    const int x = 1 ;
+    f ( x );
+}
+    )";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0346()
+{
+    auto s = R"(
+typedef int * t ;
+void f ( float x ) { }
+void _ ()
+{
+    t x ;
+    f ( x );
+}
+    )";
+
+    checkTypes(
+        s,
+        Expectation()
+            .diagnostic(Expectation::ErrorOrWarn::Error,
+                        TypeChecker::DiagnosticsReporter::ID_of_IncompatibleTypesInArgumentToParameterAssignment));
+}
+
 void TypeCheckerTester::case0347(){}
 void TypeCheckerTester::case0348(){}
 void TypeCheckerTester::case0349(){}
@@ -4241,12 +4339,79 @@ void TypeCheckerTester::case0746(){}
 void TypeCheckerTester::case0747(){}
 void TypeCheckerTester::case0748(){}
 void TypeCheckerTester::case0749(){}
-void TypeCheckerTester::case0750(){}
-void TypeCheckerTester::case0751(){}
-void TypeCheckerTester::case0752(){}
-void TypeCheckerTester::case0753(){}
-void TypeCheckerTester::case0754(){}
-void TypeCheckerTester::case0755(){}
+void TypeCheckerTester::case0750()
+{
+    auto s = R"(
+_Static_assert ( 1 + 1 == 2 , "" ) ;
+)";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0751()
+{
+    auto s = R"(
+_Static_assert ( 1 + 1 == 3 , "" ) ;
+)";
+
+    checkTypes(
+        s,
+        Expectation()
+            .diagnostic(Expectation::ErrorOrWarn::Error,
+                        TypeChecker::DiagnosticsReporter::ID_of_StaticAssertionFailed));
+}
+
+void TypeCheckerTester::case0752()
+{
+    auto s = R"(
+enum e { a , b , c = b + 10 } ;
+_Static_assert ( c == 11 , "" ) ;
+)";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0753()
+{
+    auto s = R"(
+void _ ()
+{
+    enum { a = -1 } ;
+    _Static_assert ( a < 0u , "" ) ;
+}
+)";
+
+    checkTypes(
+        s,
+        Expectation()
+            .diagnostic(Expectation::ErrorOrWarn::Error,
+                        TypeChecker::DiagnosticsReporter::ID_of_StaticAssertionFailed));
+}
+void TypeCheckerTester::case0754()
+{
+    auto s = R"(
+struct s { char c ; int i : 7 ; int j ; } ;
+_Static_assert ( sizeof ( struct s ) == 8 , "" ) ;
+_Static_assert ( __builtin_offsetof ( struct s , j ) == 4 , "" ) ;
+)";
+
+    checkTypes(s, Expectation());
+}
+
+void TypeCheckerTester::case0755()
+{
+    auto s = R"(
+struct s { char c ; int i ; } ;
+_Static_assert ( sizeof ( struct s ) == 5 , "" ) ;
+)";
+
+    checkTypes(
+        s,
+        Expectation()
+            .diagnostic(Expectation::ErrorOrWarn::Error,
+                        TypeChecker::DiagnosticsReporter::ID_of_StaticAssertionFailed));
+}
+
 void TypeCheckerTester::case0756(){}
 void TypeCheckerTester::case0757(){}
 void TypeCheckerTester::case0758(){}
@@ -32,9 +32,15 @@ struct ArrayType::ArrayTypeImpl : TypeImpl
     ArrayTypeImpl(const Type* elemTy)
         : TypeImpl(TypeKind::Array)
         , elemTy_(elemTy)
+        , hasKnownSz_(false)
+        , hasUnspecifiedSz_(false)
+        , sz_(0)
     {}
 
     const Type* elemTy_;
+    bool hasKnownSz_;
+    bool hasUnspecifiedSz_;
+    unsigned long long sz_;
 };
 
 ArrayType::ArrayType(const Type* elemTy)
@@ -51,6 +57,32 @@ void ArrayType::resetElementType(const Type* elemTy) const
     P_CAST->elemTy_ = elemTy;
 }
 
+bool ArrayType::hasKnownSize() const
+{
+    return P_CAST->hasKnownSz_;
+}
+
+unsigned long long ArrayType::size() const
+{
+    return P_CAST->sz_;
+}
+
+void ArrayType::setSize(unsigned long long sz) const
+{
+    P_CAST->hasKnownSz_ = true;
+    P_CAST->sz_ = sz;
+}
+
+bool ArrayType::hasUnspecifiedSize() const
+{
+    return P_CAST->hasUnspecifiedSz_;
+}
+
+void ArrayType::setUnspecifiedSize() const
+{
+    P_CAST->hasUnspecifiedSz_ = true;
+}
+
 namespace psy {
 namespace C {
 
@@ -60,6 +92,8 @@ PSY_C_API std::ostream& operator<<(std::ostream& os, const ArrayType* arrTy)
         return os << "<ArrayType is null>";
     os << "<ArrayType | ";
     os << "element-type:" << arrTy->elementType();
+    if (arrTy->hasKnownSize())
+        os << " size:" << arrTy->size();
     os << ">";
     return os;
 }
@@ -47,15 +47,40 @@ public:
      */
     const Type* elementType() const;
 
+    /**
+     * Whether the size of \c this ArrayType is known.
+     *
+     * \remark 6.7.6.2-4
+     */
+    bool hasKnownSize() const;
+
+    /**
+     * The size (number of elements) of \c this ArrayType.
+     *
+     * \remark The result is meaningful only if the size is known.
+     */
+    unsigned long long size() const;
+
+    /**
+     * Whether the size of \c this ArrayType is unspecified, as in \c int x[];
+     * the size of an ArrayType may also be specified, but not known.
+     *
+     * \remark 6.7.6.2-4
+     */
+    bool hasUnspecifiedSize() const;
+
 PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(DeclarationBinder);
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
     PSY_GRANT_INTERNAL_ACCESS(TypedefNameTypeResolver);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     ArrayType(const Type* elemTy);
 
     void resetElementType(const Type*) const;
+    void setSize(unsigned long long sz) const;
+    void setUnspecifiedSize() const;
 
 private:
     DECL_PIMPL_SUB(ArrayType)
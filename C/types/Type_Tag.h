@@ -68,6 +68,7 @@ PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(TypeCanonicalizer);
     PSY_GRANT_INTERNAL_ACCESS(TagDeclarationSymbol);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     TagType(TagTypeKind tagTyK, const Identifier* tag);
 
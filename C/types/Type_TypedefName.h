@@ -64,6 +64,7 @@ PSY_INTERNAL:
     PSY_GRANT_INTERNAL_ACCESS(TypedefNameTypeResolver);
     PSY_GRANT_INTERNAL_ACCESS(TypedefDeclarationSymbol);
     PSY_GRANT_INTERNAL_ACCESS(TypeChecker);
+    PSY_GRANT_INTERNAL_ACCESS(SemanticModelSnapshot);
 
     TypedefNameType(const Identifier* typedefName);
 
@@ -20,21 +20,81 @@
 
 #include "tests/TestSuite.h"
 
+#include "cxxopts.hpp"
+
 #include <iostream>
+#include <string>
+#include <thread>
 
 using namespace psy;
 
-int main()
+namespace {
+
+const char* const kTestSuite = "test-suite: ";
+
+} // anonymous
+
+int main(int argc, char* argv[])
 {
+    cxxopts::Options cmdLineOpts(argv[0], "psychec's test suite");
+    cmdLineOpts
+        .add_options()
+            ("j,jobs",
+                "Shard the tests over <n> threads (default: the number of cores).",
+                cxxopts::value<unsigned int>(),
+                "<n>")
+            ("f,filter",
+                "Run only tests whose name (e.g., PARSER-case0001) contains <text>.",
+                cxxopts::value<std::string>(),
+                "<text>")
+            ("r,range",
+                "Run only tests whose case number is within <first>-<last>.",
+                cxxopts::value<std::string>(),
+                "<first>-<last>")
+            ("s,slowest",
+                "Report the <n> slowest tests.",
+                cxxopts::value<unsigned int>()->default_value("10"),
+                "<n>")
+            ("h,help",
+                "Print instructions.")
+    ;
+
+    TestRunOptions opts;
+    try {
+        auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
+
+        if (parsedCmdLine.count("help")) {
+            std::cout << cmdLineOpts.help() << std::endl;
+            return 0;
+        }
+
+        opts.jobs_ = parsedCmdLine.count("jobs")
+                ? parsedCmdLine["jobs"].as<unsigned int>()
+                : std::thread::hardware_concurrency();
+        if (parsedCmdLine.count("filter"))
+            opts.filter_ = parsedCmdLine["filter"].as<std::string>();
+        if (parsedCmdLine.count("range")) {
+            auto range = parsedCmdLine["range"].as<std::string>();
+            auto sep = range.find('-');
+            opts.rangeFirst_ = std::stoi(range.substr(0, sep));
+            opts.rangeLast_ = sep == std::string::npos
+                    ? opts.rangeFirst_
+                    : std::stoi(range.substr(sep + 1));
+        }
+        opts.slowestCnt_ = parsedCmdLine["slowest"].as<unsigned int>();
+    }
+    catch (...) {
+        std::cerr << kTestSuite << "unrecognized command-line flag" << std::endl;
+        return 1;
+    }
+
     try
     {
-        TestSuite::runTests();
+        return TestSuite::runTests(opts) ? 1 : 0;
     }
     catch (...)
     {
         std::cerr << "Unhandled exception during tests!" << std::endl;
         return 1;
     }
-
-    return 0;
 }
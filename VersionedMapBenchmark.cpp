@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+ * A benchmark of VersionedMap: it builds a history of edits with
+ * speculative branches and rollbacks, and times switching between
+ * neighboring and between random revisions, against reconstructing a
+ * revision by replaying its edits from the start.
+ */
+
+#include "data-structures/VersionedMap.h"
+
+#include "cxxopts.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace psy;
+
+namespace {
+
+const char* const kBenchmark = "benchmark-versioned-map: ";
+
+// A move-only value.
+using Value = std::unique_ptr<int>;
+
+struct LoggedEdit
+{
+    uint32_t parent_;
+    int key_;
+    std::optional<int> value_;
+};
+
+/*
+ * Reconstruct a revision by replaying, from the start, the edits on its path.
+ */
+std::map<int, int> replay(const std::vector<LoggedEdit>& log, uint32_t revision)
+{
+    std::vector<uint32_t> path;
+    for (; revision; revision = log[revision - 1].parent_)
+        path.push_back(revision);
+
+    std::map<int, int> m;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        const auto& edit = log[*it - 1];
+        if (edit.value_)
+            m[edit.key_] = *edit.value_;
+        else
+            m.erase(edit.key_);
+    }
+    return m;
+}
+
+bool matches(const VersionedMap<int, Value>& vmap, const std::map<int, int>& m)
+{
+    if (vmap.size() != m.size())
+        return false;
+    for (const auto& [key, value] : m) {
+        auto it = vmap.find(key);
+        if (it == vmap.end() || *it->second != value)
+            return false;
+    }
+    return true;
+}
+
+template <class FuncT>
+double nanosecondsPer(std::size_t cnt, FuncT func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0U; i < cnt; ++i)
+        func(i);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / cnt;
+}
+
+} // anonymous
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options cmdLineOpts(argv[0], "benchmark of VersionedMap");
+    cmdLineOpts
+        .add_options()
+            ("e,edits",
+                "Build a history of <n> edits.",
+                cxxopts::value<unsigned int>()->default_value("100000"),
+                "<n>")
+            ("k,keys",
+                "Edit <n> distinct keys.",
+                cxxopts::value<unsigned int>()->default_value("1000"),
+                "<n>")
+            ("s,switches",
+                "Time <n> revision switches.",
+                cxxopts::value<unsigned int>()->default_value("1000"),
+                "<n>")
+            ("h,help",
+                "Print instructions.")
+    ;
+
+    unsigned int editCnt = 0;
+    unsigned int keyCnt = 0;
+    unsigned int switchCnt = 0;
+    try {
+        auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
+
+        if (parsedCmdLine.count("help")) {
+            std::cout << cmdLineOpts.help() << std::endl;
+            return 0;
+        }
+
+        editCnt = std::max(1U, parsedCmdLine["edits"].as<unsigned int>());
+        keyCnt = std::max(1U, parsedCmdLine["keys"].as<unsigned int>());
+        switchCnt = std::max(1U, parsedCmdLine["switches"].as<unsigned int>());
+    }
+    catch (...) {
+        std::cerr << kBenchmark << "unrecognized command-line flag" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(0x5eed);
+    auto randomUpTo = [&rng] (uint32_t n) {
+        return std::uniform_int_distribution<uint32_t>(0, n)(rng);
+    };
+
+    // Every 16 edits, a speculation is rolled back (to a recent revision).
+    VersionedMap<int, Value> vmap;
+    std::vector<LoggedEdit> log;
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0U; i < editCnt; ++i) {
+        if (i % 16 == 15)
+            vmap.applyRevision(vmap.revision() - std::min<uint32_t>(vmap.revision(), randomUpTo(8)));
+
+        auto key = static_cast<int>(randomUpTo(keyCnt - 1));
+        LoggedEdit edit{ vmap.revision(), key, std::nullopt };
+        if (randomUpTo(9) < 7) {
+            edit.value_ = static_cast<int>(i);
+            vmap.insertOrAssign(key, std::make_unique<int>(i));
+        }
+        else {
+            vmap.remove(key);
+        }
+        log.push_back(edit);
+    }
+    auto buildTime = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count() / editCnt;
+
+    // Neighbors: a revision and its parent, back and forth.
+    std::vector<uint32_t> revisions(switchCnt);
+    for (auto& rev : revisions)
+        rev = 1 + randomUpTo(editCnt - 1);
+    double neighborTime = 0;
+    auto sampleCnt = std::min(switchCnt, 100U);
+    for (auto i = 0U; i < sampleCnt; ++i) {
+        auto rev = revisions[i];
+        auto parent = log[rev - 1].parent_;
+        vmap.applyRevision(rev);
+        neighborTime += nanosecondsPer(switchCnt / sampleCnt + 1, [&] (std::size_t) {
+            vmap.applyRevision(parent);
+            vmap.applyRevision(rev);
+        }) / 2;
+    }
+    neighborTime /= sampleCnt;
+
+    // Random revisions (at any distance).
+    auto randomTime = nanosecondsPer(switchCnt, [&] (std::size_t i) {
+        vmap.applyRevision(revisions[i]);
+    });
+
+    // Replaying is much slower; time (and check against) a sample of it.
+    auto replayCnt = std::min(switchCnt, 100U);
+    auto mismatchCnt = 0;
+    auto replayTime = nanosecondsPer(replayCnt, [&] (std::size_t i) {
+        auto m = replay(log, revisions[i]);
+        vmap.applyRevision(revisions[i]);
+        if (!matches(vmap, m))
+            ++mismatchCnt;
+    });
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "edits: " << editCnt << ", keys: " << keyCnt << std::endl
+              << "    edit:                 " << std::setw(12) << buildTime << " ns" << std::endl
+              << "    switch to neighbor:   " << std::setw(12) << neighborTime << " ns" << std::endl
+              << "    switch to random:     " << std::setw(12) << randomTime << " ns" << std::endl
+              << "    replay from start:    " << std::setw(12) << replayTime << " ns" << std::endl;
+
+    if (mismatchCnt) {
+        std::cerr << kBenchmark << mismatchCnt << " revisions mismatch their replay" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,342 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "utility/IO.h"
+
+#include "cxxopts.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace psy;
+
+/*
+ * Emit synthetic, self-contained, C programs whose "shape" is controlled
+ * by a single parameter, so that the scaling of the frontend phases can be
+ * measured along that dimension (see tests/scripts/sweep.sh).
+ *
+ * Note: the parser bounds the nesting of expressions and of statements
+ * (around 100 levels); beyond that, parsing is aborted.
+ */
+
+namespace {
+
+const char* const kGenerator = "workload-generator: ";
+
+enum class Shape
+{
+    ExpressionDepth,
+    StatementDepth,
+    Typedefs,
+    Ambiguity,
+    Size
+};
+
+bool shapeFromName(const std::string& name, Shape& shape)
+{
+    if (name == "expr-depth")
+        shape = Shape::ExpressionDepth;
+    else if (name == "stmt-depth")
+        shape = Shape::StatementDepth;
+    else if (name == "typedefs")
+        shape = Shape::Typedefs;
+    else if (name == "ambiguity")
+        shape = Shape::Ambiguity;
+    else if (name == "size")
+        shape = Shape::Size;
+    else
+        return false;
+    return true;
+}
+
+/*
+ * A (tiny) deterministic generator, so that the output for a given seed is
+ * the same across platforms, which isn't the case for std's distributions.
+ */
+class Random
+{
+public:
+    explicit Random(std::uint64_t seed) : state_(seed ? seed : 1) {}
+
+    unsigned next(unsigned bound)
+    {
+        state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<unsigned>(state_ >> 33) % bound;
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+class Generator
+{
+public:
+    Generator(int n, int funcs, std::uint64_t seed)
+        : n_(n)
+        , funcs_(funcs)
+        , rand_(seed)
+        , tydefCnt_(16)
+    {}
+
+    std::string generate(Shape shape)
+    {
+        switch (shape) {
+            case Shape::ExpressionDepth:
+                prologue();
+                for (auto i = 0; i < funcs_; ++i)
+                    funcWithExpressionDepth(i);
+                break;
+
+            case Shape::StatementDepth:
+                prologue();
+                for (auto i = 0; i < funcs_; ++i)
+                    funcWithStatementDepth(i);
+                break;
+
+            case Shape::Typedefs:
+                tydefCnt_ = n_ > 0 ? n_ : 1;
+                prologue();
+                for (auto i = 0; i < funcs_; ++i)
+                    funcWithTypedefs(i);
+                break;
+
+            case Shape::Ambiguity:
+                prologue();
+                for (auto i = 0; i < funcs_; ++i)
+                    funcWithAmbiguities(i, n_);
+                break;
+
+            case Shape::Size:
+                prologue();
+                for (auto i = 0; i < n_; ++i)
+                    funcWithAmbiguities(i, 10);
+                break;
+        }
+        return oss_.str();
+    }
+
+private:
+    static constexpr int kVarCnt = 16;
+    static constexpr int kStmtsPerFunc = 20;
+
+    int n_;
+    int funcs_;
+    Random rand_;
+    int tydefCnt_;
+    std::ostringstream oss_;
+
+    /*
+     * The typedefs (some of which are chained, so that canonicalization has
+     * work to do), plus the global variables and the functions that serve
+     * as the "non-type" alternatives of the ambiguous syntax.
+     */
+    void prologue()
+    {
+        static const char* const kTys[] = { "int", "long", "unsigned", "double", "char *" };
+        for (auto i = 0; i < tydefCnt_; ++i) {
+            if (i > 0 && i % 3 == 0)
+                oss_ << "typedef T" << (i - 1) << " T" << i << ";\n";
+            else
+                oss_ << "typedef " << kTys[i % 5] << " T" << i << ";\n";
+        }
+        for (auto i = 0; i < kVarCnt; ++i)
+            oss_ << "int v" << i << ";\n";
+        for (auto i = 0; i < kVarCnt; ++i)
+            oss_ << "int f" << i << "(int);\n";
+        oss_ << "\n";
+    }
+
+    void expr(int depth)
+    {
+        static const char* const kOprtrs[] = { " + ", " - ", " * ", " | ", " < " };
+        if (depth == 0) {
+            oss_ << "a";
+            return;
+        }
+        oss_ << "(";
+        expr(depth - 1);
+        oss_ << kOprtrs[rand_.next(5)] << "b)";
+    }
+
+    void funcWithExpressionDepth(int idx)
+    {
+        oss_ << "int g" << idx << "(int a, int b)\n{\n    return ";
+        expr(n_);
+        oss_ << ";\n}\n\n";
+    }
+
+    void stmt(int depth, int indent)
+    {
+        std::string pad(indent, ' ');
+        if (depth == 0) {
+            oss_ << pad << "a = a - 1;\n";
+            return;
+        }
+        switch (rand_.next(4)) {
+            case 0:
+                oss_ << pad << "if (a > " << depth << ") {\n";
+                break;
+            case 1:
+                oss_ << pad << "while (a > " << depth << ") {\n";
+                break;
+            case 2:
+                oss_ << pad << "for (b = 0; b < " << depth << "; b++) {\n";
+                break;
+            default:
+                oss_ << pad << "{\n";
+                break;
+        }
+        stmt(depth - 1, indent + 1);
+        oss_ << pad << "}\n";
+    }
+
+    void funcWithStatementDepth(int idx)
+    {
+        oss_ << "int g" << idx << "(int a)\n{\n    int b;\n";
+        stmt(n_, 1);
+        oss_ << "    return a;\n}\n\n";
+    }
+
+    void funcWithTypedefs(int idx)
+    {
+        oss_ << "int g" << idx << "(int a)\n{\n";
+        for (auto i = 0; i < kStmtsPerFunc; ++i)
+            oss_ << "    T" << rand_.next(tydefCnt_) << " x" << i << " = (T"
+                 << rand_.next(tydefCnt_) << ") a;\n";
+        oss_ << "    return a;\n}\n\n";
+    }
+
+    /*
+     * A function in which (about) the given percentage of the statements are
+     * syntactically ambiguous, with both the type and the non-type
+     * alternatives being represented.
+     */
+    void funcWithAmbiguities(int idx, int percentage)
+    {
+        oss_ << "int g" << idx << "(int a)\n{\n";
+        for (auto i = 0; i < kStmtsPerFunc; ++i) {
+            if (static_cast<int>(rand_.next(100)) >= percentage) {
+                oss_ << "    a = a + " << i << ";\n";
+                continue;
+            }
+            auto ty = rand_.next(tydefCnt_);
+            auto var = rand_.next(kVarCnt);
+            switch (rand_.next(6)) {
+                case 0:
+                    oss_ << "    a = (T" << ty << ") - a;\n";
+                    break;
+                case 1:
+                    oss_ << "    a = (v" << var << ") - a;\n";
+                    break;
+                case 2:
+                    oss_ << "    T" << ty << " (x" << i << ");\n";
+                    break;
+                case 3:
+                    oss_ << "    f" << var << " (a);\n";
+                    break;
+                case 4:
+                    oss_ << "    T" << ty << " * x" << i << ";\n";
+                    break;
+                default:
+                    oss_ << "    v" << var << " * a;\n";
+                    break;
+            }
+        }
+        oss_ << "    return a;\n}\n\n";
+    }
+};
+
+} // anonymous
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options cmdLineOpts(argv[0], "generator of synthetic C workloads");
+    cmdLineOpts
+        .add_options()
+            ("s,shape",
+                "The dimension along which the program is shaped: "
+                "expr-depth, stmt-depth, typedefs, ambiguity (a percentage), "
+                "or size (a number of functions).",
+                cxxopts::value<std::string>(),
+                "<shape>")
+            ("n,value",
+                "The value of the dimension.",
+                cxxopts::value<int>(),
+                "<n>")
+            ("f,functions",
+                "The number of functions (unless the shape is size).",
+                cxxopts::value<int>()->default_value("100"),
+                "<n>")
+            ("seed",
+                "The seed of the (deterministic) choices.",
+                cxxopts::value<unsigned>()->default_value("1"),
+                "<n>")
+            ("o,output",
+                "Write the program to <file> (instead of stdout).",
+                cxxopts::value<std::string>(),
+                "<file>")
+            ("h,help",
+                "Print instructions.")
+    ;
+
+    Shape shape;
+    int n = 0;
+    int funcs = 0;
+    unsigned seed = 0;
+    std::string outputPath;
+    try {
+        auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
+
+        if (parsedCmdLine.count("help")) {
+            std::cout << cmdLineOpts.help() << std::endl;
+            return 0;
+        }
+        if (!parsedCmdLine.count("shape") || !parsedCmdLine.count("value")) {
+            std::cerr << kGenerator << "shape and value are required" << std::endl;
+            return 1;
+        }
+        if (!shapeFromName(parsedCmdLine["shape"].as<std::string>(), shape)) {
+            std::cerr << kGenerator << "unknown shape" << std::endl;
+            return 1;
+        }
+        n = parsedCmdLine["value"].as<int>();
+        funcs = parsedCmdLine["functions"].as<int>();
+        seed = parsedCmdLine["seed"].as<unsigned>();
+        if (parsedCmdLine.count("output"))
+            outputPath = parsedCmdLine["output"].as<std::string>();
+    }
+    catch (...) {
+        std::cerr << kGenerator << "unrecognized command-line flag" << std::endl;
+        return 1;
+    }
+
+    if (n < 0 || funcs < 1) {
+        std::cerr << kGenerator << "invalid value" << std::endl;
+        return 1;
+    }
+
+    auto text = Generator(n, funcs, seed).generate(shape);
+    if (outputPath.empty()) {
+        std::cout << text;
+        return 0;
+    }
+    return writeFile(outputPath, text);
+}
@@ -26,8 +26,10 @@
 #include "Plugin.h"
 
 #include "sema/Compilation.h"
+#include "sema/SemanticModel.h"
 #include "plugin-api/SourceInspector.h"
 #include "syntax/SyntaxNamePrinter.h"
+#include "syntax/SyntaxWriterJSONLines.h"
 
 #include "../common/infra/Assertions.h"
 
@@ -46,6 +48,42 @@ bool globalDebugEnabled = false;
 namespace
 {
 const char * const kInclude = "#include";
+
+// The standard is validated with the CConfiguration.
+LanguageDialect::Std stdOf(const std::string& std)
+{
+    if (std == "c89" || std == "c90")
+        return LanguageDialect::Std::C89_90;
+    if (std == "c99")
+        return LanguageDialect::Std::C99;
+    if (std == "c17" || std == "c18")
+        return LanguageDialect::Std::C17_18;
+    PSY_ASSERT_1(std == "c11");
+    return LanguageDialect::Std::C11;
+}
+
+// Removes a tree from a (cached) prelude Compilation on every exit path,
+// since the Compilation outlives the tree.
+class SyntaxTreeRemoval
+{
+public:
+    SyntaxTreeRemoval(Compilation* compilation, const SyntaxTree* tree)
+        : compilation_(compilation)
+        , tree_(tree)
+    {}
+    ~SyntaxTreeRemoval()
+    {
+        if (compilation_)
+            compilation_->removeSyntaxTree(tree_);
+    }
+
+    SyntaxTreeRemoval(const SyntaxTreeRemoval&) = delete;
+    void operator=(const SyntaxTreeRemoval&) = delete;
+
+private:
+    Compilation* compilation_;
+    const SyntaxTree* tree_;
+};
 }
 
 constexpr int CCompilerFrontend::ERROR_PreprocessorInvocationFailure;
@@ -92,7 +130,10 @@ int CCompilerFrontend::extendWithStdLibHeaders(const std::string& srcText,
     }
 
     SourceInspector* inspector = Plugin::createInspector();
-    auto stdLibHeaders = inspector->detectRequiredHeaders(srcText);
+    // A plugin of version 1 lacks the overload that takes the standard.
+    auto stdLibHeaders = Plugin::apiVersion() >= 2
+            ? inspector->detectRequiredHeaders(srcText, stdOf(config_->std_))
+            : inspector->detectRequiredHeaders(srcText);
     if (stdLibHeaders.empty())
         return preprocess(srcText, fi);
 
@@ -143,20 +184,6 @@ int CCompilerFrontend::preprocess(const std::string& srcText,
 int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
                                            const psy::FileInfo& fi)
 {
-
-    LanguageDialect::Std std;
-    if (config_->std_ == "c89" || config_->std_ == "c90")
-        std = LanguageDialect::Std::C89_90;
-    else if (config_->std_ == "c99")
-        std = LanguageDialect::Std::C99;
-    else if (config_->std_ == "c17" || config_->std_ == "c18")
-        std = LanguageDialect::Std::C17_18;
-    else if (config_->std_ == "c11")
-        std = LanguageDialect::Std::C11;
-    else {
-        PSY_ASSERT_2(false, return 1);
-    }
-
     ParseOptions::AmbiguityMode ambigMode;
     if (config_->ambigMode_ == "D")
         ambigMode = ParseOptions::AmbiguityMode::Diagnose;
@@ -170,14 +197,55 @@ int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
         PSY_ASSERT_2(false, return 1);
     }
 
-    ParseOptions parseOpts{ LanguageDialect(std) };
+    ParseOptions parseOpts{ LanguageDialect(stdOf(config_->std_)) };
     parseOpts.setAmbiguityMode(ambigMode);
 
-    auto tree = SyntaxTree::parseText(srcText,
-                                      TextPreprocessingState::Preprocessed,
-                                      TextCompleteness::Fragment,
-                                      parseOpts,
-                                      fi.fileName());
+    // With `#include' directives preprocessed, the (leading) text of system
+    // headers is parsed and bound once, into the prelude of a Compilation.
+    Compilation* preludedCompilation = nullptr;
+    bool isNewPrelude = false;
+    std::string srcText_R;
+    if (config_->ppIncludes_ && config_->WIP_) {
+        std::string prefix;
+        std::tie(prefix, srcText_R) = HeaderPrefixCache::split(srcText);
+        if (!prefix.empty()) {
+            if (!headerPrefixCache_)
+                headerPrefixCache_.reset(new HeaderPrefixCache(parseOpts, inferenceOptions()));
+            std::tie(preludedCompilation, isNewPrelude) =
+                    headerPrefixCache_->compilationFor(prefix);
+        }
+    }
+
+    std::unique_ptr<SyntaxTree> tree;
+    if (preludedCompilation) {
+        // The algorithmic disambiguation of the remaining text lacks the names
+        // declared in the prelude; where that makes it inconclusive, a heuristic
+        // could decide differently than it would for the whole text, so the
+        // whole text is parsed instead.
+        auto disambiguatesAlgorithmically =
+                ambigMode == ParseOptions::AmbiguityMode::DisambiguateAlgorithmically
+                    || ambigMode == ParseOptions::AmbiguityMode::DisambiguateAlgorithmicallyAndHeuristically;
+        auto parseOpts_R = parseOpts;
+        if (disambiguatesAlgorithmically)
+            parseOpts_R.setAmbiguityMode(ParseOptions::AmbiguityMode::DisambiguateAlgorithmically);
+        tree = SyntaxTree::parseText(srcText_R,
+                                     TextPreprocessingState::Preprocessed,
+                                     TextCompleteness::Fragment,
+                                     parseOpts_R,
+                                     fi.fileName());
+        if (tree && disambiguatesAlgorithmically && !tree->diagnostics().empty()) {
+            tree.reset();
+            preludedCompilation = nullptr;
+            isNewPrelude = false;
+        }
+    }
+    if (!tree) {
+        tree = SyntaxTree::parseText(srcText,
+                                     TextPreprocessingState::Preprocessed,
+                                     TextCompleteness::Fragment,
+                                     parseOpts,
+                                     fi.fileName());
+    }
 
     if (!tree) {
         std::cerr << "unsuccessful parsing" << std::endl;
@@ -198,23 +266,76 @@ int CCompilerFrontend::constructSyntaxTree(const std::string& srcText,
     }
 
     if (config_->dumpAst) {
-        std::ostringstream ossTree;
+        OutputSink sink(std::cout);
         SyntaxNamePrinter printer(tree.get());
         printer.print(TU,
                       SyntaxNamePrinter::Style::Decorated,
-                      ossTree);
-        std::cout << ossTree.str() << std::endl;
+                      sink);
+        sink << '\n';
+    }
+
+    if (!config_->exportJSONLPath_.empty() && !config_->WIP_) {
+        auto exit = exportJSONL(tree.get(), nullptr);
+        if (exit != 0)
+            return exit;
     }
 
-    return config_->WIP_ ? computeSemanticModel(std::move(tree))
+    return config_->WIP_ ? computeSemanticModel(std::move(tree),
+                                                preludedCompilation,
+                                                isNewPrelude,
+                                                fi)
                          : 0;
 }
 
-int CCompilerFrontend::computeSemanticModel(std::unique_ptr<SyntaxTree> tree)
+InferenceOptions CCompilerFrontend::inferenceOptions() const
 {
-    auto compilation = Compilation::create(tree->filePath());
+    InferenceOptions inferOpts;
+    inferOpts.enable_DeclarationAndTypeInference(config_->inferTypes_);
+    return inferOpts;
+}
+
+int CCompilerFrontend::computeSemanticModel(std::unique_ptr<SyntaxTree> tree,
+                                            Compilation* preludedCompilation,
+                                            bool isNewPrelude,
+                                            const psy::FileInfo& fi)
+{
+    std::unique_ptr<Compilation> ownCompilation;
+    auto compilation = preludedCompilation;
+    if (!compilation) {
+        ownCompilation = Compilation::create(tree->filePath(),
+                                             PlatformOptions(),
+                                             inferenceOptions());
+        compilation = ownCompilation.get();
+    }
     compilation->addSyntaxTrees({ tree.get() });
-    /*auto semaModel = */compilation->computeSemanticModel(tree.get());
+    SyntaxTreeRemoval removal(preludedCompilation, tree.get());
+
+    auto semaModel = compilation->computeSemanticModel(tree.get());
+
+    if (semaModel && !semaModel->synthesizedDeclarations().empty()) {
+        auto exit = writeFile(fi.fullFileBaseName() + ".inferred.h",
+                              semaModel->synthesizedDeclarations());
+        if (exit != 0) {
+            std::cerr << kCnip << "inferred declarations file write failure" << std::endl;
+            return ERROR_InferredDeclarationsFileWritingFailure;
+        }
+    }
+
+    if (!config_->exportJSONLPath_.empty()) {
+        auto exit = exportJSONL(tree.get(), semaModel);
+        if (exit != 0)
+            return exit;
+    }
+
+    if (isNewPrelude) {
+        auto preludeTree = compilation->preludeSyntaxTree();
+        if (!preludeTree->diagnostics().empty()) {
+            auto c = preludeTree->diagnostics();
+            std::copy(c.begin(), c.end(),
+                      std::ostream_iterator<Diagnostic>(std::cerr));
+            std::cerr << std::endl;
+        }
+    }
 
     // show only not yet shown
     if (!tree->diagnostics().empty()) {
@@ -226,3 +347,30 @@ int CCompilerFrontend::computeSemanticModel(std::unique_ptr<SyntaxTree> tree)
 
     return 0;
 }
+
+int CCompilerFrontend::exportJSONL(const SyntaxTree* tree, const SemanticModel* semaModel)
+{
+    SyntaxWriterJSONLines writer(tree);
+    if (config_->exportJSONLPath_ == "-") {
+        OutputSink sink(std::cout);
+        writer.write(tree->root(), sink, semaModel);
+        return 0;
+    }
+
+    // The file is opened once per run; each tree is appended, after its
+    // own `tree' record.
+    if (!jsonlOfs_)
+        jsonlOfs_.reset(new std::ofstream(config_->exportJSONLPath_));
+    if (!*jsonlOfs_) {
+        std::cerr << kCnip << "JSON Lines export failure" << std::endl;
+        return ERROR_JSONLExportFailure;
+    }
+    OutputSink sink(*jsonlOfs_);
+    writer.write(tree->root(), sink, semaModel);
+    sink.flush();
+    if (!*jsonlOfs_) {
+        std::cerr << kCnip << "JSON Lines export failure" << std::endl;
+        return ERROR_JSONLExportFailure;
+    }
+    return 0;
+}
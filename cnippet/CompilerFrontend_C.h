@@ -25,9 +25,12 @@
 
 #include "CompilerFrontend.h"
 #include "Configuration_C.h"
+#include "HeaderPrefixCache.h"
 
 #include "C/syntax/SyntaxTree.h"
 
+#include <fstream>
+#include <memory>
 #include <utility>
 #include <string>
 
@@ -50,14 +53,24 @@ private:
     int extendWithStdLibHeaders(const std::string& srcText, const psy::FileInfo& fi);
     int preprocess(const std::string& srcText, const psy::FileInfo& fi);
     int constructSyntaxTree(const std::string& srcText, const psy::FileInfo& fi);
-    int computeSemanticModel(std::unique_ptr<psy::C::SyntaxTree> tree);
+    psy::C::InferenceOptions inferenceOptions() const;
+    int computeSemanticModel(std::unique_ptr<psy::C::SyntaxTree> tree,
+                             psy::C::Compilation* preludedCompilation,
+                             bool isNewPrelude,
+                             const psy::FileInfo& fi);
+    int exportJSONL(const psy::C::SyntaxTree* tree,
+                    const psy::C::SemanticModel* semaModel);
 
     static constexpr int ERROR_PreprocessorInvocationFailure = 100;
     static constexpr int ERROR_PreprocessedFileWritingFailure = 101;
     static constexpr int ERROR_UnsuccessfulParsing = 102;
     static constexpr int ERROR_InvalidSyntaxTree = 103;
+    static constexpr int ERROR_InferredDeclarationsFileWritingFailure = 104;
+    static constexpr int ERROR_JSONLExportFailure = 105;
 
     std::unique_ptr<CConfiguration> config_;
+    std::unique_ptr<HeaderPrefixCache> headerPrefixCache_;
+    std::unique_ptr<std::ofstream> jsonlOfs_;
 };
 
 } // cnip
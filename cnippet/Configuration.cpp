@@ -27,5 +27,8 @@ Configuration::~Configuration()
 
 Configuration::Configuration(const cxxopts::ParseResult& parsedCmdLine)
     : dumpAst(parsedCmdLine.count("dump-AST"))
+    , exportJSONLPath_(parsedCmdLine.count("export-JSONL")
+                            ? parsedCmdLine["export-JSONL"].as<std::string>()
+                            : std::string())
     , WIP_(parsedCmdLine.count("WIP"))
 {}
@@ -23,6 +23,8 @@
 
 #include "cxxopts.hpp"
 
+#include <string>
+
 namespace cnip {
 
 /*!
@@ -35,6 +37,7 @@ public:
 
     // TODO: API
     bool dumpAst;
+    std::string exportJSONLPath_;
     bool WIP_;
 
 protected:
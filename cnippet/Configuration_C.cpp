@@ -98,7 +98,7 @@ void CConfiguration::extend(cxxopts::Options& cmdLineOpts)
 
         /* Preprocessor */
             (kPPInclude,
-                "Preprocess `#include' directives.",
+                "Preprocess `#include' directives (with WIP, the system-header prefix of the files is parsed and bound once, then reused).",
                 cxxopts::value<bool>()->default_value("false"))
 
             // https://gcc.gnu.org/onlinedocs/gcc/Directory-Options.html
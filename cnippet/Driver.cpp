@@ -28,6 +28,8 @@
 #include "IO.h"
 #include "Plugin.h"
 
+#include "../common/infra/Instrumentation.h"
+
 #include <algorithm>
 #include <iostream>
 #include <iterator>
@@ -67,6 +69,10 @@ int Driver::execute(int argc, char* argv[])
                 "<C>")
             ("d,dump-AST",
                 "Dump the program's AST to the console.")
+            ("export-JSONL",
+                "Export the program's AST (and, with WIP, its semantic model) as JSON Lines to <file> (`-' for the console).",
+                cxxopts::value<std::string>(),
+                "<file>")
             ("g,debug",
                 "Enable debugging.",
                 cxxopts::value<bool>(DEBUG::globalDebugEnabled))
@@ -75,6 +81,10 @@ int Driver::execute(int argc, char* argv[])
                 cxxopts::value<std::string>())
             ("w,WIP",
                 "Enable Work-In-Progress features.")
+            ("stats-json",
+                "Write timings and counters of the frontend's phases, as JSON, to <file>.",
+                cxxopts::value<std::string>(),
+                "<file>")
             ("h,help",
                 "Print instructions.")
     ;
@@ -83,6 +93,7 @@ int Driver::execute(int argc, char* argv[])
 
     std::unique_ptr<CompilerFrontend> CFE;
     std::vector<std::string> filesPaths;
+    std::string statsFilePath;
     try {
         cmdLineOpts.parse_positional(std::vector<std::string>{"file"});
         auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
@@ -108,6 +119,13 @@ int Driver::execute(int argc, char* argv[])
             return ERROR_NoInputFile;
         }
 
+        if (parsedCmdLine.count("stats-json")) {
+            statsFilePath = parsedCmdLine["stats-json"].as<std::string>();
+            if (!Instrumentation::isSupported())
+                std::cerr << kCnip << "instrumentation isn't compiled in" << std::endl;
+            Instrumentation::enable(true);
+        }
+
         auto lang = parsedCmdLine["lang"].as<std::string>();
         if (lang != "C") {
             std::cerr << kCnip << "language " << lang << " not recognized" << std::endl;
@@ -144,5 +162,14 @@ int Driver::execute(int argc, char* argv[])
             return exit;
     }
 
+    if (!statsFilePath.empty()) {
+        std::ostringstream oss;
+        Instrumentation::writeJSON(oss);
+        if (writeFile(statsFilePath, oss.str()) != 0) {
+            std::cerr << kCnip << "cannot write " << statsFilePath << std::endl;
+            return ERROR;
+        }
+    }
+
     return SUCCESS;
 }
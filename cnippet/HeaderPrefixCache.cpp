@@ -0,0 +1,189 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "HeaderPrefixCache.h"
+
+#include "../common/infra/Assertions.h"
+
+#include <cctype>
+
+using namespace cnip;
+using namespace psy;
+using namespace C;
+
+namespace {
+
+struct LineMarker
+{
+    std::string fileName_;
+    bool isSystemHeader_;
+};
+
+/*
+ * Parse a line marker of the preprocessor: # <line> "<file>" <flags>
+ */
+bool parseLineMarker(const std::string& text,
+                     std::size_t pos,
+                     std::size_t end,
+                     LineMarker& marker)
+{
+    auto skipSpaces = [&] () {
+        while (pos < end && (text[pos] == ' ' || text[pos] == '\t'))
+            ++pos;
+    };
+
+    skipSpaces();
+    if (pos == end || text[pos] != '#')
+        return false;
+    ++pos;
+    skipSpaces();
+    if (pos == end || !std::isdigit(static_cast<unsigned char>(text[pos])))
+        return false;
+    while (pos < end && std::isdigit(static_cast<unsigned char>(text[pos])))
+        ++pos;
+    skipSpaces();
+    if (pos == end || text[pos] != '"')
+        return false;
+    ++pos;
+
+    marker.fileName_.clear();
+    while (pos < end && text[pos] != '"') {
+        if (text[pos] == '\\' && pos + 1 < end)
+            ++pos;
+        marker.fileName_ += text[pos++];
+    }
+    if (pos == end)
+        return false;
+    ++pos;
+
+    marker.isSystemHeader_ = false;
+    while (pos < end) {
+        skipSpaces();
+        if (pos < end && text[pos] == '3'
+                && (pos + 1 == end || !std::isdigit(static_cast<unsigned char>(text[pos + 1])))) {
+            marker.isSystemHeader_ = true;
+        }
+        while (pos < end && !(text[pos] == ' ' || text[pos] == '\t'))
+            ++pos;
+    }
+    return true;
+}
+
+bool isBlank(const std::string& text, std::size_t pos, std::size_t end)
+{
+    for (; pos < end; ++pos) {
+        if (!std::isspace(static_cast<unsigned char>(text[pos])))
+            return false;
+    }
+    return true;
+}
+
+} // anonymous
+
+HeaderPrefixCache::HeaderPrefixCache(ParseOptions parseOpts, InferenceOptions inferOpts)
+    : parseOpts_(std::move(parseOpts))
+    , inferOpts_(std::move(inferOpts))
+{}
+
+HeaderPrefixCache::~HeaderPrefixCache()
+{}
+
+std::pair<std::string, std::string> HeaderPrefixCache::split(const std::string& srcText)
+{
+    std::string prefix;
+    std::string mainFileName;
+    bool seenMainFile = false;
+    bool inSystemHeader = false;
+    bool prefixHasCode = false;
+    std::size_t markerPos = std::string::npos;
+    std::size_t prefixSizeAtMarker = 0;
+
+    std::size_t pos = 0;
+    while (pos < srcText.size()) {
+        auto eol = srcText.find('\n', pos);
+        auto end = eol == std::string::npos ? srcText.size() : eol;
+        auto next = eol == std::string::npos ? srcText.size() : eol + 1;
+
+        LineMarker marker;
+        if (parseLineMarker(srcText, pos, end, marker)) {
+            if (!seenMainFile) {
+                mainFileName = marker.fileName_;
+                seenMainFile = true;
+            }
+            inSystemHeader = marker.isSystemHeader_;
+            markerPos = pos;
+            prefixSizeAtMarker = prefix.size();
+            // The markers of the main file differ across translation units:
+            // they're left out so that the prefix may be shared.
+            if (marker.fileName_ != mainFileName)
+                prefix.append(srcText, pos, next - pos);
+        }
+        else if (isBlank(srcText, pos, end)) {
+            if (inSystemHeader)
+                prefix.append(srcText, pos, next - pos);
+        }
+        else if (inSystemHeader) {
+            prefix.append(srcText, pos, next - pos);
+            prefixHasCode = true;
+        }
+        else {
+            break;
+        }
+        pos = next;
+    }
+
+    if (!prefixHasCode)
+        return std::make_pair(std::string(), srcText);
+
+    if (pos == srcText.size())
+        return std::make_pair(std::move(prefix), std::string());
+
+    // The remainder starts at the line marker that leads to its text.
+    PSY_ASSERT_2(markerPos != std::string::npos, return std::make_pair(std::string(), srcText));
+    prefix.resize(prefixSizeAtMarker);
+    return std::make_pair(std::move(prefix), srcText.substr(markerPos));
+}
+
+std::pair<Compilation*, bool> HeaderPrefixCache::compilationFor(const std::string& prefix)
+{
+    auto it = entries_.find(prefix);
+    if (it != entries_.end())
+        return std::make_pair(it->second.compilation_.get(), false);
+
+    Entry entry;
+    entry.tree_ = SyntaxTree::parseText(prefix,
+                                        TextPreprocessingState::Preprocessed,
+                                        TextCompleteness::Fragment,
+                                        parseOpts_,
+                                        "<header-prefix>");
+    entry.compilation_ = Compilation::create(entry.tree_->filePath(),
+                                             PlatformOptions(),
+                                             inferOpts_);
+    entry.compilation_->addSyntaxTree(entry.tree_.get());
+    entry.compilation_->setPreludeSyntaxTree(entry.tree_.get());
+
+    auto r = entries_.emplace(prefix, std::move(entry));
+    return std::make_pair(r.first->second.compilation_.get(), true);
+}
+
+std::size_t HeaderPrefixCache::size() const
+{
+    return entries_.size();
+}
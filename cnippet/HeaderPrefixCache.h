@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef CNIPPET_HEADER_PREFIX_CACHE_H__
+#define CNIPPET_HEADER_PREFIX_CACHE_H__
+
+#include "C/parser/ParseOptions.h"
+#include "C/sema/Compilation.h"
+#include "C/syntax/SyntaxTree.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cnip {
+
+/*!
+ * \brief The HeaderPrefixCache class.
+ *
+ * A cache of the (leading) part of a preprocessed text that stems from
+ * system headers, as identified by the line markers of the preprocessor
+ * (\c # <line> "<file>" <flags>, with flag \c 3 for system headers).
+ * That part is typically the same across many translation units; it's
+ * parsed and bound once, into the \a prelude of a Compilation, to which
+ * the SyntaxTree of the remaining part of each text is added.
+ *
+ * \remark Only a text whose \c #include directives were preprocessed
+ * carries line markers, and only a (WIP) SemanticModel computation uses
+ * the prelude; so the cache is in effect under \c --C-pp-includes and
+ * \c --WIP only.
+ */
+class HeaderPrefixCache
+{
+public:
+    HeaderPrefixCache(psy::C::ParseOptions parseOpts,
+                      psy::C::InferenceOptions inferOpts = psy::C::InferenceOptions());
+    ~HeaderPrefixCache();
+
+    /*!
+     * Split the preprocessed text \p srcText into a (normalized) prefix,
+     * that stems from system headers, and the remainder of the text. The
+     * prefix is empty if there's nothing to cache.
+     */
+    static std::pair<std::string, std::string> split(const std::string& srcText);
+
+    /*!
+     * The Compilation whose prelude is the SyntaxTree of the text \p prefix,
+     * and whether that SyntaxTree has just been parsed (i.e., missed the cache).
+     */
+    std::pair<psy::C::Compilation*, bool> compilationFor(const std::string& prefix);
+
+    /*!
+     * The number of distinct prefixes in the cache.
+     */
+    std::size_t size() const;
+
+private:
+    HeaderPrefixCache(const HeaderPrefixCache&) = delete;
+    HeaderPrefixCache& operator=(const HeaderPrefixCache&) = delete;
+
+    struct Entry
+    {
+        std::unique_ptr<psy::C::SyntaxTree> tree_;
+        std::unique_ptr<psy::C::Compilation> compilation_;
+    };
+
+    psy::C::ParseOptions parseOpts_;
+    psy::C::InferenceOptions inferOpts_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+} // cnip
+
+#endif
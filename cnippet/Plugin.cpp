@@ -61,6 +61,21 @@ bool Plugin::isLoaded()
     return handle_;
 }
 
+int Plugin::apiVersion()
+{
+    if (!handle_)
+        return 0;
+
+    using FuncT = int (*) ();
+
+    dlerror();
+    FuncT func = (FuncT)dlsym(handle_, "pluginApiVersion");
+    if (dlerror())
+        return 1;
+
+    return (*func)();
+}
+
 void Plugin::unload()
 {
     if (!handle_)
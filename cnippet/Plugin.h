@@ -48,6 +48,11 @@ public:
     static bool isLoaded();
     static void unload();
 
+    /*!
+     * The plugin API version of the loaded plugin (see \c PLUGIN_API_VERSION).
+     */
+    static int apiVersion();
+
     static psy::C::DeclarationInterceptor* createInterceptor();
     static psy::C::SourceInspector* createInspector();
     static psy::C::VisitorObserver* createObserver();
@@ -0,0 +1,303 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace psy;
+
+namespace {
+
+struct PhaseRecord
+{
+    const char* phase_;
+    std::uint64_t seq_;
+    std::uint64_t runs_;
+    std::uint64_t nanoseconds_;
+    std::vector<std::pair<std::string, std::uint64_t>> counters_;
+};
+
+struct FileRecord
+{
+    std::uint64_t seq_;
+    std::vector<PhaseRecord> phases_;
+};
+
+using FileRecords = std::unordered_map<std::string, FileRecord>;
+
+/*
+ * The records of a thread. Only that thread writes them, so its mutex is
+ * contended only while the records are read (or reset); the sequence
+ * numbers order the files and phases across threads.
+ */
+struct ThreadRecords
+{
+    std::mutex mutex_;
+    FileRecords files_;
+    FileRecords::value_type* lastFile_ { nullptr };
+};
+
+std::atomic<bool> enabled_ { false };
+std::atomic<std::uint64_t> nextSeq_ { 0 };
+std::mutex threadsMutex_;
+std::vector<std::shared_ptr<ThreadRecords>> threads_;
+
+ThreadRecords& threadRecords()
+{
+    // The records outlive the thread, so that they can be read after it's done.
+    thread_local std::shared_ptr<ThreadRecords> records = [] {
+        auto recs = std::make_shared<ThreadRecords>();
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        threads_.push_back(recs);
+        return recs;
+    }();
+    return *records;
+}
+
+PhaseRecord& phaseRecord(ThreadRecords& recs, const std::string& fileName, const char* phase)
+{
+    if (!recs.lastFile_ || recs.lastFile_->first != fileName) {
+        auto it = recs.files_.find(fileName);
+        if (it == recs.files_.end())
+            it = recs.files_.emplace(fileName, FileRecord{ nextSeq_++, {} }).first;
+        recs.lastFile_ = &*it;
+    }
+
+    auto& file = recs.lastFile_->second;
+    for (auto& p : file.phases_) {
+        if (!std::strcmp(p.phase_, phase))
+            return p;
+    }
+    file.phases_.push_back(PhaseRecord{ phase, nextSeq_++, 0, 0, {} });
+    return file.phases_.back();
+}
+
+void addCount(std::vector<std::pair<std::string, std::uint64_t>>& counters,
+              const char* counter,
+              std::uint64_t value)
+{
+    for (auto& c : counters) {
+        if (c.first == counter) {
+            c.second += value;
+            return;
+        }
+    }
+    counters.push_back(std::make_pair(counter, value));
+}
+
+/*
+ * The records of all threads, merged per file and phase, in the order in
+ * which files and phases were first recorded.
+ */
+std::vector<std::pair<std::string, FileRecord>> mergedRecords()
+{
+    std::unordered_map<std::string, std::size_t> fileIdxs;
+    std::vector<std::pair<std::string, FileRecord>> files;
+
+    std::lock_guard<std::mutex> lock(threadsMutex_);
+    for (const auto& recs : threads_) {
+        std::lock_guard<std::mutex> recsLock(recs->mutex_);
+        for (const auto& f : recs->files_) {
+            auto it = fileIdxs.find(f.first);
+            if (it == fileIdxs.end()) {
+                it = fileIdxs.emplace(f.first, files.size()).first;
+                files.emplace_back(f.first, FileRecord{ f.second.seq_, {} });
+            }
+            auto& file = files[it->second].second;
+            file.seq_ = std::min(file.seq_, f.second.seq_);
+            for (const auto& p : f.second.phases_) {
+                auto phaseIt = std::find_if(file.phases_.begin(),
+                                            file.phases_.end(),
+                                            [&p] (const PhaseRecord& q) {
+                                                return !std::strcmp(q.phase_, p.phase_);
+                                            });
+                if (phaseIt == file.phases_.end()) {
+                    file.phases_.push_back(p);
+                    continue;
+                }
+                phaseIt->seq_ = std::min(phaseIt->seq_, p.seq_);
+                phaseIt->runs_ += p.runs_;
+                phaseIt->nanoseconds_ += p.nanoseconds_;
+                for (const auto& c : p.counters_)
+                    addCount(phaseIt->counters_, c.first.c_str(), c.second);
+            }
+        }
+    }
+
+    std::sort(files.begin(), files.end(), [] (const auto& a, const auto& b) {
+        return a.second.seq_ < b.second.seq_;
+    });
+    for (auto& f : files) {
+        std::sort(f.second.phases_.begin(),
+                  f.second.phases_.end(),
+                  [] (const PhaseRecord& a, const PhaseRecord& b) {
+                      return a.seq_ < b.seq_;
+                  });
+    }
+    return files;
+}
+
+void writeJSONString(std::ostream& os, const std::string& s)
+{
+    os << '"';
+    for (auto c : s) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    static const char hex[] = "0123456789abcdef";
+                    os << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+                }
+                else
+                    os << c;
+        }
+    }
+    os << '"';
+}
+
+} // anonymous
+
+bool Instrumentation::isSupported()
+{
+#ifdef PSY_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Instrumentation::enable(bool enable)
+{
+    enabled_.store(enable, std::memory_order_relaxed);
+}
+
+bool Instrumentation::isEnabled()
+{
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+void Instrumentation::reset()
+{
+    std::lock_guard<std::mutex> lock(threadsMutex_);
+    for (const auto& recs : threads_) {
+        std::lock_guard<std::mutex> recsLock(recs->mutex_);
+        recs->files_.clear();
+        recs->lastFile_ = nullptr;
+    }
+}
+
+void Instrumentation::recordTime(const std::string& fileName,
+                                 const char* phase,
+                                 std::uint64_t nanoseconds)
+{
+    auto& recs = threadRecords();
+    std::lock_guard<std::mutex> lock(recs.mutex_);
+    auto& p = phaseRecord(recs, fileName, phase);
+    ++p.runs_;
+    p.nanoseconds_ += nanoseconds;
+}
+
+void Instrumentation::recordCount(const std::string& fileName,
+                                  const char* phase,
+                                  const char* counter,
+                                  std::uint64_t value)
+{
+    auto& recs = threadRecords();
+    std::lock_guard<std::mutex> lock(recs.mutex_);
+    auto& p = phaseRecord(recs, fileName, phase);
+    addCount(p.counters_, counter, value);
+}
+
+std::vector<Instrumentation::Measurement> Instrumentation::measurements()
+{
+    std::vector<Measurement> ms;
+    for (const auto& f : mergedRecords()) {
+        for (const auto& p : f.second.phases_)
+            ms.push_back(Measurement{ f.first, p.phase_, p.runs_, p.nanoseconds_, p.counters_ });
+    }
+    return ms;
+}
+
+void Instrumentation::writeJSON(std::ostream& os)
+{
+    auto files = mergedRecords();
+    os << "{\n  \"files\": [";
+    for (auto f = 0U; f < files.size(); ++f) {
+        const auto& file = files[f];
+        os << (f ? "," : "") << "\n    {\n      \"file\": ";
+        writeJSONString(os, file.first);
+        os << ",\n      \"phases\": [";
+        for (auto p = 0U; p < file.second.phases_.size(); ++p) {
+            const auto& phase = file.second.phases_[p];
+            os << (p ? "," : "") << "\n        { \"phase\": ";
+            writeJSONString(os, phase.phase_);
+            os << ", \"runs\": " << phase.runs_
+               << ", \"nanoseconds\": " << phase.nanoseconds_
+               << ", \"counters\": {";
+            for (auto c = 0U; c < phase.counters_.size(); ++c) {
+                os << (c ? ", " : " ");
+                writeJSONString(os, phase.counters_[c].first);
+                os << ": " << phase.counters_[c].second;
+            }
+            os << (phase.counters_.empty() ? "} }" : " } }");
+        }
+        os << "\n      ]\n    }";
+    }
+    os << "\n  ]\n}\n";
+}
+
+Instrumentation::ScopedTimer::ScopedTimer(std::string fileName, const char* phase)
+    : enabled_(Instrumentation::isEnabled())
+    , fileName_(std::move(fileName))
+    , phase_(phase)
+{
+    if (enabled_)
+        start_ = std::chrono::steady_clock::now();
+}
+
+Instrumentation::ScopedTimer::~ScopedTimer()
+{
+    if (!enabled_)
+        return;
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    Instrumentation::recordTime(
+            fileName_,
+            phase_,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_INSTRUMENTATION_H__
+#define PSYCHE_INSTRUMENTATION_H__
+
+#include "../API.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psy {
+
+/**
+ * \brief The Instrumentation class.
+ *
+ * Timings and counters of the phases of the frontend (lexing, parsing,
+ * reparsing, binding, etc.), per file. Measurements are recorded through
+ * the \c PSY_INSTR_* macros, which compile away unless \c PSY_INSTRUMENTATION
+ * is defined; and, even then, only take effect while Instrumentation is
+ * enabled.
+ *
+ * Each thread records into its own (uncontended) records, which are merged
+ * only when the measurements are read.
+ */
+class PSY_API Instrumentation
+{
+public:
+    /**
+     * Whether Instrumentation is compiled in.
+     */
+    static bool isSupported();
+
+    //!@{
+    /**
+     * Whether Instrumentation is enabled.
+     */
+    static void enable(bool enable);
+    static bool isEnabled();
+    //!@}
+
+    /**
+     * Discard all measurements.
+     */
+    static void reset();
+
+    /**
+     * Record the time \p nanoseconds spent in phase \p phase of file \p fileName.
+     */
+    static void recordTime(const std::string& fileName,
+                           const char* phase,
+                           std::uint64_t nanoseconds);
+
+    /**
+     * Add \p value to counter \p counter of phase \p phase of file \p fileName.
+     *
+     * \remark The name \p counter is copied; the name \p phase is not.
+     */
+    static void recordCount(const std::string& fileName,
+                            const char* phase,
+                            const char* counter,
+                            std::uint64_t value);
+
+    /**
+     * \brief The Measurement struct.
+     *
+     * The measurement of a phase of a file.
+     */
+    struct Measurement
+    {
+        std::string fileName_;
+        std::string phase_;
+        std::uint64_t runs_;
+        std::uint64_t nanoseconds_;
+        std::vector<std::pair<std::string, std::uint64_t>> counters_;
+    };
+
+    /**
+     * The measurements, in the order in which files and phases were recorded.
+     */
+    static std::vector<Measurement> measurements();
+
+    /**
+     * Write the measurements, as JSON, to \p os.
+     */
+    static void writeJSON(std::ostream& os);
+
+    /**
+     * \brief The ScopedTimer class.
+     */
+    class PSY_API ScopedTimer
+    {
+    public:
+        ScopedTimer(std::string fileName, const char* phase);
+        ~ScopedTimer();
+
+    private:
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        bool enabled_;
+        std::string fileName_;
+        const char* phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+};
+
+} // psy
+
+#define PSY_INSTR_NAME__(PREFIX, LINE) PREFIX##LINE
+#define PSY_INSTR_NAME_(PREFIX, LINE) PSY_INSTR_NAME__(PREFIX, LINE)
+
+#ifdef PSY_INSTRUMENTATION
+    #define PSY_INSTR_TIME(FILE_NAME, PHASE) \
+        ::psy::Instrumentation::ScopedTimer PSY_INSTR_NAME_(psyInstrTimer_, __LINE__)( \
+            ::psy::Instrumentation::isEnabled() ? std::string(FILE_NAME) : std::string(), \
+            PHASE)
+    #define PSY_INSTR_COUNT(FILE_NAME, PHASE, COUNTER, VALUE) \
+        do { \
+            if (::psy::Instrumentation::isEnabled()) \
+                ::psy::Instrumentation::recordCount(FILE_NAME, PHASE, COUNTER, VALUE); \
+        } while (0)
+    #define PSY_INSTR_DO(STMT) STMT
+#else
+    #define PSY_INSTR_TIME(FILE_NAME, PHASE)
+    #define PSY_INSTR_COUNT(FILE_NAME, PHASE, COUNTER, VALUE)
+    #define PSY_INSTR_DO(STMT)
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_OUTPUT_SINK_H__
+#define PSYCHE_OUTPUT_SINK_H__
+
+#include "../API.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace psy {
+
+/**
+ * \brief The OutputSink class.
+ *
+ * A buffered sink of characters in front of an \c std::ostream. Text is
+ * accumulated in a fixed-capacity buffer and handed to the stream in
+ * large chunks, so that a dump of a (large) SyntaxTree may be emitted
+ * incrementally, without an intermediate copy of the whole output.
+ *
+ * \remark The buffer is flushed upon destruction.
+ */
+class PSY_API OutputSink
+{
+public:
+    static constexpr std::size_t kDefaultCapacity = 64 * 1024;
+
+    explicit OutputSink(std::ostream& os, std::size_t capacity = kDefaultCapacity);
+    ~OutputSink();
+
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    /**
+     * Write the \p n characters of \p s.
+     */
+    OutputSink& write(const char* s, std::size_t n)
+    {
+        if (n > cap_ - len_) {
+            flush();
+            if (n > cap_) {
+                os_->write(s, static_cast<std::streamsize>(n));
+                return *this;
+            }
+        }
+        std::memcpy(buf_.get() + len_, s, n);
+        len_ += n;
+        return *this;
+    }
+
+    /**
+     * Write \p n times the character \p c.
+     */
+    OutputSink& fill(char c, std::size_t n)
+    {
+        while (n) {
+            if (len_ == cap_)
+                flush();
+            auto cnt = std::min(n, cap_ - len_);
+            std::memset(buf_.get() + len_, c, cnt);
+            len_ += cnt;
+            n -= cnt;
+        }
+        return *this;
+    }
+
+    OutputSink& operator<<(char c)
+    {
+        if (len_ == cap_)
+            flush();
+        buf_[len_++] = c;
+        return *this;
+    }
+
+    OutputSink& operator<<(const char* s) { return write(s, std::strlen(s)); }
+    OutputSink& operator<<(std::string_view s) { return write(s.data(), s.size()); }
+    OutputSink& operator<<(const std::string& s) { return write(s.data(), s.size()); }
+
+    template <class IntT,
+              std::enable_if_t<std::is_integral_v<IntT>
+                                   && !std::is_same_v<IntT, char>
+                                   && !std::is_same_v<IntT, bool>, int> = 0>
+    OutputSink& operator<<(IntT v)
+    {
+        char digits[24];
+        auto r = std::to_chars(digits, digits + sizeof(digits), v);
+        return write(digits, static_cast<std::size_t>(r.ptr - digits));
+    }
+
+    /**
+     * Hand the buffered characters to the underlying stream.
+     */
+    void flush();
+
+private:
+    std::ostream* os_;
+    std::unique_ptr<char[]> buf_;
+    std::size_t cap_;
+    std::size_t len_;
+};
+
+} // psy
+
+#endif
@@ -44,6 +44,15 @@ std::string applyAll(const Substitution<std::string>& sub, const std::string& in
     return substituted;
 }
 
+template <>
+std::string applyAll(const std::vector<Substitution<std::string>>& seq, const std::string& input)
+{
+    std::string substituted = input;
+    for (const auto& sub : seq)
+        substituted = applyAll(sub, substituted);
+    return substituted;
+}
+
 template <>
 std::string applyOnce(const std::vector<Substitution<std::string>>& seq, const std::string& input)
 {
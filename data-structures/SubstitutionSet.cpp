@@ -0,0 +1,261 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SubstitutionSet.h"
+
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+
+using namespace psy;
+
+namespace {
+
+/*
+ * Whether an occurrence of \c from may overlap (a replacement) \c to in the
+ * text around it.
+ */
+bool mayOverlap(const std::string& from, const std::string& to)
+{
+    if (to.find(from) != std::string::npos || from.find(to) != std::string::npos)
+        return true;
+
+    auto n = std::min(from.size(), to.size());
+    for (std::size_t k = 1; k < n; ++k) {
+        if (to.compare(to.size() - k, k, from, 0, k) == 0
+                || to.compare(0, k, from, from.size() - k, k) == 0)
+            return true;
+    }
+    return false;
+}
+
+} // anonymous
+
+SubstitutionSet::SubstitutionSet(const std::vector<Substitution<std::string>>& seq)
+{
+    states_.emplace_back();
+    rootChildren_.fill(kNone);
+
+    std::unordered_map<std::string, uint32_t> patternIds;
+    for (const auto& sub : seq) {
+        if (sub == Substitution<std::string>::Trivial || sub.from().empty())
+            continue;
+
+        // A substitution starts a new stage if it may match text replaced in
+        // the current one or (made adjacent) around a deletion.
+        auto stageBegin = stageEnds_.empty() ? 0 : stageEnds_.back();
+        for (auto i = stageBegin; i < tos_.size(); ++i) {
+            if (tos_[i].empty() || mayOverlap(sub.from(), tos_[i])) {
+                stageEnds_.push_back(tos_.size());
+                break;
+            }
+        }
+
+        auto [it, isNew] = patternIds.emplace(sub.from(), static_cast<uint32_t>(patterns_.size()));
+        if (isNew) {
+            patterns_.push_back(sub.from());
+
+            uint32_t state = 0;
+            for (auto c : sub.from()) {
+                auto next = child(state, c);
+                state = next != kNone ? next : addChild(state, c);
+            }
+            states_[state].pattern_ = it->second;
+        }
+        patternOfSub_.push_back(it->second);
+        tos_.push_back(sub.to());
+    }
+    if (!tos_.empty())
+        stageEnds_.push_back(tos_.size());
+
+    buildFailureLinks();
+}
+
+uint32_t SubstitutionSet::child(uint32_t state, unsigned char c) const
+{
+    if (state == 0)
+        return rootChildren_[c];
+
+    for (auto s = states_[state].firstChild_; s != kNone; s = states_[s].nextSibling_) {
+        if (states_[s].char_ == c)
+            return s;
+    }
+    return kNone;
+}
+
+uint32_t SubstitutionSet::addChild(uint32_t state, unsigned char c)
+{
+    auto s = static_cast<uint32_t>(states_.size());
+    states_.emplace_back();
+    states_[s].char_ = c;
+    states_[s].nextSibling_ = states_[state].firstChild_;
+    states_[state].firstChild_ = s;
+    if (state == 0)
+        rootChildren_[c] = s;
+    return s;
+}
+
+void SubstitutionSet::buildFailureLinks()
+{
+    std::queue<uint32_t> queue;
+    for (auto s = states_[0].firstChild_; s != kNone; s = states_[s].nextSibling_)
+        queue.push(s);
+
+    while (!queue.empty()) {
+        auto state = queue.front();
+        queue.pop();
+
+        for (auto s = states_[state].firstChild_; s != kNone; s = states_[s].nextSibling_) {
+            auto c = states_[s].char_;
+            auto fail = states_[state].fail_;
+            auto next = child(fail, c);
+            while (next == kNone && fail != 0) {
+                fail = states_[fail].fail_;
+                next = child(fail, c);
+            }
+            states_[s].fail_ = next != kNone ? next : 0;
+
+            auto failState = states_[s].fail_;
+            states_[s].dictSuffix_ = states_[failState].pattern_ != kNone
+                    ? failState
+                    : states_[failState].dictSuffix_;
+            queue.push(s);
+        }
+    }
+}
+
+/*
+ * Call func(start, pattern) for every occurrence (overlapping ones included)
+ * of every pattern in the input.
+ */
+template <class FuncT>
+void SubstitutionSet::forEachOccurrence(const std::string& input, FuncT func) const
+{
+    uint32_t state = 0;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        auto c = static_cast<unsigned char>(input[i]);
+        auto next = child(state, c);
+        while (next == kNone && state != 0) {
+            state = states_[state].fail_;
+            next = child(state, c);
+        }
+        state = next != kNone ? next : 0;
+
+        auto s = states_[state].pattern_ != kNone ? state : states_[state].dictSuffix_;
+        for (; s != kNone; s = states_[s].dictSuffix_) {
+            auto pattern = states_[s].pattern_;
+            func(i + 1 - patterns_[pattern].size(), pattern);
+        }
+    }
+}
+
+std::string SubstitutionSet::applyAll(const std::string& input) const
+{
+    std::string substituted = input;
+    std::size_t stageBegin = 0;
+    for (auto stageEnd : stageEnds_) {
+        substituted = applyStage(stageBegin, stageEnd, substituted);
+        stageBegin = stageEnd;
+    }
+    return substituted;
+}
+
+/*
+ * Within a stage, a substitution matches only the input text (not replaced
+ * text), so each one in turn takes, from left to right, the occurrences of
+ * its pattern that don't overlap its own or those taken before it.
+ */
+std::string SubstitutionSet::applyStage(std::size_t subBegin,
+                                        std::size_t subEnd,
+                                        const std::string& input) const
+{
+    std::vector<bool> inStage(patterns_.size(), false);
+    for (auto sub = subBegin; sub < subEnd; ++sub)
+        inStage[patternOfSub_[sub]] = true;
+
+    // The positions at which each pattern starts, in increasing order.
+    std::vector<std::vector<std::size_t>> starts(patterns_.size());
+    forEachOccurrence(input, [&] (std::size_t start, uint32_t pattern) {
+        if (inStage[pattern])
+            starts[pattern].push_back(start);
+    });
+
+    std::vector<uint32_t> subAt(input.size(), kNone);
+    std::vector<bool> taken(input.size(), false);
+    for (auto sub = subBegin; sub < subEnd; ++sub) {
+        auto pattern = patternOfSub_[sub];
+        auto size = patterns_[pattern].size();
+        std::size_t next = 0;
+        for (auto start : starts[pattern]) {
+            if (start < next
+                    || std::find(taken.begin() + start,
+                                 taken.begin() + start + size,
+                                 true) != taken.begin() + start + size) {
+                continue;
+            }
+            std::fill(taken.begin() + start, taken.begin() + start + size, true);
+            subAt[start] = static_cast<uint32_t>(sub);
+            next = start + size;
+        }
+    }
+
+    std::string substituted;
+    substituted.reserve(input.size());
+    for (std::size_t i = 0; i < input.size();) {
+        auto sub = subAt[i];
+        if (sub == kNone) {
+            substituted += input[i++];
+            continue;
+        }
+        substituted += tos_[sub];
+        i += patterns_[patternOfSub_[sub]].size();
+    }
+    return substituted;
+}
+
+std::string SubstitutionSet::applyOnce(const std::string& input) const
+{
+    if (patterns_.empty())
+        return input;
+
+    // The positions at which each pattern starts, in increasing order.
+    std::vector<std::vector<std::size_t>> starts(patterns_.size());
+    forEachOccurrence(input, [&] (std::size_t start, uint32_t pattern) {
+        starts[pattern].push_back(start);
+    });
+
+    // Replacements precede the cursor, so the text after it is the input's.
+    std::string substituted;
+    substituted.reserve(input.size());
+    std::size_t cursor = 0;
+    for (std::size_t sub = 0; sub < tos_.size(); ++sub) {
+        auto pattern = patternOfSub_[sub];
+        const auto& patternStarts = starts[pattern];
+        auto it = std::lower_bound(patternStarts.begin(), patternStarts.end(), cursor);
+        if (it == patternStarts.end())
+            break;
+
+        substituted.append(input, cursor, *it - cursor);
+        substituted += tos_[sub];
+        cursor = *it + patterns_[pattern].size();
+    }
+    substituted.append(input, cursor, std::string::npos);
+    return substituted;
+}
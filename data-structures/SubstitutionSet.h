@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_SUBSTITUTION_SET_H__
+#define PSYCHE_SUBSTITUTION_SET_H__
+
+#include "Substitution.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace psy {
+
+/*!
+ * A sequence of string substitutions compiled into an Aho-Corasick automaton
+ * over their \c from patterns, so that they're applied in a single pass over
+ * the input (rather than in one pass per substitution).
+ *
+ * Trivial substitutions, and those with an empty \c from, are ignored.
+ */
+class SubstitutionSet
+{
+public:
+    explicit SubstitutionSet(const std::vector<Substitution<std::string>>& seq);
+
+    /*!
+     * The same as applying (the single-substitution) \c applyAll for each
+     * substitution in turn.
+     *
+     * Consecutive substitutions whose patterns can't overlap the replacements
+     * of the ones before them form a stage, applied in a single pass; another
+     * pass is needed only where a substitution may match replaced text.
+     */
+    std::string applyAll(const std::string& input) const;
+
+    /*!
+     * Replace, for each substitution in turn, the first occurrence of its
+     * pattern that lies after the previous replacement: the same as \c applyOnce.
+     * A pattern that isn't found stops the substitutions after it.
+     */
+    std::string applyOnce(const std::string& input) const;
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    struct State
+    {
+        uint32_t firstChild_ = kNone;
+        uint32_t nextSibling_ = kNone;
+        uint32_t fail_ = 0;
+
+        //! The nearest state, along the failure links, that ends a pattern.
+        uint32_t dictSuffix_ = kNone;
+
+        //! The pattern that ends at this state.
+        uint32_t pattern_ = kNone;
+        unsigned char char_ = 0;
+    };
+
+    uint32_t child(uint32_t state, unsigned char c) const;
+    uint32_t addChild(uint32_t state, unsigned char c);
+    void buildFailureLinks();
+
+    template <class FuncT>
+    void forEachOccurrence(const std::string& input, FuncT func) const;
+
+    std::string applyStage(std::size_t subBegin,
+                           std::size_t subEnd,
+                           const std::string& input) const;
+
+    //! The patterns (distinct).
+    std::vector<std::string> patterns_;
+
+    //! The substitutions, in order, by their pattern.
+    std::vector<uint32_t> patternOfSub_;
+    std::vector<std::string> tos_;
+
+    //! The (exclusive) end of each stage in the substitutions.
+    std::vector<std::size_t> stageEnds_;
+
+    std::vector<State> states_;
+
+    //! The transitions of the root, which has the largest fan-out, are dense.
+    std::array<uint32_t, 256> rootChildren_;
+};
+
+} // psy
+
+#endif
@@ -21,8 +21,9 @@
 #ifndef PSYCHE_VERSIONED_MAP_H__
 #define PSYCHE_VERSIONED_MAP_H__
 
-#include <algorithm>
 #include <cstdint>
+#include <optional>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -30,6 +31,17 @@ namespace psy {
 
 /*!
  * A versioned map.
+ *
+ * Every modification creates a revision, whose parent is the current
+ * revision; revision 0 is the empty map. Revisions thus form a tree, and
+ * applying a revision other than the current one walks the tree between
+ * them, undoing and redoing one edit per step: the cost is proportional
+ * to the distance between the revisions, not to the length of the history.
+ *
+ * Each edit keeps the value that is \e not in the map (the old one while
+ * the edit is applied, the new one while it's undone), so undo and redo
+ * are the same operation: a swap between the edit and the map. Values are
+ * moved, never copied, and may be move-only.
  */
 template <class KeyT, class ValueT>
 class VersionedMap
@@ -45,9 +57,11 @@ public:
 
     void insertOrAssign(const KeyT& key, const ValueT& value);
     void insertOrAssign(const KeyT& key, ValueT&& value);
+    void remove(const KeyT& key);
 
     void applyRevision(uint32_t revision);
     uint32_t revision() const { return curRevision_; }
+    uint32_t revisionCount() const { return static_cast<uint32_t>(edits_.size()) + 1; }
 
     // Basic traversal.
     const_iterator begin() const { return map_.begin(); }
@@ -55,41 +69,38 @@ public:
     const_iterator cbegin() const { return map_.begin(); }
     const_iterator cend() const { return map_.end(); }
     const_iterator find(const KeyT& key) const { return map_.find(key); }
+    std::size_t size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
 
 private:
-    void insertOrAssign_CORE(const KeyT& key, const ValueT& value);
-    void insertOrAssign_CORE(const KeyT& key, ValueT&& value);
-
-    // Encapsulates the action, as GoF's command other.
-    struct Command
+    //! The edit that creates a revision (from its parent).
+    struct Edit
     {
-        enum OpCode
-        {
-            Insert,
-            Remove
-        };
-
-        Command(const KeyT& key, const ValueT& value, OpCode code)
-            : key_(key), value_(value), opCode_(code)
+        Edit(uint32_t parent, uint32_t depth, const KeyT& key, std::optional<ValueT> value)
+            : parent_(parent), depth_(depth), key_(key), value_(std::move(value))
         {}
-        const KeyT key_;
-        const ValueT value_;
-        OpCode opCode_;
+
+        uint32_t parent_;
+        uint32_t depth_;
+        KeyT key_;
+
+        //! The value, of \c key_, that is not in the map: absent means no entry.
+        std::optional<ValueT> value_;
     };
 
-    void storeCommand(const Command& command);
+    void edit(const KeyT& key, std::optional<ValueT> value);
+    void swap(uint32_t revision);
+
+    uint32_t parentOf(uint32_t revision) const { return edits_[revision - 1].parent_; }
+    uint32_t depthOf(uint32_t revision) const { return revision ? edits_[revision - 1].depth_ : 0; }
 
-    //! Commands for each given revision.
-    std::vector<Command> commands_;
+    //! Revision \c i (other than the root) is created by edit \c i-1.
+    std::vector<Edit> edits_;
 
-    //!@{
-    /*!
-     * Revisioning mechanism.
-     */
     uint32_t curRevision_ { 0 };
-    uint32_t revisionCnt_ { 0 };
-    std::unordered_map<uint32_t, uint32_t> reverts_;
-    //!@}
+
+    //! Scratch space of applyRevision().
+    std::vector<uint32_t> redos_;
 
     //! The actual underlying map.
     BaseMap map_;
@@ -99,69 +110,81 @@ template <class KeyT, class ValueT>
 void VersionedMap<KeyT, ValueT>::insertOrAssign(const KeyT& key,
                                                 const ValueT& value)
 {
-    storeCommand(Command(key, value, Command::Insert));
-    insertOrAssign_CORE(key, value);
+    edit(key, std::optional<ValueT>(value));
 }
 
 template <class KeyT, class ValueT>
-void VersionedMap<KeyT, ValueT>::insertOrAssign_CORE(const KeyT& key,
-                                                    const ValueT& value)
+void VersionedMap<KeyT, ValueT>::insertOrAssign(const KeyT& key,
+                                                ValueT&& value)
 {
-    map_[key] = value;
+    edit(key, std::optional<ValueT>(std::move(value)));
 }
 
 template <class KeyT, class ValueT>
-void VersionedMap<KeyT, ValueT>::insertOrAssign(const KeyT& key,
-                                                ValueT&& value)
+void VersionedMap<KeyT, ValueT>::remove(const KeyT& key)
 {
-    storeCommand(Command(key, value, Command::Insert));
-    insertOrAssign_CORE(key, std::move(value));
+    edit(key, std::nullopt);
 }
 
 template <class KeyT, class ValueT>
-void VersionedMap<KeyT, ValueT>::insertOrAssign_CORE(const KeyT& key,
-                                                    ValueT&& value)
+void VersionedMap<KeyT, ValueT>::edit(const KeyT& key, std::optional<ValueT> value)
 {
-    // We don't want to use operator[] because this would require ValueT to
-    // have a default constructor (Range, for instance, doesn't have one, and
-    // this is by design). C++17 has already insert_or_assign.
-    auto it = map_.find(key);
-    if (it != map_.end())
-        it->second = std::move(value);
-    else
-        map_.insert(std::make_pair(key, std::move(value)));
+    edits_.emplace_back(curRevision_, depthOf(curRevision_) + 1, key, std::move(value));
+    curRevision_ = static_cast<uint32_t>(edits_.size());
+    swap(curRevision_);
 }
 
 template <class KeyT, class ValueT>
-void VersionedMap<KeyT, ValueT>::storeCommand(const Command& command)
+void VersionedMap<KeyT, ValueT>::swap(uint32_t revision)
 {
-    commands_.push_back(command);
-    reverts_.insert(std::make_pair(++revisionCnt_, curRevision_));
-    curRevision_ = revisionCnt_;
+    auto& edit = edits_[revision - 1];
+
+    // We don't use operator[] because that would require ValueT to have a
+    // default constructor (Range, for instance, doesn't have one, and this
+    // is by design).
+    auto it = map_.find(edit.key_);
+    std::optional<ValueT> old;
+    if (it != map_.end()) {
+        old.emplace(std::move(it->second));
+        if (edit.value_)
+            it->second = std::move(*edit.value_);
+        else
+            map_.erase(it);
+    }
+    else if (edit.value_) {
+        map_.emplace(edit.key_, std::move(*edit.value_));
+    }
+    edit.value_ = std::move(old);
 }
 
 template <class KeyT, class ValueT>
 void VersionedMap<KeyT, ValueT>::applyRevision(uint32_t revision)
 {
-    std::vector<uint32_t> ordered;
-    auto it = reverts_.find(revision);
-    while (it != reverts_.end()) {
-        ordered.push_back(it->second);
-        it = reverts_.find(it->second);
+    if (revision > edits_.size() || revision == curRevision_)
+        return;
+
+    // Undo up to the common ancestor, and redo (in order) down to the target.
+    auto from = curRevision_;
+    auto to = revision;
+    redos_.clear();
+    while (depthOf(from) > depthOf(to)) {
+        swap(from);
+        from = parentOf(from);
     }
+    while (depthOf(to) > depthOf(from)) {
+        redos_.push_back(to);
+        to = parentOf(to);
+    }
+    while (from != to) {
+        swap(from);
+        from = parentOf(from);
+        redos_.push_back(to);
+        to = parentOf(to);
+    }
+    for (auto it = redos_.rbegin(); it != redos_.rend(); ++it)
+        swap(*it);
 
     curRevision_ = revision;
-    if (ordered.empty())
-        return; // Nothing to do.
-
-    std::reverse(ordered.begin(), ordered.end());
-    map_.clear();
-    for (auto current : ordered) {
-        const auto& command = commands_[current];
-        ValueT value = command.value_;
-        if (command.opCode_ == Command::Insert)
-            insertOrAssign_CORE(command.key_, std::move(value));
-    }
 }
 
 } // psy
@@ -0,0 +1,240 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+ * A standalone driver for the fuzz targets (when they're not built with
+ * libFuzzer): it replays a corpus of inputs, times each one, and flags
+ * those whose parse time is super-linear in their size.
+ *
+ * The check is differential: an input is timed against itself repeated
+ * twice (one copy after the other), and a ratio well above 2 (what a
+ * linear-time parse yields) indicates a performance cliff, e.g.,
+ * pathological backtracking. (Timing against a prefix of the input isn't
+ * as reliable: a truncated input is typically malformed, and the parser
+ * gives up on it early.) Since a cliff may also lie within a single
+ * construct (which doubling the input doesn't make any deeper), inputs
+ * whose throughput is too low are flagged as well.
+ */
+
+#include "utility/IO.h"
+
+#include "cxxopts.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+using namespace psy;
+
+namespace {
+
+const char* const kReplay = "replay: ";
+
+struct Input
+{
+    std::string filePath_;
+    std::string text_;
+};
+
+struct Timing
+{
+    std::string filePath_;
+    std::size_t size_;
+    std::uint64_t nanoseconds_;
+    double doubledRatio_;
+    bool flagged_;
+};
+
+std::uint64_t bestTime(const char* data, std::size_t size, int repeatCnt)
+{
+    auto best = std::numeric_limits<std::uint64_t>::max();
+    for (auto i = 0; i < repeatCnt; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t*>(data), size);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min<std::uint64_t>(
+                    best,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    return best;
+}
+
+bool collectInputs(const std::string& path, std::vector<Input>& inputs)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<std::string> filePaths;
+    std::error_code ec;
+    if (fs::is_directory(path, ec)) {
+        for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+            if (entry.is_regular_file())
+                filePaths.push_back(entry.path().string());
+        }
+        std::sort(filePaths.begin(), filePaths.end());
+    }
+    else {
+        filePaths.push_back(path);
+    }
+
+    for (const auto& filePath : filePaths) {
+        auto [exit, text] = readFile(filePath);
+        if (exit != 0) {
+            std::cerr << kReplay << "can't read " << filePath << std::endl;
+            return false;
+        }
+        inputs.push_back(Input{ filePath, std::move(text) });
+    }
+    return true;
+}
+
+} // anonymous
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options cmdLineOpts(argv[0], "replay of a fuzz target of psychec's C frontend");
+    cmdLineOpts
+        .positional_help("file|dir...")
+        .add_options()
+            ("input",
+                "The input file(s) or corpus directory(ies).",
+                cxxopts::value<std::vector<std::string>>())
+            ("r,repeat",
+                "Run each input <n> times, keeping the best time.",
+                cxxopts::value<int>()->default_value("3"),
+                "<n>")
+            ("ratio",
+                "Flag inputs that, when doubled, take over <x> times as long.",
+                cxxopts::value<double>()->default_value("3.0"),
+                "<x>")
+            ("max-ns-per-byte",
+                "Flag inputs that take over <ns> nanoseconds per byte.",
+                cxxopts::value<unsigned int>()->default_value("10000"),
+                "<ns>")
+            ("min-time",
+                "Don't flag inputs that take less than <us> microseconds.",
+                cxxopts::value<unsigned int>()->default_value("1000"),
+                "<us>")
+            ("s,slowest",
+                "Report the <n> inputs with the lowest throughput.",
+                cxxopts::value<unsigned int>()->default_value("10"),
+                "<n>")
+            ("h,help",
+                "Print instructions.")
+    ;
+
+    std::vector<std::string> paths;
+    int repeatCnt = 0;
+    double maxRatio = 0;
+    double maxNsPerByte = 0;
+    std::uint64_t minTime = 0;
+    std::size_t slowestCnt = 0;
+    try {
+        cmdLineOpts.parse_positional(std::vector<std::string>{"input"});
+        auto parsedCmdLine = cmdLineOpts.parse(argc, argv);
+
+        if (parsedCmdLine.count("help") || !parsedCmdLine.count("input")) {
+            std::cout << cmdLineOpts.help() << std::endl;
+            return 0;
+        }
+
+        paths = parsedCmdLine["input"].as<std::vector<std::string>>();
+        repeatCnt = std::max(1, parsedCmdLine["repeat"].as<int>());
+        maxRatio = parsedCmdLine["ratio"].as<double>();
+        maxNsPerByte = parsedCmdLine["max-ns-per-byte"].as<unsigned int>();
+        minTime = parsedCmdLine["min-time"].as<unsigned int>() * 1000ULL;
+        slowestCnt = parsedCmdLine["slowest"].as<unsigned int>();
+    }
+    catch (...) {
+        std::cerr << kReplay << "unrecognized command-line flag" << std::endl;
+        return 1;
+    }
+
+    std::vector<Input> inputs;
+    for (const auto& path : paths) {
+        if (!collectInputs(path, inputs))
+            return 1;
+    }
+
+    auto nsPerByte = [] (const Timing& t) {
+        return static_cast<double>(t.nanoseconds_) / std::max<std::size_t>(1, t.size_);
+    };
+
+    std::vector<Timing> timings;
+    std::size_t flaggedCnt = 0;
+    for (const auto& input : inputs) {
+        const auto& text = input.text_;
+        auto time = bestTime(text.data(), text.size(), repeatCnt);
+        auto doubledText = text + '\n' + text;
+        auto doubledTime = bestTime(doubledText.data(), doubledText.size(), repeatCnt);
+        auto ratio = static_cast<double>(doubledTime) / std::max<std::uint64_t>(1, time);
+        Timing timing{ input.filePath_, text.size(), time, ratio, false };
+
+        if (doubledTime >= minTime && ratio > maxRatio) {
+            timing.flagged_ = true;
+            std::cout << "super-linear: " << input.filePath_
+                      << " (" << text.size() << " bytes, "
+                      << std::fixed << std::setprecision(3) << time / 1e6 << " ms, "
+                      << std::setprecision(2) << ratio << "x when doubled)" << std::endl;
+        }
+        if (time >= minTime && nsPerByte(timing) > maxNsPerByte) {
+            timing.flagged_ = true;
+            std::cout << "slow: " << input.filePath_
+                      << " (" << text.size() << " bytes, "
+                      << std::fixed << std::setprecision(3) << time / 1e6 << " ms, "
+                      << std::setprecision(1) << nsPerByte(timing) << " ns/byte)" << std::endl;
+        }
+
+        if (timing.flagged_)
+            ++flaggedCnt;
+        timings.push_back(timing);
+    }
+
+    slowestCnt = std::min(slowestCnt, timings.size());
+    std::partial_sort(timings.begin(),
+                      timings.begin() + slowestCnt,
+                      timings.end(),
+                      [&nsPerByte] (const Timing& a, const Timing& b) {
+                          return nsPerByte(a) > nsPerByte(b);
+                      });
+    if (slowestCnt)
+        std::cout << "Lowest throughput" << std::endl;
+    for (auto i = 0U; i < slowestCnt; ++i) {
+        const auto& t = timings[i];
+        std::cout << "    " << std::fixed << std::setprecision(1) << std::setw(10)
+                  << nsPerByte(t) << " ns/byte  "
+                  << std::setw(8) << t.size_ << " bytes  "
+                  << std::setprecision(2) << std::setw(6) << t.doubledRatio_ << "x  "
+                  << t.filePath_ << std::endl;
+    }
+
+    std::cout << "Replayed " << inputs.size() << " inputs; "
+              << flaggedCnt << " flagged" << std::endl;
+
+    return flaggedCnt ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "SubstitutionTester.h"
+
+#include "data-structures/SubstitutionSet.h"
+
+#include <random>
+
+using namespace psy;
+
+const std::string SubstitutionTester::Name = "SUBSTITUTION";
+
+void SubstitutionTester::testSubstitution()
+{
+    return run<SubstitutionTester>(tests_);
+}
+
+void SubstitutionTester::checkApplyAll(const Seq& seq, const std::string& input)
+{
+    PSY_EXPECT_EQ_STR(SubstitutionSet(seq).applyAll(input), applyAll(seq, input));
+}
+
+void SubstitutionTester::checkApplyOnce(const Seq& seq, const std::string& input)
+{
+    PSY_EXPECT_EQ_STR(SubstitutionSet(seq).applyOnce(input), applyOnce(seq, input));
+}
+
+void SubstitutionTester::case0001()
+{
+    Seq seq { { "foo", "bar" }, { "baz", "qux" } };
+
+    PSY_EXPECT_EQ_STR(applyAll(seq, std::string("foo baz foobaz")), "bar qux barqux");
+    checkApplyAll(seq, "foo baz foobaz");
+    checkApplyAll(seq, "");
+    checkApplyAll(Seq(), "foo");
+}
+
+void SubstitutionTester::case0002()
+{
+    // A replacement is matched by a later substitution.
+    Seq seq { { "a", "b" }, { "b", "c" } };
+
+    PSY_EXPECT_EQ_STR(applyAll(seq, std::string("ab")), "cc");
+    checkApplyAll(seq, "ab");
+    checkApplyAll(seq, "xaxbx");
+}
+
+void SubstitutionTester::case0003()
+{
+    // Overlapping patterns: the earlier substitution takes the text.
+    Seq seq1 { { "ab", "X" }, { "bc", "Y" } };
+    PSY_EXPECT_EQ_STR(applyAll(seq1, std::string("abc")), "Xc");
+    checkApplyAll(seq1, "abc");
+    checkApplyAll(seq1, "abcbcab");
+
+    Seq seq2 { { "bc", "Y" }, { "ab", "X" } };
+    PSY_EXPECT_EQ_STR(applyAll(seq2, std::string("abc")), "aY");
+    checkApplyAll(seq2, "abc");
+    checkApplyAll(seq2, "abcbcab");
+}
+
+void SubstitutionTester::case0004()
+{
+    // A pattern nested within another.
+    Seq seq { { "b", "Y" }, { "abc", "X" } };
+
+    PSY_EXPECT_EQ_STR(applyAll(seq, std::string("abc")), "aYc");
+    checkApplyAll(seq, "abc");
+    checkApplyAll(Seq { { "abc", "X" }, { "b", "Y" } }, "abcb");
+}
+
+void SubstitutionTester::case0005()
+{
+    // A deletion makes text adjacent, so that a later pattern matches across it.
+    Seq seq { { "a", "" }, { "bc", "Z" } };
+
+    PSY_EXPECT_EQ_STR(applyAll(seq, std::string("bac")), "Z");
+    checkApplyAll(seq, "bac");
+}
+
+void SubstitutionTester::case0006()
+{
+    // A replacement that straddles the boundary of a later pattern.
+    Seq seq { { "x", "ab" }, { "bc", "Z" } };
+
+    PSY_EXPECT_EQ_STR(applyAll(seq, std::string("xc")), "aZ");
+    checkApplyAll(seq, "xc");
+    checkApplyAll(Seq { { "x", "bc" }, { "ab", "Z" } }, "ax");
+}
+
+void SubstitutionTester::case0007()
+{
+    // The same pattern twice, and a pattern that overlaps itself.
+    checkApplyAll(Seq { { "x", "y" }, { "x", "z" } }, "xx");
+    checkApplyAll(Seq { { "aa", "b" } }, "aaa");
+    checkApplyAll(Seq { { "aa", "b" } }, "aaaa");
+    checkApplyAll(Seq { { "aa", "a" }, { "aa", "c" } }, "aaaaa");
+}
+
+void SubstitutionTester::case0008()
+{
+    Seq seq { { "a", "X" }, { "b", "Y" }, { "a", "Z" } };
+
+    PSY_EXPECT_EQ_STR(applyOnce(seq, std::string("abab")), "XYZb");
+    checkApplyOnce(seq, "abab");
+    checkApplyOnce(seq, "ba");
+    checkApplyOnce(Seq { { "ab", "X" }, { "bc", "Y" } }, "abcbc");
+}
+
+void SubstitutionTester::case0009()
+{
+    // A substitution whose pattern isn't found stops the later ones.
+    Seq seq { { "x", "y" }, { "nope", "z" }, { "a", "b" } };
+
+    PSY_EXPECT_EQ_STR(applyOnce(seq, std::string("xa")), "ya");
+    checkApplyOnce(seq, "xa");
+    PSY_EXPECT_EQ_STR(applyOnce(seq, std::string("a")), "a");
+    checkApplyOnce(seq, "a");
+    PSY_EXPECT_EQ_STR(applyOnce(seq, std::string("xnopea")), "yzb");
+    checkApplyOnce(seq, "xnopea");
+}
+
+void SubstitutionTester::case0010()
+{
+    std::mt19937 gen(2025);
+    auto randomText = [&gen] (std::size_t minSize, std::size_t maxSize) {
+        std::uniform_int_distribution<std::size_t> sizeDist(minSize, maxSize);
+        std::uniform_int_distribution<int> charDist(0, 2);
+        std::string text(sizeDist(gen), ' ');
+        for (auto& c : text)
+            c = static_cast<char>('a' + charDist(gen));
+        return text;
+    };
+
+    std::uniform_int_distribution<std::size_t> seqSizeDist(1, 6);
+    for (int i = 0; i < 2000; ++i) {
+        Seq seq;
+        auto seqSize = seqSizeDist(gen);
+        for (std::size_t j = 0; j < seqSize; ++j)
+            seq.emplace_back(randomText(1, 3), randomText(0, 3));
+        auto input = randomText(0, 24);
+
+        checkApplyAll(seq, input);
+        checkApplyOnce(seq, input);
+    }
+}
@@ -20,35 +20,254 @@
 
 #include "TestSuite.h"
 
+#include "Tester.h"
+#include "TestSuite_DataStructures.h"
+
 #include "C/tests/TestSuite_Internals.h"
 #include "C/tests/TestSuite_API.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 using namespace psy;
 
-void TestSuite::runTests()
+namespace {
+
+struct TesterTally
+{
+    std::string suiteDesc_;
+    std::string testerName_;
+    int passed_ = 0;
+    int failed_ = 0;
+};
+
+struct TestTiming
+{
+    std::string fullName_;
+    std::uint64_t nanoseconds_;
+};
+
+/*
+ * The state shared by the shards of a run: the selection of tests, the
+ * dispenser of tickets, and the console.
+ *
+ * Every shard enumerates the same sequence of selected tests; a shard runs
+ * the test whose position in that sequence matches the ticket it holds, and
+ * then takes the next ticket. So each test is run exactly once, by whichever
+ * shard is free first.
+ */
+class TestRun
+{
+public:
+    TestRun(const TestRunOptions& opts)
+        : opts_(opts)
+        , nextTicket_(0)
+    {}
+
+    bool selects(const std::string& testerName, const std::string& testName) const
+    {
+        if (!opts_.filter_.empty()
+                && (testerName + "-" + testName).find(opts_.filter_) == std::string::npos) {
+            return false;
+        }
+
+        if (opts_.rangeLast_ >= 0) {
+            auto digits = testName.find_first_of("0123456789");
+            if (digits == std::string::npos)
+                return false;
+            auto caseNum = std::atoi(testName.c_str() + digits);
+            if (caseNum < opts_.rangeFirst_ || caseNum > opts_.rangeLast_)
+                return false;
+        }
+
+        return true;
+    }
+
+    std::size_t takeTicket() { return nextTicket_.fetch_add(1, std::memory_order_relaxed); }
+
+    void print(const std::string& text)
+    {
+        std::lock_guard<std::mutex> lock(consoleMutex_);
+        std::cout << text << std::flush;
+    }
+
+private:
+    const TestRunOptions& opts_;
+    std::atomic<std::size_t> nextTicket_;
+    std::mutex consoleMutex_;
+};
+
+class ThreadShard final : public TestShard
+{
+public:
+    ThreadShard(TestRun* run)
+        : run_(run)
+        , pos_(0)
+        , ticket_(run->takeTicket())
+    {}
+
+    void runSuites()
+    {
+        TestShard::current() = this;
+        try {
+            C::InternalsTestSuite suite0;
+            suiteDesc_ = suite0.description();
+            suite0.testAll();
+
+            C::APITestSuite suite1;
+            suiteDesc_ = suite1.description();
+            suite1.testAll();
+
+            DataStructuresTestSuite suite2;
+            suiteDesc_ = suite2.description();
+            suite2.testAll();
+        }
+        catch (...) {
+            run_->print(buf_.str());
+            excep_ = std::current_exception();
+        }
+        TestShard::current() = nullptr;
+    }
+
+    bool claim(const std::string& testerName, const std::string& testName) override
+    {
+        if (tallies_.empty()
+                || tallies_.back().testerName_ != testerName
+                || tallies_.back().suiteDesc_ != suiteDesc_) {
+            tallies_.push_back(TesterTally{ suiteDesc_, testerName });
+        }
+
+        if (!run_->selects(testerName, testName))
+            return false;
+
+        if (pos_++ != ticket_)
+            return false;
+        ticket_ = run_->takeTicket();
+        return true;
+    }
+
+    std::ostream& stream() override { return buf_; }
+
+    void record(const std::string& testerName,
+                const std::string& testName,
+                bool passed,
+                std::uint64_t nanoseconds) override
+    {
+        auto& tally = tallies_.back();
+        passed ? ++tally.passed_ : ++tally.failed_;
+        timings_.push_back(TestTiming{ testerName + "-" + testName, nanoseconds });
+
+        run_->print(buf_.str());
+        buf_.str(std::string());
+    }
+
+    TestRun* run_;
+    std::size_t pos_;
+    std::size_t ticket_;
+    std::string suiteDesc_;
+    std::ostringstream buf_;
+    std::vector<TesterTally> tallies_;
+    std::vector<TestTiming> timings_;
+    std::exception_ptr excep_;
+};
+
+} // anonymous
+
+int TestSuite::runTests(const TestRunOptions& opts)
 {
     std::cout << "TESTS..." << std::endl;
 
-    C::InternalsTestSuite suite0;
-    auto [passed0, failed0] = suite0.testAll();
+    auto start = std::chrono::steady_clock::now();
+
+    TestRun run(opts);
+    auto jobs = std::max(1U, opts.jobs_);
+    std::vector<std::unique_ptr<ThreadShard>> shards;
+    for (auto i = 0U; i < jobs; ++i)
+        shards.emplace_back(new ThreadShard(&run));
+
+    if (jobs == 1) {
+        shards[0]->runSuites();
+    }
+    else {
+        std::vector<std::thread> threads;
+        for (auto& shard : shards)
+            threads.emplace_back(&ThreadShard::runSuites, shard.get());
+        for (auto& thread : threads)
+            thread.join();
+    }
 
-    C::APITestSuite suite1;
-    auto [passed1, failed1] = suite1.testAll();
+    auto elapsed = std::chrono::steady_clock::now() - start;
 
-    std::cout << suite0.description() << std::endl;
-    suite0.printSummary();
+    for (const auto& shard : shards) {
+        if (shard->excep_)
+            std::rethrow_exception(shard->excep_);
+    }
 
-    std::cout << suite1.description() << std::endl;
-    suite1.printSummary();
+    // Every shard sees the same testers, in the same order.
+    auto tallies = shards[0]->tallies_;
+    std::vector<TestTiming> timings;
+    for (const auto& shard : shards) {
+        for (auto i = 0U; i < tallies.size(); ++i) {
+            if (shard.get() != shards[0].get()) {
+                tallies[i].passed_ += shard->tallies_[i].passed_;
+                tallies[i].failed_ += shard->tallies_[i].failed_;
+            }
+        }
+        timings.insert(timings.end(), shard->timings_.begin(), shard->timings_.end());
+    }
+
+    int accErrorCnt = 0;
+    std::string suiteDesc;
+    for (const auto& tally : tallies) {
+        accErrorCnt += tally.failed_;
+        if (!tally.passed_ && !tally.failed_)
+            continue;
+        if (tally.suiteDesc_ != suiteDesc) {
+            suiteDesc = tally.suiteDesc_;
+            std::cout << suiteDesc << std::endl;
+        }
+        std::cout << "    " << tally.testerName_ << std::endl
+                  << "        passed: " << tally.passed_ << std::endl
+                  << "        failed: " << tally.failed_ << std::endl;
+    }
+
+    auto slowestCnt = std::min<std::size_t>(opts.slowestCnt_, timings.size());
+    if (slowestCnt) {
+        std::partial_sort(timings.begin(),
+                          timings.begin() + slowestCnt,
+                          timings.end(),
+                          [] (const TestTiming& a, const TestTiming& b) {
+                              return a.nanoseconds_ > b.nanoseconds_;
+                          });
+        std::cout << "Slowest tests" << std::endl;
+        for (auto i = 0U; i < slowestCnt; ++i) {
+            std::cout << "    " << std::fixed << std::setprecision(3) << std::setw(10)
+                      << timings[i].nanoseconds_ / 1e6 << " ms  "
+                      << timings[i].fullName_ << std::endl;
+        }
+    }
+
+    std::cout << "Ran " << timings.size() << " tests in "
+              << std::fixed << std::setprecision(3)
+              << std::chrono::duration<double>(elapsed).count() << " s"
+              << " (" << jobs << (jobs == 1 ? " job" : " jobs") << ")" << std::endl;
 
-    auto accErrorCnt = failed0 + failed1;
     if (!accErrorCnt)
         std::cout << "All passed" << std::endl;
     else
         std::cout << std::string(17, '.') << " \n"
                   << "> Total failures: "
-                  << failed0 + failed1
+                  << accErrorCnt
                   << std::endl;
+
+    return accErrorCnt;
 }
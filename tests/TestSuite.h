@@ -27,15 +27,44 @@
 
 namespace psy {
 
+/**
+ * \brief The TestRunOptions struct.
+ */
+struct TestRunOptions
+{
+    /**
+     * The number of threads over which tests are sharded.
+     */
+    unsigned int jobs_ = 1;
+
+    /**
+     * Run only tests whose full name (e.g., \c PARSER-case0001) contains this text.
+     */
+    std::string filter_;
+
+    /**
+     * Run only tests whose case number lies in this (inclusive) range.
+     */
+    int rangeFirst_ = 0;
+    int rangeLast_ = -1;
+
+    /**
+     * The number of slowest tests to report.
+     */
+    unsigned int slowestCnt_ = 10;
+};
+
 class TestSuite
 {
 public:
     virtual ~TestSuite() {}
     virtual std::string description() const = 0;
     virtual std::tuple<int, int> testAll() = 0;
-    virtual void printSummary() const = 0;
 
-    static void runTests();
+    /**
+     * Run the tests selected by \p opts and return the number of failures.
+     */
+    static int runTests(const TestRunOptions& opts = TestRunOptions());
 };
 
 } // psy
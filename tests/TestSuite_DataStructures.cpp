@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "TestSuite_DataStructures.h"
+
+#include "SubstitutionTester.h"
+#include "VersionedMapTester.h"
+
+using namespace psy;
+
+DataStructuresTestSuite::~DataStructuresTestSuite()
+{}
+
+std::tuple<int, int> DataStructuresTestSuite::testAll()
+{
+    auto S = std::make_unique<SubstitutionTester>(this);
+    S->testSubstitution();
+
+    auto V = std::make_unique<VersionedMapTester>(this);
+    V->testVersionedMap();
+
+    auto res = std::make_tuple(S->totalPassed()
+                                    + V->totalPassed(),
+                               S->totalFailed()
+                                    + V->totalFailed());
+
+    testers_.emplace_back(S.release());
+    testers_.emplace_back(V.release());
+
+    return res;
+}
+
+std::string DataStructuresTestSuite::description() const
+{
+    return "data structures test suite";
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef PSYCHE_DATA_STRUCTURES_TEST_SUITE_H__
+#define PSYCHE_DATA_STRUCTURES_TEST_SUITE_H__
+
+#include "TestSuite.h"
+#include "Tester.h"
+
+#include <memory>
+#include <vector>
+
+namespace psy {
+
+class DataStructuresTestSuite : public TestSuite
+{
+public:
+    virtual ~DataStructuresTestSuite();
+
+    virtual std::tuple<int, int> testAll() override;
+    virtual std::string description() const override;
+
+private:
+    std::vector<std::unique_ptr<Tester>> testers_;
+};
+
+} // psy
+
+#endif
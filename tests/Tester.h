@@ -21,6 +21,8 @@
 #ifndef PSYCHE_TESTER_H__
 #define PSYCHE_TESTER_H__
 
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <type_traits>
@@ -30,7 +32,7 @@
 
 #define PSY__internals__FAIL(MSG) \
     do { \
-        std::cout << "\n!\tFAIL\n" \
+        ::psy::TestShard::out() << "\n!\tFAIL\n" \
                   << "\tReason: " << MSG << "\n" \
                   << "\t\t" << __FILE__ << ":" << __LINE__ << std::endl; \
         throw TestFailed(); \
@@ -40,7 +42,7 @@
 #define PSY__internals__EXPECT_EQ(ACTUAL, EXPECTED, EQ) \
     do { \
         if (!(EQ(ACTUAL, EXPECTED))) { \
-            std::cout << "\n!\tFAIL\n" \
+            ::psy::TestShard::out() << "\n!\tFAIL\n" \
                       << "\t\tActual  : " << ACTUAL << "\n" \
                       << "\t\tExpected: " << EXPECTED << "\n" \
                       << "\t\t" << __FILE__ << ":" << __LINE__ << std::endl; \
@@ -52,7 +54,7 @@
     do { \
         if (!(PSY__internals__EQ_OPTR(std::underlying_type_t<UNDER_TYPE>(ACTUAL), \
                                       std::underlying_type_t<UNDER_TYPE>(EXPECTED)))) { \
-            std::cout << "\n!\tFAIL\n" \
+            ::psy::TestShard::out() << "\n!\tFAIL\n" \
                       << "\t\tActual  : " << ACTUAL << "\n" \
                       << "\t\tExpected: " << EXPECTED << "\n" \
                       << "\t\t" << __FILE__ << ":" << __LINE__ << std::endl; \
@@ -63,7 +65,7 @@
 #define PSY__internals__EXPECT_BOOL(EXPR, BOOLEAN) \
     do { \
         if (bool(EXPR) != BOOLEAN) { \
-            std::cout << "\n!\tFAIL\n" \
+            ::psy::TestShard::out() << "\n!\tFAIL\n" \
                       << "\t\tExpression is NOT " << #BOOLEAN << "\n" \
                       << "\t\t" << __FILE__ << ":" << __LINE__ << std::endl; \
             throw TestFailed(); \
@@ -85,6 +87,45 @@ struct TestFailed {};
 
 class TestSuite;
 
+/**
+ * \brief The TestShard class.
+ *
+ * The portion of a test run executed by a thread: testers ask it whether
+ * a test is theirs to run, write their output to it, and report results.
+ */
+class TestShard
+{
+public:
+    /**
+     * The shard of the calling thread (if any).
+     */
+    static TestShard*& current()
+    {
+        // Testers live in the frontend library and the runner in the
+        // executable; this (inline) definition is shared by both.
+        static thread_local TestShard* shard = nullptr;
+        return shard;
+    }
+
+    /**
+     * The stream of the shard of the calling thread, or \c std::cout.
+     */
+    static std::ostream& out()
+    {
+        auto shard = current();
+        return shard ? shard->stream() : std::cout;
+    }
+
+    virtual ~TestShard() {}
+
+    virtual bool claim(const std::string& testerName, const std::string& testName) = 0;
+    virtual std::ostream& stream() = 0;
+    virtual void record(const std::string& testerName,
+                        const std::string& testName,
+                        bool passed,
+                        std::uint64_t nanoseconds) = 0;
+};
+
 class Tester
 {
 public:
@@ -112,23 +153,39 @@ protected:
     template <class TesterT, class TestContT>
     void run(const TestContT& tests)
     {
+        auto shard = TestShard::current();
         for (auto testData : tests) {
+            if (shard && !shard->claim(TesterT::Name, testData.second))
+                continue;
+
             setUp();
 
             curTestFunc_ = testData.second;
-            std::cout << "\t" << TesterT::Name << "-" << curTestFunc_ << "... ";
+            auto& os = TestShard::out();
+            os << "\t" << TesterT::Name << "-" << curTestFunc_ << "... ";
 
+            bool passed = false;
+            auto start = std::chrono::steady_clock::now();
             try {
                 auto curTestFunc = testData.first;
                 curTestFunc(static_cast<TesterT*>(this));
-                std::cout << "OK";
+                os << "OK";
                 ++cntPassed_;
+                passed = true;
             } catch (const TestFailed&) {
                 ++cntFailed_;
             }
-            std::cout << "\n\t-------------------------------------------------" << std::endl;
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            os << "\n\t-------------------------------------------------" << std::endl;
 
             tearDown();
+
+            if (shard) {
+                shard->record(TesterT::Name,
+                              curTestFunc_,
+                              passed,
+                              std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
         }
     }
 
@@ -0,0 +1,187 @@
+// Copyright (c) 2025 Leandro T. C. Melo <ltcmelo@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "VersionedMapTester.h"
+
+#include <memory>
+#include <random>
+
+using namespace psy;
+
+const std::string VersionedMapTester::Name = "VERSIONED MAP";
+
+void VersionedMapTester::testVersionedMap()
+{
+    return run<VersionedMapTester>(tests_);
+}
+
+void VersionedMapTester::checkContents(const Map& vmap, const std::map<int, std::string>& expected)
+{
+    PSY_EXPECT_EQ_INT(vmap.size(), expected.size());
+    for (const auto& [key, value] : expected) {
+        auto it = vmap.find(key);
+        PSY_EXPECT_TRUE(it != vmap.end());
+        PSY_EXPECT_EQ_STR(it->second, value);
+    }
+}
+
+void VersionedMapTester::case0001()
+{
+    Map vmap;
+    PSY_EXPECT_TRUE(vmap.empty());
+    PSY_EXPECT_EQ_INT(vmap.revision(), 0);
+    PSY_EXPECT_EQ_INT(vmap.revisionCount(), 1);
+    PSY_EXPECT_TRUE(vmap.find(1) == vmap.end());
+}
+
+void VersionedMapTester::case0002()
+{
+    Map vmap;
+    vmap.insertOrAssign(1, "one");
+    vmap.insertOrAssign(2, "two");
+
+    PSY_EXPECT_EQ_INT(vmap.revision(), 2);
+    PSY_EXPECT_EQ_INT(vmap.revisionCount(), 3);
+    checkContents(vmap, { { 1, "one" }, { 2, "two" } });
+    PSY_EXPECT_TRUE(vmap.find(3) == vmap.end());
+}
+
+void VersionedMapTester::case0003()
+{
+    // Overwrite, and remove.
+    Map vmap;
+    vmap.insertOrAssign(1, "one");
+    vmap.insertOrAssign(1, "uno");
+    checkContents(vmap, { { 1, "uno" } });
+
+    vmap.remove(1);
+    checkContents(vmap, {});
+
+    // Removing a key that isn't in the map still creates a revision.
+    vmap.remove(7);
+    PSY_EXPECT_EQ_INT(vmap.revision(), 4);
+    checkContents(vmap, {});
+}
+
+void VersionedMapTester::case0004()
+{
+    // Roll back to older revisions, and forward again.
+    Map vmap;
+    vmap.insertOrAssign(1, "one");
+    vmap.insertOrAssign(2, "two");
+    vmap.insertOrAssign(1, "uno");
+    vmap.remove(2);
+
+    vmap.applyRevision(3);
+    checkContents(vmap, { { 1, "uno" }, { 2, "two" } });
+    vmap.applyRevision(1);
+    checkContents(vmap, { { 1, "one" } });
+    vmap.applyRevision(0);
+    checkContents(vmap, {});
+    vmap.applyRevision(4);
+    PSY_EXPECT_EQ_INT(vmap.revision(), 4);
+    checkContents(vmap, { { 1, "uno" } });
+    vmap.applyRevision(2);
+    checkContents(vmap, { { 1, "one" }, { 2, "two" } });
+}
+
+void VersionedMapTester::case0005()
+{
+    // An edit after a rollback branches off; both branches remain reachable.
+    Map vmap;
+    vmap.insertOrAssign(1, "one");
+    vmap.insertOrAssign(2, "two");
+    vmap.applyRevision(1);
+    vmap.insertOrAssign(3, "three");
+
+    PSY_EXPECT_EQ_INT(vmap.revision(), 3);
+    checkContents(vmap, { { 1, "one" }, { 3, "three" } });
+
+    vmap.applyRevision(2);
+    checkContents(vmap, { { 1, "one" }, { 2, "two" } });
+
+    vmap.applyRevision(0);
+    vmap.insertOrAssign(1, "uno");
+    checkContents(vmap, { { 1, "uno" } });
+
+    vmap.applyRevision(3);
+    checkContents(vmap, { { 1, "one" }, { 3, "three" } });
+    vmap.applyRevision(4);
+    checkContents(vmap, { { 1, "uno" } });
+}
+
+void VersionedMapTester::case0006()
+{
+    // A revision that doesn't exist is ignored.
+    Map vmap;
+    vmap.insertOrAssign(1, "one");
+    vmap.applyRevision(5);
+
+    PSY_EXPECT_EQ_INT(vmap.revision(), 1);
+    checkContents(vmap, { { 1, "one" } });
+}
+
+void VersionedMapTester::case0007()
+{
+    // Move-only values.
+    VersionedMap<int, std::unique_ptr<int>> vmap;
+    vmap.insertOrAssign(1, std::make_unique<int>(10));
+    vmap.insertOrAssign(1, std::make_unique<int>(20));
+    PSY_EXPECT_EQ_INT(*vmap.find(1)->second, 20);
+
+    vmap.applyRevision(1);
+    PSY_EXPECT_EQ_INT(*vmap.find(1)->second, 10);
+    vmap.applyRevision(2);
+    PSY_EXPECT_EQ_INT(*vmap.find(1)->second, 20);
+}
+
+void VersionedMapTester::case0008()
+{
+    // Random edits and jumps, checked against a copy of every revision.
+    std::mt19937 gen(2025);
+    std::uniform_int_distribution<int> keyDist(0, 15);
+    std::uniform_int_distribution<int> opDist(0, 9);
+
+    Map vmap;
+    std::vector<std::map<int, std::string>> revisions { {} };
+    for (int i = 0; i < 2000; ++i) {
+        auto op = opDist(gen);
+        if (op < 2) {
+            std::uniform_int_distribution<uint32_t> revDist(0, vmap.revisionCount() - 1);
+            vmap.applyRevision(revDist(gen));
+        }
+        else {
+            auto m = revisions[vmap.revision()];
+            auto key = keyDist(gen);
+            if (op < 4) {
+                vmap.remove(key);
+                m.erase(key);
+            }
+            else {
+                auto value = std::to_string(i);
+                vmap.insertOrAssign(key, value);
+                m[key] = value;
+            }
+            revisions.push_back(std::move(m));
+        }
+        PSY_EXPECT_EQ_INT(vmap.revisionCount(), revisions.size());
+        checkContents(vmap, revisions[vmap.revision()]);
+    }
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+
+# Preprocess the C files of a (local) directory and benchmark the
+# frontend over them; e.g., from within a built zlib or lua checkout:
+#
+#   benchmark.sh . results.json
+
+set -e
+set -u
+
+if [ $# -lt 1 ]; then
+    echo "usage: $0 <dir> [<output.json>]"
+    exit 1
+fi
+
+SRC_DIR=$1
+OUTPUT=${2:-}
+BENCHMARK=${BENCHMARK:-$(dirname "$0")/../../benchmark}
+CC=${CC:-gcc}
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+for f in "$SRC_DIR"/*.c; do
+    "$CC" -E -I "$SRC_DIR" "$f" -o "$WORK_DIR/$(basename "$f" .c).i"
+done
+
+if [ -n "$OUTPUT" ]; then
+    "$BENCHMARK" --repeat 5 --output "$OUTPUT" "$WORK_DIR"/*.i
+else
+    "$BENCHMARK" --repeat 5 "$WORK_DIR"/*.i
+fi
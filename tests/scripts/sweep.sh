@@ -0,0 +1,45 @@
+#!/bin/sh
+
+# Sweep one dimension of the synthetic workloads and benchmark the frontend
+# at each point, printing a CSV row (with the per-phase seconds) per point:
+#
+#   sweep.sh expr-depth 10 20 40 80
+#   sweep.sh ambiguity 0 25 50 75 100
+#   sweep.sh size 100 200 400 800 1600
+
+set -e
+set -u
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 <shape> <value>..."
+    exit 1
+fi
+
+SHAPE=$1
+shift
+
+BIN_DIR=${BIN_DIR:-$(dirname "$0")/../..}
+GENERATOR=${GENERATOR:-$BIN_DIR/workload-generator}
+BENCHMARK=${BENCHMARK:-$BIN_DIR/benchmark}
+REPEAT=${REPEAT:-5}
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+phase_seconds() {
+    sed -n "s/.*\"phase\": \"$1\", \"seconds\": \([0-9.]*\).*/\1/p" "$2"
+}
+
+echo "shape,value,bytes,tokens,lex,parse,reparse,bind,canonicalize,resolve,check,total"
+for N in "$@"; do
+    "$GENERATOR" --shape "$SHAPE" --value "$N" --output "$WORK_DIR/$SHAPE-$N.c"
+    "$BENCHMARK" --repeat "$REPEAT" --output "$WORK_DIR/$SHAPE-$N.json" "$WORK_DIR/$SHAPE-$N.c"
+
+    ROW="$SHAPE,$N"
+    ROW="$ROW,$(sed -n 's/.*"bytes": \([0-9]*\).*/\1/p' "$WORK_DIR/$SHAPE-$N.json")"
+    ROW="$ROW,$(sed -n 's/.*"tokens": \([0-9]*\).*/\1/p' "$WORK_DIR/$SHAPE-$N.json")"
+    for P in lex parse reparse bind canonicalize resolve check total; do
+        ROW="$ROW,$(phase_seconds $P "$WORK_DIR/$SHAPE-$N.json")"
+    done
+    echo "$ROW"
+done